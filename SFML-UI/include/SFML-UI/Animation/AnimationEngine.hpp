@@ -0,0 +1,190 @@
+#pragma once
+
+#include SFMLUI_PCH
+
+#include <SFML-UI/Element.hpp>
+#include <SFML-UI/Animation/Easing.hpp>
+
+#include <array>
+#include <unordered_map>
+
+namespace sfui
+{
+
+/// <summary>
+/// Animates element properties. Every active tween is evaluated in one pass per frame.
+/// </summary>
+/// <remarks>
+/// <para>Tweens are stored as structure of arrays, one set of arrays per easing function, so progress, easing and interpolation are evaluated in tight loops the compiler can vectorize.</para>
+/// <para>Tweens of elements that were destroyed are dropped automatically (only for elements owned by shared pointer).</para>
+/// </remarks>
+class AnimationEngine
+	: public IUpdatable
+{
+public:
+	// Enums:
+
+	/// <summary>
+	/// Lists animatable element properties.
+	/// </summary>
+	enum class Property : std::uint8_t
+	{
+		PositionX,
+		PositionY,
+		Rotation,
+		ScaleX,
+		ScaleY,
+		OriginX,
+		OriginY
+	};
+
+	// Aliases:
+
+	using TweenId = std::uint32_t;
+
+	// Constants:
+
+	static constexpr TweenId InvalidTween = 0;
+
+	// Methods:
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="AnimationEngine"/> class.
+	/// </summary>
+	AnimationEngine();
+
+	/// <summary>
+	/// Starts animating the property between specified values.
+	/// </summary>
+	/// <param name="target_">The animated element.</param>
+	/// <param name="property_">The animated property.</param>
+	/// <param name="from_">The start value.</param>
+	/// <param name="to_">The end value.</param>
+	/// <param name="duration_">The duration (in seconds).</param>
+	/// <param name="easing_">The easing function.</param>
+	/// <returns>Identifier of the tween.</returns>
+	TweenId animate(Element & target_, Property const property_, float const from_, float const to_, double const duration_, Easing const easing_ = Easing::Linear);
+
+	/// <summary>
+	/// Starts animating the property from its current value.
+	/// </summary>
+	/// <param name="target_">The animated element.</param>
+	/// <param name="property_">The animated property.</param>
+	/// <param name="to_">The end value.</param>
+	/// <param name="duration_">The duration (in seconds).</param>
+	/// <param name="easing_">The easing function.</param>
+	/// <returns>Identifier of the tween.</returns>
+	TweenId animateTo(Element & target_, Property const property_, float const to_, double const duration_, Easing const easing_ = Easing::Linear);
+
+	/// <summary>
+	/// Stops the tween, leaving the property at its current value.
+	/// </summary>
+	/// <param name="tween_">The tween identifier.</param>
+	/// <returns>
+	///		<c>true</c> if succeeded; otherwise, <c>false</c>.
+	/// </returns>
+	bool cancel(TweenId const tween_);
+
+	/// <summary>
+	/// Stops every tween of the element, leaving its properties at current values.
+	/// </summary>
+	/// <param name="target_">The animated element.</param>
+	/// <returns>Number of stopped tweens.</returns>
+	std::size_t cancel(Element const & target_);
+
+	/// <summary>
+	/// Determines whether the tween is still running.
+	/// </summary>
+	/// <param name="tween_">The tween identifier.</param>
+	/// <returns>
+	///		<c>true</c> if running; otherwise, <c>false</c>.
+	/// </returns>
+	bool isRunning(TweenId const tween_) const {
+		return m_locations.find(tween_) != m_locations.end();
+	}
+
+	/// <summary>
+	/// Returns number of running tweens.
+	/// </summary>
+	/// <returns>Number of running tweens.</returns>
+	std::size_t getTweenCount() const {
+		return m_locations.size();
+	}
+
+	/// <summary>
+	/// Reads the current value of the property.
+	/// </summary>
+	/// <param name="target_">The element.</param>
+	/// <param name="property_">The property.</param>
+	/// <returns>Current value of the property.</returns>
+	static float getValue(Element const & target_, Property const property_);
+
+	/// <summary>
+	/// Writes the value of the property.
+	/// </summary>
+	/// <param name="target_">The element.</param>
+	/// <param name="property_">The property.</param>
+	/// <param name="value_">The value.</param>
+	static void setValue(Element & target_, Property const property_, float const value_);
+
+	// Overriden methods from IUpdatable:
+	/// <summary>
+	/// Advances every tween and writes animated values to elements.
+	/// </summary>
+	/// <param name="deltaTime_">Time that passed since previous frame.</param>
+	/// <param name="frameTime_">The frame start time.</param>
+	virtual void update(double const deltaTime_, TimePoint const & frameTime_) override;
+
+private:
+	/// <summary>
+	/// Tweens sharing one easing function, stored as structure of arrays.
+	/// </summary>
+	struct Lane
+	{
+		std::vector<TweenId>			ids;
+		std::vector<Element*>			targets;
+		std::vector< WeakPtr<Element> >	lifetimes;			// Used to detect destroyed targets.
+		std::vector<std::uint8_t>		isTracked;			// Whether lifetime refers to the target (target is owned by shared pointer).
+		std::vector<Property>			properties;
+		std::vector<float>				from;
+		std::vector<float>				delta;				// End value minus start value.
+		std::vector<float>				elapsed;
+		std::vector<float>				inverseDuration;
+		std::vector<float>				values;				// Scratch buffer, holds progress and then animated values.
+
+		/// <summary>
+		/// Returns number of tweens.
+		/// </summary>
+		std::size_t size() const {
+			return ids.size();
+		}
+	};
+
+	/// <summary>
+	/// Location of the tween inside lanes.
+	/// </summary>
+	struct Location
+	{
+		std::size_t lane;
+		std::size_t index;
+	};
+
+	/// <summary>
+	/// Evaluates every tween of the lane.
+	/// </summary>
+	template <Easing TEasing>
+	static void evaluateLane(Lane & lane_, float const deltaTime_);
+
+	/// <summary>
+	/// Removes tween from the lane by swapping it with the last one.
+	/// </summary>
+	void removeAt(std::size_t const lane_, std::size_t const index_);
+
+	// Members:
+
+	std::array<Lane, static_cast<std::size_t>(Easing::Count)>	m_lanes;
+	std::unordered_map<TweenId, Location>						m_locations;
+	TweenId														m_nextTween;
+};
+
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include SFMLUI_PCH
+
+namespace sfui
+{
+
+/// <summary>
+/// Lists easing functions supported by the <see cref="AnimationEngine"/>.
+/// </summary>
+enum class Easing : std::uint8_t
+{
+	Linear,
+	QuadIn,
+	QuadOut,
+	QuadInOut,
+	CubicIn,
+	CubicOut,
+	CubicInOut,
+	SmoothStep,
+
+	Count		// Number of easing functions, not an easing function itself.
+};
+
+namespace easing
+{
+
+/// <summary>
+/// Evaluates the easing function.
+/// </summary>
+/// <remarks>
+/// <para>Functions are branchless so loops evaluating them can be vectorized.</para>
+/// </remarks>
+/// <param name="t_">The progress, in range [0, 1].</param>
+/// <returns>Eased progress.</returns>
+template <Easing TEasing>
+inline float evaluate(float const t_)
+{
+	if constexpr (TEasing == Easing::Linear)
+		return t_;
+	else if constexpr (TEasing == Easing::QuadIn)
+		return t_ * t_;
+	else if constexpr (TEasing == Easing::QuadOut)
+		return t_ * (2.f - t_);
+	else if constexpr (TEasing == Easing::QuadInOut)
+	{
+		float const u = 1.f - t_;
+		return t_ < 0.5f ? 2.f * t_ * t_ : 1.f - 2.f * u * u;
+	}
+	else if constexpr (TEasing == Easing::CubicIn)
+		return t_ * t_ * t_;
+	else if constexpr (TEasing == Easing::CubicOut)
+	{
+		float const u = 1.f - t_;
+		return 1.f - u * u * u;
+	}
+	else if constexpr (TEasing == Easing::CubicInOut)
+	{
+		float const u = 1.f - t_;
+		return t_ < 0.5f ? 4.f * t_ * t_ * t_ : 1.f - 4.f * u * u * u;
+	}
+	else if constexpr (TEasing == Easing::SmoothStep)
+		return t_ * t_ * (3.f - 2.f * t_);
+	else
+		static_assert(TEasing != TEasing, "Unsupported easing function.");
+}
+
+/// <summary>
+/// Evaluates the easing function selected at runtime.
+/// </summary>
+/// <param name="easing_">The easing function.</param>
+/// <param name="t_">The progress, in range [0, 1].</param>
+/// <returns>Eased progress.</returns>
+float evaluate(Easing const easing_, float const t_);
+
+}
+
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include SFMLUI_PCH
+
+// Instruction set families the library has SIMD kernels for:
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+	#define SFMLUI_ARCH_X86 1
+#else
+	#define SFMLUI_ARCH_X86 0
+#endif
+
+// Marks function as allowed to use specified instruction set, regardless of compiler flags.
+// MSVC allows intrinsics of every instruction set in every function, so these expand to nothing there.
+#if SFMLUI_ARCH_X86 && (defined(__GNUC__) || defined(__clang__))
+	#define SFMLUI_TARGET_SSE2 __attribute__((target("sse2")))
+	#define SFMLUI_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+	#define SFMLUI_TARGET_SSE2
+	#define SFMLUI_TARGET_AVX2
+#endif
+
+namespace sfui
+{
+
+namespace cpu
+{
+
+/// <summary>
+/// Lists SIMD instruction sets used by batch kernels, from the narrowest.
+/// </summary>
+enum class InstructionSet
+{
+	Scalar,
+	Sse2,
+	Avx2
+};
+
+/// <summary>
+/// Determines the widest instruction set supported by both the CPU and the operating system.
+/// </summary>
+/// <remarks>
+/// <para>Detection runs once, the result is cached.</para>
+/// </remarks>
+/// <returns>The widest supported instruction set.</returns>
+InstructionSet getSupportedInstructionSet();
+
+/// <summary>
+/// Returns the instruction set batch kernels should use - the supported one, capped by the limit.
+/// </summary>
+/// <returns>The instruction set batch kernels should use.</returns>
+InstructionSet getInstructionSet();
+
+/// <summary>
+/// Caps the instruction set used by batch kernels. Useful to compare kernels or to rule out SIMD issues.
+/// </summary>
+/// <param name="limit_">The widest instruction set allowed.</param>
+void setInstructionSetLimit(InstructionSet const limit_);
+
+}
+
+}
@@ -0,0 +1,79 @@
+// File description:
+// Implements read-only memory-mapped file view (whole file, mapped on demand by the operating system).
+#pragma once
+
+// Precompiled header:
+#include SFMLUI_PCH
+
+#include <filesystem>
+#include <span>
+
+namespace sfui
+{
+
+/// <summary>
+/// Read-only view of a whole file, mapped into memory. Pages are loaded by the operating system on first access.
+/// </summary>
+class MappedFile
+{
+public:
+	// Methods:
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="MappedFile"/> class, not associated with any file.
+	/// </summary>
+	MappedFile() = default;
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="MappedFile"/> class, mapping the specified file.
+	/// </summary>
+	/// <param name="path_">The file path.</param>
+	/// <exception cref="std::runtime_error">File could not be opened or mapped.</exception>
+	explicit MappedFile(std::filesystem::path const & path_);
+
+	MappedFile(MappedFile && other_) noexcept;
+	MappedFile& operator=(MappedFile && other_) noexcept;
+
+	MappedFile(MappedFile const &) = delete;
+	MappedFile& operator=(MappedFile const &) = delete;
+
+	/// <summary>
+	/// Finalizes an instance of the <see cref="MappedFile"/> class, unmapping the file.
+	/// </summary>
+	~MappedFile();
+
+	/// <summary>
+	/// Unmaps the file.
+	/// </summary>
+	void close();
+
+	/// <summary>
+	/// Determines whether a file is mapped.
+	/// </summary>
+	/// <returns>
+	///		<c>true</c> if a file is mapped; otherwise, <c>false</c>.
+	/// </returns>
+	bool isOpen() const {
+		return m_isOpen;
+	}
+
+	/// <summary>
+	/// Returns the mapped file contents.
+	/// </summary>
+	/// <returns>The file contents (empty for empty files).</returns>
+	std::span<std::byte const> getData() const {
+		return { m_data, m_size };
+	}
+private:
+	// Members:
+
+	std::byte const*	m_data		= nullptr;	// Beginning of the mapped view.
+	std::size_t			m_size		= 0;		// Size of the mapped view (file size).
+	bool				m_isOpen	= false;	// Determines whether a file is associated (empty files are associated, but not mapped).
+#ifdef _WIN32
+	void*				m_file		= nullptr;	// File handle.
+	void*				m_mapping	= nullptr;	// File mapping handle.
+#endif
+};
+
+}
@@ -0,0 +1,185 @@
+// File description:
+// Implements compact 2D affine transformation matrix, used instead of 4x4 matrices on hot paths.
+#pragma once
+
+// Precompiled header:
+#include SFMLUI_PCH
+
+// Custom includes:
+#include "FastMath.hpp"
+#include "Helper.hpp"
+#include "Vector2.hpp"
+
+namespace math
+{
+
+/// <summary>
+/// Implements 2D affine transformation matrix, stored as its top two rows:
+/// | m00 m01 m02 |
+/// | m10 m11 m12 |
+/// </summary>
+/// <remarks>
+/// <para>Takes 6 values instead of 16 used by sf::Transform, and combining two matrices takes 12 multiplications instead of 27.</para>
+/// </remarks>
+template <typename TValueType>
+class Affine2
+{
+public:
+	using ValueType = TValueType;
+
+	static_assert(std::is_floating_point_v<ValueType>, "ValueType of an affine matrix must be a floating point type.");
+
+	ValueType m00, m01, m02;
+	ValueType m10, m11, m12;
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="Affine2"/> class as identity.
+	/// </summary>
+	constexpr Affine2()
+		:
+		m00{ 1 }, m01{ 0 }, m02{ 0 },
+		m10{ 0 }, m11{ 1 }, m12{ 0 }
+	{
+	}
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="Affine2"/> class.
+	/// </summary>
+	constexpr Affine2(	ValueType const m00_, ValueType const m01_, ValueType const m02_,
+						ValueType const m10_, ValueType const m11_, ValueType const m12_)
+		:
+		m00{ m00_ }, m01{ m01_ }, m02{ m02_ },
+		m10{ m10_ }, m11{ m11_ }, m12{ m12_ }
+	{
+	}
+
+	/// <summary>
+	/// Returns the identity matrix.
+	/// </summary>
+	/// <returns>The identity matrix.</returns>
+	static constexpr Affine2 identity() {
+		return Affine2{};
+	}
+
+	/// <summary>
+	/// Creates translation matrix.
+	/// </summary>
+	/// <param name="offset_">The offset.</param>
+	/// <returns>Translation matrix.</returns>
+	static constexpr Affine2 translation(Vector2<ValueType> const & offset_) {
+		return Affine2{ 1, 0, offset_.x, 0, 1, offset_.y };
+	}
+
+	/// <summary>
+	/// Creates matrix the same way sf::Transformable does: translates by -origin, scales, rotates and translates by position.
+	/// </summary>
+	/// <param name="position_">The position.</param>
+	/// <param name="rotation_">The rotation (in degrees).</param>
+	/// <param name="scale_">The scale.</param>
+	/// <param name="origin_">The origin.</param>
+	/// <param name="policy_">The math policy used for sine and cosine.</param>
+	/// <returns>Composed matrix.</returns>
+	template <typename TMathPolicy = PreciseMath>
+	static constexpr Affine2 fromTransformable(Vector2<ValueType> const & position_, ValueType const rotation_, Vector2<ValueType> const & scale_, Vector2<ValueType> const & origin_ = Vector2<ValueType>{}, TMathPolicy const policy_ = TMathPolicy{})
+	{
+		ValueType sine{}, cosine{};
+		policy_.sinCos(-convertToRadians(rotation_), sine, cosine);
+
+		ValueType const sxc		= scale_.x * cosine;
+		ValueType const syc		= scale_.y * cosine;
+		ValueType const sxs		= scale_.x * sine;
+		ValueType const sys		= scale_.y * sine;
+
+		return Affine2{
+				sxc,	sys,	-origin_.x * sxc - origin_.y * sys + position_.x,
+				-sxs,	syc,	origin_.x * sxs - origin_.y * syc + position_.y
+			};
+	}
+
+	/// <summary>
+	/// Computes determinant of the linear part.
+	/// </summary>
+	/// <returns>The determinant.</returns>
+	constexpr ValueType determinant() const {
+		return m00 * m11 - m01 * m10;
+	}
+
+	/// <summary>
+	/// Computes inverse matrix. Returns identity if the matrix is not invertible (same as sf::Transform).
+	/// </summary>
+	/// <returns>Inverse matrix.</returns>
+	constexpr Affine2 inverse() const
+	{
+		ValueType const det = this->determinant();
+		if (det == 0)
+			return Affine2{};
+
+		ValueType const inv = ValueType{ 1 } / det;
+		return Affine2{
+				m11 * inv,	-m01 * inv,	(m01 * m12 - m11 * m02) * inv,
+				-m10 * inv,	m00 * inv,	(m10 * m02 - m00 * m12) * inv
+			};
+	}
+
+	/// <summary>
+	/// Transforms the point (applies translation).
+	/// </summary>
+	/// <param name="point_">The point.</param>
+	/// <returns>Transformed point.</returns>
+	constexpr Vector2<ValueType> transformPoint(Vector2<ValueType> const & point_) const {
+		return Vector2<ValueType>{ m00 * point_.x + m01 * point_.y + m02, m10 * point_.x + m11 * point_.y + m12 };
+	}
+
+	/// <summary>
+	/// Transforms the direction vector (ignores translation).
+	/// </summary>
+	/// <param name="vector_">The vector.</param>
+	/// <returns>Transformed vector.</returns>
+	constexpr Vector2<ValueType> transformVector(Vector2<ValueType> const & vector_) const {
+		return Vector2<ValueType>{ m00 * vector_.x + m01 * vector_.y, m10 * vector_.x + m11 * vector_.y };
+	}
+
+	/// <summary>
+	/// Combines two matrices. Resulting matrix applies `rhs_` first.
+	/// </summary>
+	/// <param name="rhs_">The right hand side matrix.</param>
+	/// <returns>Combined matrix.</returns>
+	constexpr Affine2 operator * (Affine2 const & rhs_) const
+	{
+		return Affine2{
+				m00 * rhs_.m00 + m01 * rhs_.m10,	m00 * rhs_.m01 + m01 * rhs_.m11,	m00 * rhs_.m02 + m01 * rhs_.m12 + m02,
+				m10 * rhs_.m00 + m11 * rhs_.m10,	m10 * rhs_.m01 + m11 * rhs_.m11,	m10 * rhs_.m02 + m11 * rhs_.m12 + m12
+			};
+	}
+
+	/// <summary>
+	/// Combines two matrices. Resulting matrix applies `rhs_` first.
+	/// </summary>
+	/// <param name="rhs_">The right hand side matrix.</param>
+	/// <returns>Reference to self.</returns>
+	constexpr Affine2& operator *= (Affine2 const & rhs_) {
+		return *this = *this * rhs_;
+	}
+
+	/// <summary>
+	/// Checks whether two matrices are equal.
+	/// </summary>
+	constexpr bool operator == (Affine2 const & rhs_) const
+	{
+		return	m00 == rhs_.m00 && m01 == rhs_.m01 && m02 == rhs_.m02 &&
+				m10 == rhs_.m10 && m11 == rhs_.m11 && m12 == rhs_.m12;
+	}
+
+	/// <summary>
+	/// Checks whether two matrices are not equal.
+	/// </summary>
+	constexpr bool operator != (Affine2 const & rhs_) const {
+		return !(*this == rhs_);
+	}
+};
+
+// Aliases:
+using Affine2f = Affine2<float>;
+using Affine2d = Affine2<double>;
+
+}
@@ -0,0 +1,87 @@
+// File description:
+// Implements standard-compatible allocator returning memory aligned for SIMD loads.
+#pragma once
+
+// Precompiled header:
+#include SFMLUI_PCH
+
+#include <new>
+
+namespace math
+{
+
+/// <summary>
+/// Allocator returning memory aligned to the specified boundary (AVX register width by default).
+/// </summary>
+template <typename TValueType, std::size_t TAlignment = 32>
+class AlignedAllocator
+{
+public:
+	using value_type = TValueType;
+
+	static_assert(TAlignment >= alignof(TValueType) && (TAlignment & (TAlignment - 1)) == 0, "Alignment must be a power of two, not lower than natural alignment of the type.");
+
+	// Constants:
+	constexpr static std::size_t Alignment = TAlignment;
+
+	// Nested types:
+	template <typename TOtherType>
+	struct rebind
+	{
+		using other = AlignedAllocator<TOtherType, TAlignment>;
+	};
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="AlignedAllocator"/> class.
+	/// </summary>
+	constexpr AlignedAllocator() noexcept = default;
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="AlignedAllocator"/> class from allocator of other type.
+	/// </summary>
+	template <typename TOtherType>
+	constexpr AlignedAllocator(AlignedAllocator<TOtherType, TAlignment> const &) noexcept
+	{
+	}
+
+	/// <summary>
+	/// Allocates aligned memory for the specified number of elements.
+	/// </summary>
+	/// <param name="count_">Number of elements.</param>
+	/// <returns>Pointer to allocated memory.</returns>
+	TValueType* allocate(std::size_t const count_)
+	{
+		if (count_ > std::numeric_limits<std::size_t>::max() / sizeof(TValueType))
+			throw std::bad_array_new_length{};
+
+		return static_cast<TValueType*>(::operator new(count_ * sizeof(TValueType), std::align_val_t{ TAlignment }));
+	}
+
+	/// <summary>
+	/// Releases memory allocated with <see cref="allocate"/>.
+	/// </summary>
+	/// <param name="pointer_">The pointer.</param>
+	/// <param name="count_">Number of elements.</param>
+	void deallocate(TValueType * pointer_, std::size_t const count_) noexcept
+	{
+		::operator delete(pointer_, count_ * sizeof(TValueType), std::align_val_t{ TAlignment });
+	}
+
+	/// <summary>
+	/// Checks whether two allocators are equal (always true, allocator is stateless).
+	/// </summary>
+	template <typename TOtherType>
+	constexpr bool operator == (AlignedAllocator<TOtherType, TAlignment> const &) const noexcept {
+		return true;
+	}
+
+	/// <summary>
+	/// Checks whether two allocators are not equal (always false, allocator is stateless).
+	/// </summary>
+	template <typename TOtherType>
+	constexpr bool operator != (AlignedAllocator<TOtherType, TAlignment> const &) const noexcept {
+		return false;
+	}
+};
+
+}
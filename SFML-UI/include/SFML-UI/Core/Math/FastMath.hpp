@@ -0,0 +1,253 @@
+// File description:
+// Implements fast approximations of elementary functions and math policies selecting between them and the standard library.
+#pragma once
+
+// Precompiled header:
+#include SFMLUI_PCH
+
+// Custom includes:
+#include "Helper.hpp"
+
+#include <bit>
+
+namespace math
+{
+
+namespace fast_math
+{
+
+namespace coefficients
+{
+
+constexpr float Pi			= constants::Pi<float>;
+constexpr float HalfPi		= Pi / 2.f;
+
+// atan(a) for a in [0, 1], max error ~2e-6 rad:
+constexpr float Atan0 = 0.99997726f;
+constexpr float Atan1 = -0.33262347f;
+constexpr float Atan2 = 0.19354346f;
+constexpr float Atan3 = -0.11643287f;
+constexpr float Atan4 = 0.05265332f;
+constexpr float Atan5 = -0.01172120f;
+
+// sin(r) and cos(r) for r in [-Pi/4, Pi/4] (Cephes minimax):
+constexpr float Sin1 = -1.6666654611e-1f;
+constexpr float Sin2 = 8.3321608736e-3f;
+constexpr float Sin3 = -1.9515295891e-4f;
+constexpr float Cos1 = 4.166664568298827e-2f;
+constexpr float Cos2 = -1.388731625493765e-3f;
+constexpr float Cos3 = 2.443315711809948e-5f;
+
+// Pi/2 split in three parts for accurate range reduction (Cephes).
+// The first two have few significant bits, so multiplying them by the quadrant index is exact:
+constexpr float HalfPi1 = 1.5703125f;
+constexpr float HalfPi2 = 4.837512969970703125e-4f;
+constexpr float HalfPi3 = 7.54978995489188216e-8f;
+
+} // namespace coefficients
+
+// Scalar versions of the polynomials used by SIMD kernels (see transform_algorithm::decompose),
+// so both paths have the same error bounds.
+
+/// <summary>
+/// Computes approximate reciprocal square root (bit-level initial guess refined with two Newton-Raphson steps).
+/// </summary>
+/// <remarks>
+/// <para>Max relative error: 5e-6. Input must be positive, zero gives huge finite value.</para>
+/// </remarks>
+/// <param name="value_">The value.</param>
+/// <returns>Approximate 1 / sqrt(value_).</returns>
+inline float inverseSqrt(float const value_)
+{
+	float const half = value_ * 0.5f;
+
+	float result = std::bit_cast<float>(0x5F375A86u - (std::bit_cast<std::uint32_t>(value_) >> 1));
+	result *= 1.5f - half * result * result;
+	result *= 1.5f - half * result * result;
+	return result;
+}
+
+/// <summary>
+/// Computes approximate square root as value_ * inverseSqrt(value_).
+/// </summary>
+/// <remarks>
+/// <para>Max relative error: 5e-6. Zero gives zero.</para>
+/// </remarks>
+/// <param name="value_">The value (non-negative).</param>
+/// <returns>Approximate square root.</returns>
+inline float sqrt(float const value_) {
+	return value_ * inverseSqrt(value_);
+}
+
+/// <summary>
+/// Computes approximate sine and cosine at once.
+/// </summary>
+/// <remarks>
+/// <para>Max absolute error: 1e-7 for |radians_| below 1e4, accuracy degrades for larger angles.</para>
+/// </remarks>
+/// <param name="radians_">The angle (in radians).</param>
+/// <param name="sine_">The output sine.</param>
+/// <param name="cosine_">The output cosine.</param>
+inline void sinCos(float const radians_, float & sine_, float & cosine_)
+{
+	using namespace coefficients;
+
+	int const quadrant		= static_cast<int>(radians_ * (1.f / HalfPi) + std::copysign(0.5f, radians_));
+	float const quadrantF	= static_cast<float>(quadrant);
+
+	float const r	= ((radians_ - quadrantF * HalfPi1) - quadrantF * HalfPi2) - quadrantF * HalfPi3;
+	float const r2	= r * r;
+
+	float const sinR = ((Sin3 * r2 + Sin2) * r2 + Sin1) * r2 * r + r;
+	float const cosR = (1.f - r2 * 0.5f) + ((Cos3 * r2 + Cos2) * r2 + Cos1) * r2 * r2;
+
+	// Odd quadrants swap sine and cosine, quadrants 2 and 3 negate sine, 1 and 2 negate cosine.
+	// Both the swap and the signs use bit operations - a conditional may compile to a branch, mispredicted for random angles.
+	std::uint32_t const swapMask	= 0u - (static_cast<std::uint32_t>(quadrant) & 1u);
+	std::uint32_t const sinSign		= (static_cast<std::uint32_t>(quadrant) & 2u) << 30;
+	std::uint32_t const cosSign		= (static_cast<std::uint32_t>(quadrant + 1) & 2u) << 30;
+
+	std::uint32_t const sinBits		= std::bit_cast<std::uint32_t>(sinR);
+	std::uint32_t const cosBits		= std::bit_cast<std::uint32_t>(cosR);
+	std::uint32_t const swapped		= (sinBits ^ cosBits) & swapMask;
+
+	sine_	= std::bit_cast<float>((sinBits ^ swapped) ^ sinSign);
+	cosine_	= std::bit_cast<float>((cosBits ^ swapped) ^ cosSign);
+}
+
+/// <summary>
+/// Computes approximate sine. See <see cref="sinCos"/>.
+/// </summary>
+/// <param name="radians_">The angle (in radians).</param>
+/// <returns>Approximate sine.</returns>
+inline float sin(float const radians_)
+{
+	float sine, cosine;
+	sinCos(radians_, sine, cosine);
+	return sine;
+}
+
+/// <summary>
+/// Computes approximate cosine. See <see cref="sinCos"/>.
+/// </summary>
+/// <param name="radians_">The angle (in radians).</param>
+/// <returns>Approximate cosine.</returns>
+inline float cos(float const radians_)
+{
+	float sine, cosine;
+	sinCos(radians_, sine, cosine);
+	return cosine;
+}
+
+/// <summary>
+/// Computes approximate arc tangent of y_ / x_, using signs of arguments to determine the quadrant.
+/// </summary>
+/// <remarks>
+/// <para>Max absolute error: 2e-6 rad (1e-4 degree). Signed zeros are handled like std::atan2.</para>
+/// </remarks>
+/// <param name="y_">The y coordinate.</param>
+/// <param name="x_">The x coordinate.</param>
+/// <returns>Approximate angle (in radians), in range [-Pi, Pi].</returns>
+inline float atan2(float const y_, float const x_)
+{
+	using namespace coefficients;
+
+	float const absY	= std::abs(y_);
+	float const absX	= std::abs(x_);
+	float const a		= std::min(absX, absY) / std::max(std::max(absX, absY), std::numeric_limits<float>::min());
+	float const s		= a * a;
+
+	float result = (((((Atan5 * s + Atan4) * s + Atan3) * s + Atan2) * s + Atan1) * s + Atan0) * a;
+	if (absY > absX)
+		result = HalfPi - result;
+	if (std::signbit(x_))
+		result = Pi - result; // Sign bit, not comparison, so atan2(0, -0) gives Pi like std::atan2.
+
+	// Result has the sign of y:
+	return std::copysign(result, y_);
+}
+
+} // namespace fast_math
+
+/// <summary>
+/// Math policy using the standard library functions (usable in constant expressions, see <see cref="math::sqrt"/>).
+/// </summary>
+struct PreciseMath
+{
+	template <typename TType>
+	static constexpr TType sqrt(TType const value_) {
+		return math::sqrt(value_);
+	}
+
+	template <typename TType>
+	static constexpr TType inverseSqrt(TType const value_) {
+		return static_cast<TType>(1 / math::sqrt(value_));
+	}
+
+	template <typename TType>
+	static constexpr TType hypot(TType const x_, TType const y_)
+	{
+		if (std::is_constant_evaluated())
+			return math::sqrt(x_ * x_ + y_ * y_);
+		return static_cast<TType>(std::hypot(x_, y_));
+	}
+
+	template <typename TType>
+	static constexpr void sinCos(TType const radians_, TType & sine_, TType & cosine_)
+	{
+		sine_	= math::sin(radians_);
+		cosine_	= math::cos(radians_);
+	}
+
+	template <typename TType>
+	static constexpr TType atan2(TType const y_, TType const x_) {
+		return math::atan2(y_, x_);
+	}
+};
+
+/// <summary>
+/// Math policy using approximations from <see cref="fast_math"/>, for computations where small error is acceptable (e.g. visuals only).
+/// </summary>
+/// <remarks>
+/// <para>Computes in single precision regardless of the argument type. See <see cref="fast_math"/> for error bounds.</para>
+/// </remarks>
+struct FastMath
+{
+	template <typename TType>
+	static TType sqrt(TType const value_) {
+		return static_cast<TType>(fast_math::sqrt(static_cast<float>(value_)));
+	}
+
+	template <typename TType>
+	static TType inverseSqrt(TType const value_) {
+		return static_cast<TType>(fast_math::inverseSqrt(static_cast<float>(value_)));
+	}
+
+	template <typename TType>
+	static TType hypot(TType const x_, TType const y_)
+	{
+		float const x = static_cast<float>(x_);
+		float const y = static_cast<float>(y_);
+		return static_cast<TType>(fast_math::sqrt(x * x + y * y));
+	}
+
+	template <typename TType>
+	static void sinCos(TType const radians_, TType & sine_, TType & cosine_)
+	{
+		float sine, cosine;
+		fast_math::sinCos(static_cast<float>(radians_), sine, cosine);
+		sine_	= static_cast<TType>(sine);
+		cosine_	= static_cast<TType>(cosine);
+	}
+
+	template <typename TType>
+	static TType atan2(TType const y_, TType const x_) {
+		return static_cast<TType>(fast_math::atan2(static_cast<float>(y_), static_cast<float>(x_)));
+	}
+};
+
+// Tags selecting the policy, e.g. `vector.length(math::Fast)`:
+constexpr PreciseMath	Precise{};
+constexpr FastMath		Fast{};
+
+} // namespace
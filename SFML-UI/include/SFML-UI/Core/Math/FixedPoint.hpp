@@ -0,0 +1,312 @@
+// File description:
+// Implements fixed-point number class, used for deterministic, pixel-snapped computations.
+#pragma once
+
+// Precompiled header:
+#include SFMLUI_PCH
+
+#include <SFML-UI/Core/TypeTraits.hpp>
+
+namespace math
+{
+
+/// <summary>
+/// Implements binary fixed-point number with `_fractionBits` bits of fraction, stored inside `TStorageType` integer.
+/// </summary>
+/// <remarks>
+/// <para>Every operation is performed on integers only, so results are bit-identical on every machine.</para>
+/// <para>Multiplication and division use twice as wide intermediate type, so storage is limited to 32 bits.</para>
+/// </remarks>
+template <typename TStorageType, std::size_t _fractionBits>
+class FixedPoint
+{
+public:
+	using StorageType	= TStorageType;
+	using WideType		= std::conditional_t< (sizeof(StorageType) < 4), std::int32_t, std::int64_t >;
+
+	static_assert(std::is_integral_v<StorageType> && std::is_signed_v<StorageType>, "FixedPoint storage must be a signed integer type.");
+	static_assert(sizeof(StorageType) <= 4, "FixedPoint storage type cannot be wider than 32 bits.");
+	static_assert(_fractionBits > 0 && _fractionBits < sizeof(StorageType) * 8 - 1, "Invalid number of fraction bits.");
+
+	static constexpr std::size_t	FractionBits	= _fractionBits;
+	static constexpr StorageType	RawOne			= static_cast<StorageType>(StorageType{ 1 } << FractionBits);
+
+	StorageType raw;
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="FixedPoint"/> class with zero.
+	/// </summary>
+	constexpr FixedPoint()
+		: raw{ 0 }
+	{
+	}
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="FixedPoint"/> class from arithmetic value.
+	/// </summary>
+	/// <param name="value_">The value (rounded to the nearest representable value).</param>
+	template <typename TScalarType,
+		typename = std::enable_if_t< type_traits::isMathScalarV<TScalarType> > >
+	constexpr FixedPoint(TScalarType const value_)
+		: raw{ FixedPoint::rawFromScalar(value_) }
+	{
+	}
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="FixedPoint"/> class from fixed point of different precision.
+	/// </summary>
+	/// <param name="rhs_">The other fixed point value.</param>
+	template <typename TStorageType2nd, std::size_t _fractionBits2nd>
+	constexpr explicit FixedPoint(FixedPoint<TStorageType2nd, _fractionBits2nd> const & rhs_)
+		: raw{ 0 }
+	{
+		if constexpr(_fractionBits2nd > FractionBits)
+			raw = static_cast<StorageType>(FixedPoint::roundedShift(static_cast<WideType>(rhs_.raw), _fractionBits2nd - FractionBits));
+		else
+			raw = static_cast<StorageType>(static_cast<WideType>(rhs_.raw) * (WideType{ 1 } << (FractionBits - _fractionBits2nd)));
+	}
+
+	/// <summary>
+	/// Creates fixed point value from its raw representation.
+	/// </summary>
+	/// <param name="raw_">The raw value.</param>
+	/// <returns>Fixed point value with specified raw representation.</returns>
+	constexpr static FixedPoint fromRaw(StorageType const raw_)
+	{
+		FixedPoint result;
+		result.raw = raw_;
+		return result;
+	}
+
+	/// <summary>
+	/// Returns maximal representable value.
+	/// </summary>
+	/// <returns>Maximal representable value.</returns>
+	constexpr static FixedPoint max()
+	{
+		return FixedPoint::fromRaw(std::numeric_limits<StorageType>::max());
+	}
+
+	/// <summary>
+	/// Returns lowest representable value.
+	/// </summary>
+	/// <returns>Lowest representable value.</returns>
+	constexpr static FixedPoint lowest()
+	{
+		return FixedPoint::fromRaw(std::numeric_limits<StorageType>::lowest());
+	}
+
+	/// <summary>
+	/// Returns the smallest positive value (one unit in the last place).
+	/// </summary>
+	/// <returns>The smallest positive value.</returns>
+	constexpr static FixedPoint epsilon()
+	{
+		return FixedPoint::fromRaw(1);
+	}
+
+	/// <summary>
+	/// Converts value to arithmetic type.
+	/// </summary>
+	/// <returns>Value converted to `TScalarType`.</returns>
+	template <typename TScalarType,
+		typename = std::enable_if_t< type_traits::isMathScalarV<TScalarType> > >
+	constexpr TScalarType as() const
+	{
+		if constexpr(std::is_floating_point_v<TScalarType>)
+			return static_cast<TScalarType>(raw) / static_cast<TScalarType>(RawOne);
+		else // Integers are truncated towards negative infinity, the same way pixels are snapped.
+			return static_cast<TScalarType>(raw >> FractionBits);
+	}
+
+	/// <summary>
+	/// Converts value to arithmetic type.
+	/// </summary>
+	template <typename TScalarType,
+		typename = std::enable_if_t< type_traits::isMathScalarV<TScalarType> > >
+	constexpr explicit operator TScalarType() const
+	{
+		return this->as<TScalarType>();
+	}
+
+	/// <summary>
+	/// Rounds value to the nearest integer.
+	/// </summary>
+	/// <returns>Rounded value.</returns>
+	constexpr FixedPoint round() const
+	{
+		return FixedPoint::fromRaw(static_cast<StorageType>( (static_cast<WideType>(raw) + RawOne / 2) & ~static_cast<WideType>(RawOne - 1) ));
+	}
+
+	/// <summary>
+	/// Returns the largest integer value not greater than this value.
+	/// </summary>
+	/// <returns>Floored value.</returns>
+	constexpr FixedPoint floor() const
+	{
+		return FixedPoint::fromRaw(static_cast<StorageType>( raw & ~static_cast<StorageType>(RawOne - 1) ));
+	}
+
+	/// <summary>
+	/// Multiplies value by compile-time ratio `_numerator` / `_denominator`, rounding to the nearest value.
+	/// </summary>
+	/// <returns>Scaled value.</returns>
+	/// <remarks>
+	/// <para>Ratio is reduced at compile time, so unit ratios become a single multiply or divide by constant.</para>
+	/// </remarks>
+	template <std::intmax_t _numerator, std::intmax_t _denominator>
+	constexpr FixedPoint scaled() const
+	{
+		using ReducedRatio = std::ratio<_numerator, _denominator>;
+
+		if constexpr(ReducedRatio::num == 1 && ReducedRatio::den == 1)
+			return *this;
+		else if constexpr(ReducedRatio::den == 1)
+			return FixedPoint::fromRaw(static_cast<StorageType>(static_cast<std::int64_t>(raw) * ReducedRatio::num));
+		else
+		{
+			std::int64_t const scaledRaw	= static_cast<std::int64_t>(raw) * ReducedRatio::num;
+			std::int64_t const halfDen		= ReducedRatio::den / 2;
+			return FixedPoint::fromRaw(static_cast<StorageType>(
+					(scaledRaw >= 0 ? scaledRaw + halfDen : scaledRaw - halfDen) / ReducedRatio::den
+				));
+		}
+	}
+
+	//////////////////////////////////////
+	// Operators:
+	//////////////////////////////////////
+
+	/// <summary>
+	/// Negates value.
+	/// </summary>
+	/// <returns>Negated value.</returns>
+	constexpr FixedPoint operator - () const {
+		return FixedPoint::fromRaw(static_cast<StorageType>(-raw));
+	}
+
+	constexpr FixedPoint& operator += (FixedPoint const & rhs_) { raw += rhs_.raw; return *this; }
+	constexpr FixedPoint& operator -= (FixedPoint const & rhs_) { raw -= rhs_.raw; return *this; }
+	constexpr FixedPoint& operator *= (FixedPoint const & rhs_) { return *this = *this * rhs_; }
+	constexpr FixedPoint& operator /= (FixedPoint const & rhs_) { return *this = *this / rhs_; }
+
+	/// <summary>
+	/// Adds two fixed point values.
+	/// </summary>
+	friend constexpr FixedPoint operator + (FixedPoint const & lhs_, FixedPoint const & rhs_)
+	{
+		return FixedPoint::fromRaw(static_cast<StorageType>(lhs_.raw + rhs_.raw));
+	}
+
+	/// <summary>
+	/// Subtracts rhs_ fixed point value from lhs_.
+	/// </summary>
+	friend constexpr FixedPoint operator - (FixedPoint const & lhs_, FixedPoint const & rhs_)
+	{
+		return FixedPoint::fromRaw(static_cast<StorageType>(lhs_.raw - rhs_.raw));
+	}
+
+	/// <summary>
+	/// Multiplies two fixed point values, rounding to the nearest value.
+	/// </summary>
+	friend constexpr FixedPoint operator * (FixedPoint const & lhs_, FixedPoint const & rhs_)
+	{
+		return FixedPoint::fromRaw(static_cast<StorageType>(
+				FixedPoint::roundedShift(static_cast<WideType>(lhs_.raw) * rhs_.raw, FractionBits)
+			));
+	}
+
+	/// <summary>
+	/// Divides lhs_ fixed point value by rhs_ (truncates towards zero).
+	/// </summary>
+	friend constexpr FixedPoint operator / (FixedPoint const & lhs_, FixedPoint const & rhs_)
+	{
+		return FixedPoint::fromRaw(static_cast<StorageType>(
+				(static_cast<WideType>(lhs_.raw) * (WideType{ 1 } << FractionBits)) / rhs_.raw
+			));
+	}
+
+	/// <summary>
+	/// Multiplies fixed point value by an integer (exact).
+	/// </summary>
+	template <typename TIntegerType,
+		typename = std::enable_if_t< std::is_integral_v<TIntegerType> && !std::is_same_v<TIntegerType, bool> > >
+	friend constexpr FixedPoint operator * (FixedPoint const & lhs_, TIntegerType const rhs_)
+	{
+		return FixedPoint::fromRaw(static_cast<StorageType>(lhs_.raw * rhs_));
+	}
+
+	/// <summary>
+	/// Divides fixed point value by an integer (truncates towards zero).
+	/// </summary>
+	template <typename TIntegerType,
+		typename = std::enable_if_t< std::is_integral_v<TIntegerType> && !std::is_same_v<TIntegerType, bool> > >
+	friend constexpr FixedPoint operator / (FixedPoint const & lhs_, TIntegerType const rhs_)
+	{
+		return FixedPoint::fromRaw(static_cast<StorageType>(lhs_.raw / rhs_));
+	}
+
+	friend constexpr bool operator == (FixedPoint const & lhs_, FixedPoint const & rhs_) { return lhs_.raw == rhs_.raw; }
+	friend constexpr bool operator != (FixedPoint const & lhs_, FixedPoint const & rhs_) { return lhs_.raw != rhs_.raw; }
+	friend constexpr bool operator <  (FixedPoint const & lhs_, FixedPoint const & rhs_) { return lhs_.raw < rhs_.raw; }
+	friend constexpr bool operator <= (FixedPoint const & lhs_, FixedPoint const & rhs_) { return lhs_.raw <= rhs_.raw; }
+	friend constexpr bool operator >  (FixedPoint const & lhs_, FixedPoint const & rhs_) { return lhs_.raw > rhs_.raw; }
+	friend constexpr bool operator >= (FixedPoint const & lhs_, FixedPoint const & rhs_) { return lhs_.raw >= rhs_.raw; }
+
+private:
+	/// <summary>
+	/// Converts arithmetic value to raw representation.
+	/// </summary>
+	/// <param name="value_">The value.</param>
+	/// <returns>Raw representation, rounded to nearest.</returns>
+	template <typename TScalarType>
+	constexpr static StorageType rawFromScalar(TScalarType const value_)
+	{
+		if constexpr(std::is_floating_point_v<TScalarType>)
+		{
+			TScalarType const scaled = value_ * static_cast<TScalarType>(RawOne);
+			return static_cast<StorageType>(scaled >= 0 ? scaled + TScalarType(0.5) : scaled - TScalarType(0.5));
+		}
+		else
+			return static_cast<StorageType>(static_cast<WideType>(value_) * RawOne);
+	}
+
+	/// <summary>
+	/// Shifts value right by `bits_`, rounding half away from zero.
+	/// </summary>
+	constexpr static WideType roundedShift(WideType const value_, std::size_t const bits_)
+	{
+		WideType const half = WideType{ 1 } << (bits_ - 1);
+		return value_ >= 0
+			? (value_ + half) >> bits_
+			: -((-value_ + half) >> bits_);
+	}
+};
+
+// 26.6 fixed point number (FreeType compatible, 1/64 of a pixel precision).
+using Fixed26_6		= FixedPoint<std::int32_t, 6>;
+// 16.16 fixed point number (1/65536 precision, range of +/- 32768).
+using Fixed16_16	= FixedPoint<std::int32_t, 16>;
+
+} // namespace math
+
+namespace std
+{
+
+template <typename TStorageType, std::size_t _fractionBits>
+class numeric_limits< math::FixedPoint<TStorageType, _fractionBits> >
+{
+	using FixedType = math::FixedPoint<TStorageType, _fractionBits>;
+public:
+	static constexpr bool is_specialized	= true;
+	static constexpr bool is_signed			= true;
+	static constexpr bool is_integer		= false;
+	static constexpr bool is_exact			= true;
+
+	static constexpr FixedType min()		{ return FixedType::lowest(); }
+	static constexpr FixedType max()		{ return FixedType::max(); }
+	static constexpr FixedType lowest()		{ return FixedType::lowest(); }
+	static constexpr FixedType epsilon()	{ return FixedType::epsilon(); }
+};
+
+} // namespace std
@@ -41,7 +41,7 @@ constexpr TType VeryHighTolerance	= static_cast<TType>(0.001);
 /// <param name="lower_">The value that will be lower one of the two specified.</param>
 /// <param name="higher_">The value that will be higher one of the two specified..</param>
 template <typename TType>
-void minMaxRef(TType & lower_, TType & higher_);
+constexpr void minMaxRef(TType & lower_, TType & higher_);
 
 /// <summary>
 /// Checks whether `a_` is nearly equal `b_`, using given equality tolerance.
@@ -53,7 +53,7 @@ void minMaxRef(TType & lower_, TType & higher_);
 ///		<c>true</c> is `a_` is nearly equal `b_`; otherwise, <c>false</c>.
 /// </return>
 template <typename TType>
-bool nearlyEqual(TType const & a_, TType const & b_, TType const & equalityTolerance_);
+constexpr bool nearlyEqual(TType const & a_, TType const & b_, TType const & equalityTolerance_);
 
 /// <summary>
 /// Clamps `current_` value between `lowerBoundary_` and `upperBoundary_`. Makes sure that `lowerBoundary_` is <= `upperBoundary_`.
@@ -63,7 +63,7 @@ bool nearlyEqual(TType const & a_, TType const & b_, TType const & equalityToler
 /// <param name="upperBoundary_">The upper boundary.</param>
 /// <returns>Clamped value.</returns>
 template <typename TType>
-TType clampChecked(TType const & current_, TType const & lowerBoundary_, TType const & upperBoundary_);
+constexpr TType clampChecked(TType const & current_, TType const & lowerBoundary_, TType const & upperBoundary_);
 
 /// <summary>
 /// Converts degrees to radians.
@@ -71,7 +71,7 @@ TType clampChecked(TType const & current_, TType const & lowerBoundary_, TType c
 /// <param name="degrees_">The number of degrees.</param>
 /// <returns>Equivalent angle to `degrees_` but in radians.</returns>
 template <typename TType>
-TType convertToRadians(TType const degrees_);
+constexpr TType convertToRadians(TType const degrees_);
 
 /// <summary>
 /// Converts radians to degrees.
@@ -79,7 +79,52 @@ TType convertToRadians(TType const degrees_);
 /// <param name="radians_">The number of radians.</param>
 /// <returns>Equivalent angle to `radians_` but in degrees.</returns>
 template <typename TType>
-TType convertToDegrees(TType const radians_);
+constexpr TType convertToDegrees(TType const radians_);
+
+// Functions below are usable in constant expressions (e.g. to build lookup tables at compile time).
+// When evaluated at compile time they use series expansions computed in long double;
+// at run time they forward to the standard library.
+
+/// <summary>
+/// Computes absolute value.
+/// </summary>
+/// <param name="value_">The value.</param>
+/// <returns>Absolute value.</returns>
+template <typename TType>
+constexpr TType abs(TType const value_);
+
+/// <summary>
+/// Computes square root. Compile time result is within 1 ulp of std::sqrt.
+/// </summary>
+/// <param name="value_">The value.</param>
+/// <returns>Square root of the value (NaN for negative values).</returns>
+template <typename TType>
+constexpr TType sqrt(TType const value_);
+
+/// <summary>
+/// Computes sine. Compile time result has absolute error below 1e-12 for arguments below 1e5.
+/// </summary>
+/// <param name="radians_">The angle (in radians).</param>
+/// <returns>Sine of the angle.</returns>
+template <typename TType>
+constexpr TType sin(TType const radians_);
+
+/// <summary>
+/// Computes cosine. Compile time result has absolute error below 1e-12 for arguments below 1e5.
+/// </summary>
+/// <param name="radians_">The angle (in radians).</param>
+/// <returns>Cosine of the angle.</returns>
+template <typename TType>
+constexpr TType cos(TType const radians_);
+
+/// <summary>
+/// Computes arc tangent of y_ / x_, using signs of arguments to determine the quadrant. Compile time result is within 1 ulp of std::atan2.
+/// </summary>
+/// <param name="y_">The y coordinate.</param>
+/// <param name="x_">The x coordinate.</param>
+/// <returns>The angle (in radians), in range [-Pi, Pi].</returns>
+template <typename TType>
+constexpr TType atan2(TType const y_, TType const x_);
 
 } // namespace
 
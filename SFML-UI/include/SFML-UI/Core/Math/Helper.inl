@@ -4,9 +4,101 @@
 namespace math
 {
 
+namespace detail
+{
+
+// Compile time implementations, evaluated in long double:
+
+////////////////////////////////////////////////////////////////////////
+constexpr long double sqrtNewton(long double const value_)
+{
+	// Start above the root, Newton-Raphson then decreases monotonically until it converges:
+	long double result = value_ > 1 ? value_ : 1.0L;
+	while (result * result > value_ * 4)
+		result /= 2;
+
+	while (true)
+	{
+		long double const next = (result + value_ / result) / 2;
+		if (next >= result)
+			return result;
+		result = next;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////
+constexpr long double reduceAngle(long double const radians_)
+{
+	// Reduces to [-Pi, Pi]:
+	long double const fullTurn	= 2 * constants::Pi<long double>;
+	long double const turns		= radians_ / fullTurn;
+	long long const wholeTurns	= static_cast<long long>(turns + (turns < 0 ? -0.5L : 0.5L));
+	return radians_ - static_cast<long double>(wholeTurns) * fullTurn;
+}
+
+////////////////////////////////////////////////////////////////////////
+constexpr long double sinSeries(long double const radians_)
+{
+	long double const x		= reduceAngle(radians_);
+	long double term		= x;
+	long double result		= x;
+	for (int n = 1; n < 40 && term != 0; ++n)
+	{
+		term *= -x * x / static_cast<long double>((2 * n) * (2 * n + 1));
+		result += term;
+	}
+	return result;
+}
+
+////////////////////////////////////////////////////////////////////////
+constexpr long double cosSeries(long double const radians_)
+{
+	long double const x		= reduceAngle(radians_);
+	long double term		= 1;
+	long double result		= 1;
+	for (int n = 1; n < 40 && term != 0; ++n)
+	{
+		term *= -x * x / static_cast<long double>((2 * n - 1) * (2 * n));
+		result += term;
+	}
+	return result;
+}
+
+////////////////////////////////////////////////////////////////////////
+constexpr long double atanSeries(long double const value_)
+{
+	long double const Pi = constants::Pi<long double>;
+
+	// Reduce the argument to |x| <= tan(Pi / 8), where the series converges quickly:
+	bool const negative	= value_ < 0;
+	long double x		= negative ? -value_ : value_;
+	bool const inverted	= x > 1;
+	if (inverted)
+		x = 1 / x;
+	bool const shifted	= x > 0.41421356237309504880L;
+	if (shifted)
+		x = (x - 1) / (x + 1);
+
+	long double power	= x;
+	long double result	= x;
+	for (int n = 1; n < 60 && power != 0; ++n)
+	{
+		power *= -x * x;
+		result += power / static_cast<long double>(2 * n + 1);
+	}
+
+	if (shifted)
+		result += Pi / 4;
+	if (inverted)
+		result = Pi / 2 - result;
+	return negative ? -result : result;
+}
+
+} // namespace detail
+
 ////////////////////////////////////////////////////////////////////////
 template <typename TType>
-inline void minMaxRef(TType & lower_, TType & higher_)
+inline constexpr void minMaxRef(TType & lower_, TType & higher_)
 {
 	if (lower_ > higher_)
 		std::swap(lower_, higher_);
@@ -14,14 +106,14 @@ inline void minMaxRef(TType & lower_, TType & higher_)
 
 ////////////////////////////////////////////////////////////////////////
 template <typename TType>
-inline bool nearlyEqual(TType const & a_, TType const & b_, TType const & equalityTolerance_)
+inline constexpr bool nearlyEqual(TType const & a_, TType const & b_, TType const & equalityTolerance_)
 {
-	return std::abs(a_ - b_) <= equalityTolerance_;
+	return math::abs(a_ - b_) <= equalityTolerance_;
 }
 
 ////////////////////////////////////////////////////////////////////////
 template <typename TType>
-inline TType clampChecked(TType const & current_, TType const & lowerBoundary_, TType const & upperBoundary_)
+inline constexpr TType clampChecked(TType const & current_, TType const & lowerBoundary_, TType const & upperBoundary_)
 {
 	auto[lower, upper] = std::minmax(lowerBoundary_, upperBoundary_);
 	return std::clamp(current_, lower, upper);
@@ -29,16 +121,79 @@ inline TType clampChecked(TType const & current_, TType const & lowerBoundary_,
 
 ////////////////////////////////////////////////////////////////////////
 template <typename TType>
-inline TType convertToRadians(TType const degrees_)
+inline constexpr TType convertToRadians(TType const degrees_)
 {
 	return degrees_ / static_cast<TType>(180) * constants::Pi<TType>;
 }
 
 ////////////////////////////////////////////////////////////////////////
 template <typename TType>
-inline TType convertToDegrees(TType const radians_)
+inline constexpr TType convertToDegrees(TType const radians_)
 {
 	return radians_ * static_cast<TType>(180) / constants::Pi<TType>;
 }
 
+////////////////////////////////////////////////////////////////////////
+template <typename TType>
+inline constexpr TType abs(TType const value_)
+{
+	if (std::is_constant_evaluated())
+		return value_ < TType{ 0 } ? -value_ : value_;
+	return static_cast<TType>(std::abs(value_));
+}
+
+////////////////////////////////////////////////////////////////////////
+template <typename TType>
+inline constexpr TType sqrt(TType const value_)
+{
+	if (std::is_constant_evaluated())
+	{
+		if (value_ != value_ || value_ == TType{ 0 } || value_ == std::numeric_limits<TType>::infinity())
+			return value_;
+		if (value_ < TType{ 0 })
+			return std::numeric_limits<TType>::quiet_NaN();
+		return static_cast<TType>(detail::sqrtNewton(static_cast<long double>(value_)));
+	}
+	return static_cast<TType>(std::sqrt(value_));
+}
+
+////////////////////////////////////////////////////////////////////////
+template <typename TType>
+inline constexpr TType sin(TType const radians_)
+{
+	if (std::is_constant_evaluated())
+		return static_cast<TType>(detail::sinSeries(static_cast<long double>(radians_)));
+	return static_cast<TType>(std::sin(radians_));
+}
+
+////////////////////////////////////////////////////////////////////////
+template <typename TType>
+inline constexpr TType cos(TType const radians_)
+{
+	if (std::is_constant_evaluated())
+		return static_cast<TType>(detail::cosSeries(static_cast<long double>(radians_)));
+	return static_cast<TType>(std::cos(radians_));
+}
+
+////////////////////////////////////////////////////////////////////////
+template <typename TType>
+inline constexpr TType atan2(TType const y_, TType const x_)
+{
+	if (std::is_constant_evaluated())
+	{
+		long double const Pi	= constants::Pi<long double>;
+		long double const y		= static_cast<long double>(y_);
+		long double const x		= static_cast<long double>(x_);
+
+		if (x > 0)
+			return static_cast<TType>(detail::atanSeries(y / x));
+		if (x < 0)
+			return static_cast<TType>(y < 0 ? detail::atanSeries(y / x) - Pi : detail::atanSeries(y / x) + Pi);
+		if (y == 0)
+			return TType{ 0 };
+		return static_cast<TType>(y > 0 ? Pi / 2 : -Pi / 2);
+	}
+	return static_cast<TType>(std::atan2(y_, x_));
+}
+
 } // namespace
\ No newline at end of file
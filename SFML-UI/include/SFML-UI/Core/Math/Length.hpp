@@ -1,16 +1,46 @@
 // File description:
-// Implements basic length class and aliases.
+// Implements basic length class and aliases (floating and fixed point).
 #pragma once
 
 // Precompiled header:
 #include SFMLUI_PCH
 
 #include "Helper.hpp"
+#include "FixedPoint.hpp"
 #include <SFML-UI/Core/TypeTraits.hpp>
 
 namespace math
 {
 
+namespace detail
+{
+
+/// <summary>
+/// Converts length value to `TTargetType`, multiplying it by `TRatioType`.
+/// </summary>
+/// <param name="value_">The value to convert.</param>
+/// <returns>Converted value.</returns>
+/// <remarks>
+/// <para>Fixed point values never go through floating point - ratio is reduced at compile time and applied with integer arithmetic.</para>
+/// </remarks>
+template <typename TTargetType, typename TRatioType, typename TSourceType>
+inline constexpr TTargetType convertLengthValue(TSourceType const & value_)
+{
+	if constexpr(type_traits::isFixedPointV<TTargetType>)
+	{
+		if constexpr(type_traits::isFixedPointV<TSourceType>)
+			return TTargetType{ value_ }.template scaled<TRatioType::num, TRatioType::den>();
+		else
+			return TTargetType{ value_ * TRatioType::num / TRatioType::den };
+	}
+	else if constexpr(type_traits::isFixedPointV<TSourceType>)
+		return value_.template as<TTargetType>() * TRatioType::num / TRatioType::den;
+	else
+		return static_cast<TTargetType>(value_) * TRatioType::num / TRatioType::den;
+}
+
+} // namespace detail
+
 /// <summary>
 /// Provides implementation of base length unit.
 /// </summary>
@@ -22,7 +52,7 @@ public:
 	using ValueType		= TLengthType;
 
 	static_assert(type_traits::isRatioV<RatioType>, "Second template parameter must be a valid std::ratio type.");
-	static_assert(std::is_floating_point_v<ValueType>, "Length can only be represented by floating point values.");
+	static_assert(std::is_floating_point_v<ValueType> || type_traits::isFixedPointV<ValueType>, "Length can only be represented by floating or fixed point values.");
 
 	ValueType value;
 			
@@ -67,9 +97,7 @@ public:
 	/// <param name="rhs_">Other length object.</param>
 	template <typename TLengthType2nd, typename TRatioType2nd>
 	constexpr Length(const Length<TLengthType2nd, TRatioType2nd> &rhs_)
-		: value(rhs_.value
-				* std::ratio_divide<TRatioType2nd, RatioType>::num
-				/ std::ratio_divide<TRatioType2nd, RatioType>::den)
+		: value(detail::convertLengthValue< ValueType, std::ratio_divide<TRatioType2nd, RatioType> >(rhs_.value))
 	{
 	}
 
@@ -80,9 +108,8 @@ public:
 	template <typename TLengthType2nd, typename TRatioType2nd>
 	constexpr Length<ValueType, RatioType>& operator=(const Length<TLengthType2nd, TRatioType2nd> &rhs_)
 	{
-		value = rhs_.value
-			* std::ratio_divide<TRatioType2nd, RatioType>::num
-			/ std::ratio_divide<TRatioType2nd, RatioType>::den;
+		value = detail::convertLengthValue< ValueType, std::ratio_divide<TRatioType2nd, RatioType> >(rhs_.value);
+		return *this;
 	}
 
 	/// <summary>
@@ -91,8 +118,8 @@ public:
 	template <typename TLengthType2nd, typename TRatioType2nd>
 	constexpr explicit operator Length<TLengthType2nd, TRatioType2nd>() const
 	{
-		using div_ratio = std::ratio_divide<TRatioType2nd, RatioType>;
-		return { static_cast<TLengthType2nd>(value) * div_ratio::num / div_ratio::den };
+		using div_ratio = std::ratio_divide<RatioType, TRatioType2nd>;
+		return { detail::convertLengthValue<TLengthType2nd, div_ratio>(value) };
 	}
 
 	/// <summary>
@@ -106,7 +133,7 @@ public:
 	constexpr bool equals(Length<TLengthType2nd, TRatioType2nd> const &rhs_) const
 	{
 		using div_ratio = std::ratio_divide<TRatioType2nd, RatioType>;
-		return value == (static_cast<TLengthType2nd>(rhs_.value) * div_ratio::num / div_ratio::den);
+		return value == detail::convertLengthValue<ValueType, div_ratio>(rhs_.value);
 	}
 
 	/// <summary>
@@ -121,7 +148,13 @@ public:
 	constexpr bool nearlyEqual(Length<TLengthType2nd, TRatioType2nd> const &rhs_, ValueType const tolerance_) const // Internal compiler error :( // = constants::MediumTolerance<ValueType>) const
 	{
 		using div_ratio = std::ratio_divide<TRatioType2nd, RatioType>;
-		return math::nearlyEqual(value, static_cast<ValueType>(static_cast<TLengthType2nd>(rhs_.value) * div_ratio::num / div_ratio::den), tolerance_);
+		if constexpr(type_traits::isFixedPointV<ValueType>)
+		{
+			ValueType const difference = value - detail::convertLengthValue<ValueType, div_ratio>(rhs_.value);
+			return (difference < ValueType{ 0 } ? -difference : difference) <= tolerance_;
+		}
+		else
+			return math::nearlyEqual(value, detail::convertLengthValue<ValueType, div_ratio>(rhs_.value), tolerance_);
 	}
 };
 		
@@ -139,7 +172,7 @@ template <	typename TLengthType1st, typename TRatioType1st,
 inline constexpr Length<TLengthType1st, TRatioType1st> operator+(Length<TLengthType1st, TRatioType1st> const & lhs_, Length<TLengthType2nd, TRatioType2nd> const & rhs_)
 {
 	using div_ratio = std::ratio_divide<TRatioType2nd, TRatioType1st>;
-	return { lhs_.value + (static_cast<TLengthType1st>(rhs_.value) * div_ratio::num / div_ratio::den) };
+	return { lhs_.value + detail::convertLengthValue<TLengthType1st, div_ratio>(rhs_.value) };
 }
 
 /// <summary>
@@ -156,7 +189,7 @@ template <	typename TLengthType1st, typename TRatioType1st,
 inline constexpr Length<TLengthType1st, TRatioType1st> operator-(Length<TLengthType1st, TRatioType1st> const & lhs_, Length<TLengthType2nd, TRatioType2nd> const & rhs_)
 {
 	using div_ratio = std::ratio_divide<TRatioType2nd, TRatioType1st>;
-	return { lhs_.value - (static_cast<TLengthType1st>(rhs_.value) * div_ratio::num / div_ratio::den) };
+	return { lhs_.value - detail::convertLengthValue<TLengthType1st, div_ratio>(rhs_.value) };
 }
 
 /// <summary>
@@ -235,7 +268,11 @@ template <	typename TLengthType1st, typename TRatioType1st,
 			typename TLengthType2nd, typename TRatioType2nd>
 inline constexpr bool operator==(Length<TLengthType1st, TRatioType1st> const & lhs_, Length<TLengthType2nd, TRatioType2nd> const & rhs_)
 {
-	return lhs_.nearlyEqual(rhs_, constants::MediumTolerance<TLengthType1st>);
+	// Fixed point lengths are exact, so they are compared exactly.
+	if constexpr(type_traits::isFixedPointV<TLengthType1st>)
+		return lhs_.equals(rhs_);
+	else
+		return lhs_.nearlyEqual(rhs_, constants::MediumTolerance<TLengthType1st>);
 }
 
 /// <summary>
@@ -250,7 +287,7 @@ template <	typename TLengthType1st, typename TRatioType1st,
 			typename TLengthType2nd, typename TRatioType2nd>
 inline constexpr bool operator!=(Length<TLengthType1st, TRatioType1st> const & lhs_, Length<TLengthType2nd, TRatioType2nd> const & rhs_)
 {
-	return !lhs_.nearlyEqual(rhs_, constants::MediumTolerance<TLengthType1st>);
+	return !(lhs_ == rhs_);
 }
 
 /// <summary>
@@ -266,7 +303,7 @@ template <	typename TLengthType1st, typename TRatioType1st,
 inline constexpr bool operator>(Length<TLengthType1st, TRatioType1st> const & lhs_, Length<TLengthType2nd, TRatioType2nd> const & rhs_)
 {
 	using div_ratio = std::ratio_divide<TRatioType2nd, TRatioType1st>;
-	return lhs_.value > (static_cast<TLengthType1st>(rhs_.value) * div_ratio::num / div_ratio::den);
+	return lhs_.value > detail::convertLengthValue<TLengthType1st, div_ratio>(rhs_.value);
 }
 
 /// <summary>
@@ -282,7 +319,7 @@ template <	typename TLengthType1st, typename TRatioType1st,
 inline constexpr bool operator>=(Length<TLengthType1st, TRatioType1st> const &lhs_, Length<TLengthType2nd, TRatioType2nd> const & rhs_)
 {
 	using div_ratio = std::ratio_divide<TRatioType2nd, TRatioType1st>;
-	return lhs_.value >= (static_cast<TLengthType1st>(rhs_.value) * div_ratio::num / div_ratio::den);
+	return lhs_.value >= detail::convertLengthValue<TLengthType1st, div_ratio>(rhs_.value);
 }
 
 /// <summary>
@@ -330,4 +367,9 @@ using Gigameters	= Length<double, std::giga>;		// 1'000'000'000m
 using Miles			= Length<double, std::ratio_multiply<std::kilo, std::ratio<1609, 1000>>>; // 1609m
 using Yards			= Length<double, std::ratio<9144, 10000>>;		// 0.9144m
 using LightYears	= Length<double, std::ratio<9460730472580800>>;	// 9460730472580800m
+
+// Fixed point lengths (deterministic, integer-only arithmetic):
+using FixedMillimeters	= Length<Fixed16_16, std::milli>;	// 0.001m, range of +/- 32.768m
+using FixedCentimeters	= Length<Fixed16_16, std::centi>;	// 0.01m, range of +/- 327.68m
+using FixedMeters		= Length<Fixed16_16>;				// 1m, range of +/- 32768m
 }
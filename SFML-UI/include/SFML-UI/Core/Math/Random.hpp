@@ -1,32 +1,318 @@
 // File description:
-// Implements easy to use random engine using Mersenne's Twister.
+// Implements easy to use random engine with small-state generators (xoshiro256++, PCG32), thread-local and split into reproducible streams.
 #pragma once
 
 // Precompiled header:
 #include SFMLUI_PCH
 
+#include <optional>
+
 namespace math::random
 {
 
+/// <summary>
+/// SplitMix64 generator, used to expand a single seed into generator state.
+/// </summary>
+/// <param name="state_">The state, advanced by the call.</param>
+/// <returns>Next 64-bit value.</returns>
+constexpr std::uint64_t splitMix64(std::uint64_t & state_)
+{
+	std::uint64_t z = (state_ += 0x9E3779B97F4A7C15ull);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	return z ^ (z >> 31);
+}
+
+/// <summary>
+/// xoshiro256++ generator: 32 bytes of state, period 2^256 - 1, 64-bit output.
+/// </summary>
+/// <remarks>
+/// <para>Satisfies UniformRandomBitGenerator, so it can be used with standard distributions as well.</para>
+/// <para>Streams start from independent states derived from the seed and the stream index (see <see cref="forStream"/>).
+/// With a period of 2^256 - 1, sequences of different streams overlap with negligible probability.</para>
+/// </remarks>
+class Xoshiro256PlusPlus
+{
+public:
+	using result_type = std::uint64_t;
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="Xoshiro256PlusPlus"/> class.
+	/// </summary>
+	/// <param name="seed_">The seed.</param>
+	constexpr explicit Xoshiro256PlusPlus(std::uint64_t const seed_ = 0) {
+		this->seed(seed_);
+	}
+
+	/// <summary>
+	/// Creates generator for specified stream of the seed, in constant time for any stream index.
+	/// </summary>
+	/// <remarks>
+	/// <para>The stream index is scrambled with SplitMix64 and mixed into the seed, which is then expanded as usual.
+	/// Different streams of one seed always get different states.</para>
+	/// </remarks>
+	/// <param name="seed_">The seed.</param>
+	/// <param name="stream_">The stream index.</param>
+	/// <returns>The generator.</returns>
+	static constexpr Xoshiro256PlusPlus forStream(std::uint64_t const seed_, std::uint64_t const stream_)
+	{
+		std::uint64_t streamState = stream_;
+		return Xoshiro256PlusPlus{ seed_ ^ splitMix64(streamState) };
+	}
+
+	/// <summary>
+	/// Reseeds the generator.
+	/// </summary>
+	/// <param name="seed_">The seed.</param>
+	constexpr void seed(std::uint64_t seed_)
+	{
+		for (auto & word : m_state)
+			word = splitMix64(seed_);
+	}
+
+	/// <summary>
+	/// Generates next value.
+	/// </summary>
+	/// <returns>Next 64-bit value.</returns>
+	constexpr result_type operator()()
+	{
+		std::uint64_t const result = rotateLeft(m_state[0] + m_state[3], 23) + m_state[0];
+		std::uint64_t const t = m_state[1] << 17;
+
+		m_state[2] ^= m_state[0];
+		m_state[3] ^= m_state[1];
+		m_state[1] ^= m_state[2];
+		m_state[0] ^= m_state[3];
+		m_state[2] ^= t;
+		m_state[3] = rotateLeft(m_state[3], 45);
+
+		return result;
+	}
+
+	/// <summary>
+	/// Advances the generator by 2^128 steps (256 generator steps), e.g. to split one sequence into non-overlapping parts.
+	/// </summary>
+	constexpr void jump()
+	{
+		constexpr std::uint64_t JumpPolynomial[] = { 0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull, 0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull };
+
+		std::uint64_t jumped[4] = {};
+		for (std::uint64_t const word : JumpPolynomial)
+		{
+			for (int bit = 0; bit < 64; ++bit)
+			{
+				if (word & (std::uint64_t{ 1 } << bit))
+				{
+					for (int i = 0; i < 4; ++i)
+						jumped[i] ^= m_state[i];
+				}
+				(*this)();
+			}
+		}
+		for (int i = 0; i < 4; ++i)
+			m_state[i] = jumped[i];
+	}
+
+	static constexpr result_type min() {
+		return std::numeric_limits<result_type>::min();
+	}
+
+	static constexpr result_type max() {
+		return std::numeric_limits<result_type>::max();
+	}
+private:
+	static constexpr std::uint64_t rotateLeft(std::uint64_t const value_, int const shift_) {
+		return (value_ << shift_) | (value_ >> (64 - shift_));
+	}
+
+	// Members:
+	std::uint64_t m_state[4] = {};
+};
+
+/// <summary>
+/// PCG32 (XSH-RR) generator: 16 bytes of state, period 2^64, 32-bit output, 2^63 independent streams.
+/// </summary>
+/// <remarks>
+/// <para>Satisfies UniformRandomBitGenerator, so it can be used with standard distributions as well.</para>
+/// </remarks>
+class Pcg32
+{
+public:
+	using result_type = std::uint32_t;
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="Pcg32"/> class.
+	/// </summary>
+	/// <param name="seed_">The seed.</param>
+	/// <param name="stream_">The stream index.</param>
+	constexpr explicit Pcg32(std::uint64_t const seed_ = 0, std::uint64_t const stream_ = 0) {
+		this->seed(seed_, stream_);
+	}
+
+	/// <summary>
+	/// Creates generator for specified stream of the seed.
+	/// </summary>
+	/// <param name="seed_">The seed.</param>
+	/// <param name="stream_">The stream index.</param>
+	/// <returns>The generator.</returns>
+	static constexpr Pcg32 forStream(std::uint64_t const seed_, std::uint64_t const stream_) {
+		return Pcg32{ seed_, stream_ };
+	}
+
+	/// <summary>
+	/// Reseeds the generator.
+	/// </summary>
+	/// <param name="seed_">The seed.</param>
+	/// <param name="stream_">The stream index.</param>
+	constexpr void seed(std::uint64_t const seed_, std::uint64_t const stream_ = 0)
+	{
+		// Stream selects the (odd) increment of the underlying linear congruential generator:
+		m_increment	= (stream_ << 1) | 1;
+		m_state		= 0;
+		(*this)();
+		m_state += seed_;
+		(*this)();
+	}
+
+	/// <summary>
+	/// Generates next value.
+	/// </summary>
+	/// <returns>Next 32-bit value.</returns>
+	constexpr result_type operator()()
+	{
+		std::uint64_t const previous = m_state;
+		m_state = previous * 6364136223846793005ull + m_increment;
+
+		auto const xorShifted	= static_cast<std::uint32_t>(((previous >> 18) ^ previous) >> 27);
+		auto const rotation		= static_cast<std::uint32_t>(previous >> 59);
+		return (xorShifted >> rotation) | (xorShifted << ((0u - rotation) & 31));
+	}
+
+	static constexpr result_type min() {
+		return std::numeric_limits<result_type>::min();
+	}
+
+	static constexpr result_type max() {
+		return std::numeric_limits<result_type>::max();
+	}
+private:
+	// Members:
+	std::uint64_t m_state		= 0;
+	std::uint64_t m_increment	= 1;
+};
+
+// Aliases:
+using DefaultEngine = Xoshiro256PlusPlus;
+
+/// <summary>
+/// Sets the seed used by thread-local engines created from now on (see <see cref="threadEngine"/>).
+/// </summary>
+/// <param name="seed_">The seed.</param>
+void setSeed(std::uint64_t const seed_);
+
+/// <summary>
+/// Returns the seed used by thread-local engines.
+/// </summary>
+/// <returns>The seed (random per process unless set with <see cref="setSeed"/>).</returns>
+std::uint64_t getSeed();
+
 namespace detail
 {
 
 /// <summary>
-/// Returns reference to Mersenne Twister random number generator.
+/// Returns next unused stream index, used by threads that did not select the stream explicitly.
 /// </summary>
-/// <returns>Reference to Mersenne Twister random number generator.</returns>
-std::mt19937& getGenerator();
+/// <returns>The stream index.</returns>
+std::uint64_t acquireStreamIndex();
 
 /// <summary>
-/// Returns reference to Mersenne Twister random engine (64 bit).
+/// Returns storage of the engine owned by the calling thread, empty until the engine is first used or seeded.
 /// </summary>
-/// <returns>Reference to Mersenne Twister random engine (64 bit).</returns>
-std::mt19937_64& getGenerator64();
+/// <returns>Reference to the thread-local storage.</returns>
+template <typename TEngine>
+std::optional<TEngine>& threadEngineStorage();
 
 } // namespace detail
 
 /// <summary>
-/// Generates random number of type T.
+/// Returns engine owned by the calling thread. Safe to use from any thread without locking.
+/// </summary>
+/// <remarks>
+/// <para>Engine is created on first use as stream of <see cref="getSeed"/>; stream indices are assigned in order of first use.
+/// Call <see cref="seedThread"/> for results independent of thread scheduling.</para>
+/// </remarks>
+/// <returns>Reference to the thread-local engine.</returns>
+template <typename TEngine = DefaultEngine>
+TEngine& threadEngine();
+
+/// <summary>
+/// Reseeds engine of the calling thread with specified stream of <see cref="getSeed"/>, making its sequence reproducible.
+/// </summary>
+/// <param name="stream_">The stream index (e.g. worker index).</param>
+template <typename TEngine = DefaultEngine>
+void seedThread(std::uint64_t const stream_);
+
+/// <summary>
+/// Reusable uniform distribution of values in closed range [from, to] (integers) or half-open range [from, to) (floating point).
+/// </summary>
+/// <remarks>
+/// <para>Construct once, then call with any engine. Integers use unbiased multiply-shift reduction (Lemire),
+/// floating point values are built from the top 24 (float) or 53 (double) bits.</para>
+/// </remarks>
+template <typename TType>
+class Uniform
+{
+public:
+	using ValueType = TType;
+
+	static_assert(std::is_arithmetic_v<ValueType> && !std::is_same_v<ValueType, bool>, "math::random::Uniform does not support this type.");
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="Uniform"/> class. Bounds can be passed in any order.
+	/// </summary>
+	/// <param name="from_">The first bound.</param>
+	/// <param name="to_">The second bound.</param>
+	constexpr Uniform(ValueType const from_, ValueType const to_);
+
+	/// <summary>
+	/// Generates value with specified engine.
+	/// </summary>
+	/// <param name="engine_">The engine.</param>
+	/// <returns>Random value in range.</returns>
+	template <typename TEngine>
+	constexpr ValueType operator()(TEngine & engine_) const;
+
+	/// <summary>
+	/// Generates value with thread-local default engine.
+	/// </summary>
+	/// <returns>Random value in range.</returns>
+	ValueType operator()() const {
+		return (*this)(threadEngine());
+	}
+
+	/// <summary>
+	/// Returns lower bound of the range.
+	/// </summary>
+	/// <returns>Lower bound.</returns>
+	constexpr ValueType getMin() const {
+		return m_min;
+	}
+
+	/// <summary>
+	/// Returns upper bound of the range.
+	/// </summary>
+	/// <returns>Upper bound.</returns>
+	constexpr ValueType getMax() const {
+		return m_max;
+	}
+private:
+	// Members:
+	ValueType m_min;
+	ValueType m_max;
+};
+
+/// <summary>
+/// Generates random number of type T, using thread-local default engine.
 /// </summary>
 /// <param name="from_">Minimal value.</param>
 /// <param name="to_">Maximal value.</param>
@@ -42,6 +328,7 @@ std::mt19937_64& getGenerator64();
 ///					double,
 ///					long double
 /// </para>
+/// <para>Generating many values from one range is faster with a reused <see cref="Uniform"/> object.</para>
 /// </remarks>
 template <typename TType>
 TType generate(TType const & from_, TType const & to_);
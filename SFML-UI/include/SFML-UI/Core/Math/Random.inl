@@ -4,6 +4,161 @@
 namespace math::random
 {
 
+namespace detail
+{
+
+//////////////////////////////////////////////////////////////////////////////
+template <typename TEngine>
+constexpr std::uint32_t next32(TEngine & engine_)
+{
+	static_assert(TEngine::min() == 0 && (TEngine::max() == 0xFFFF'FFFFu || TEngine::max() == 0xFFFF'FFFF'FFFF'FFFFull), "Engine must produce full 32 or 64-bit values.");
+
+	if constexpr (TEngine::max() == 0xFFFF'FFFFu)
+		return static_cast<std::uint32_t>(engine_());
+	else
+		return static_cast<std::uint32_t>(engine_() >> 32); // Upper bits are the strongest ones.
+}
+
+//////////////////////////////////////////////////////////////////////////////
+template <typename TEngine>
+constexpr std::uint64_t next64(TEngine & engine_)
+{
+	if constexpr (TEngine::max() == 0xFFFF'FFFFu)
+	{
+		std::uint64_t const high = engine_();
+		return (high << 32) | engine_();
+	}
+	else
+		return static_cast<std::uint64_t>(engine_());
+}
+
+//////////////////////////////////////////////////////////////////////////////
+constexpr std::uint64_t multiplyHigh64(std::uint64_t const lhs_, std::uint64_t const rhs_, std::uint64_t & low_)
+{
+	std::uint64_t const lhsLow = lhs_ & 0xFFFF'FFFFu, lhsHigh = lhs_ >> 32;
+	std::uint64_t const rhsLow = rhs_ & 0xFFFF'FFFFu, rhsHigh = rhs_ >> 32;
+
+	std::uint64_t const lowLow		= lhsLow * rhsLow;
+	std::uint64_t const highLow		= lhsHigh * rhsLow;
+	std::uint64_t const lowHigh		= lhsLow * rhsHigh;
+	std::uint64_t const highHigh	= lhsHigh * rhsHigh;
+
+	std::uint64_t const middle = (lowLow >> 32) + (highLow & 0xFFFF'FFFFu) + lowHigh;
+	low_ = (middle << 32) | (lowLow & 0xFFFF'FFFFu);
+	return highHigh + (highLow >> 32) + (middle >> 32);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+template <typename TEngine>
+constexpr std::uint32_t bounded32(TEngine & engine_, std::uint32_t const range_)
+{
+	// Lemire's multiply-shift: maps 32 random bits to [0, range_), rejecting the few values that cause bias.
+	std::uint64_t product = std::uint64_t{ next32(engine_) } * range_;
+	auto low = static_cast<std::uint32_t>(product);
+	if (low < range_)
+	{
+		std::uint32_t const threshold = (0u - range_) % range_;
+		while (low < threshold)
+		{
+			product	= std::uint64_t{ next32(engine_) } * range_;
+			low		= static_cast<std::uint32_t>(product);
+		}
+	}
+	return static_cast<std::uint32_t>(product >> 32);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+template <typename TEngine>
+constexpr std::uint64_t bounded64(TEngine & engine_, std::uint64_t const range_)
+{
+	std::uint64_t low = 0;
+	std::uint64_t high = multiplyHigh64(next64(engine_), range_, low);
+	if (low < range_)
+	{
+		std::uint64_t const threshold = (0ull - range_) % range_;
+		while (low < threshold)
+			high = multiplyHigh64(next64(engine_), range_, low);
+	}
+	return high;
+}
+
+} // namespace detail
+
+//////////////////////////////////////////////////////////////////////////////
+template <typename TEngine>
+inline std::optional<TEngine>& detail::threadEngineStorage()
+{
+	thread_local std::optional<TEngine> engine;
+	return engine;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+template <typename TEngine>
+inline TEngine& threadEngine()
+{
+	auto & engine = detail::threadEngineStorage<TEngine>();
+	if (!engine)
+		engine.emplace(TEngine::forStream(getSeed(), detail::acquireStreamIndex()));
+	return *engine;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+template <typename TEngine>
+inline void seedThread(std::uint64_t const stream_)
+{
+	// Constructed in place, so seeding does not create (and waste a stream index on) the default engine first:
+	detail::threadEngineStorage<TEngine>().emplace(TEngine::forStream(getSeed(), stream_));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+template <typename TType>
+inline constexpr Uniform<TType>::Uniform(ValueType const from_, ValueType const to_)
+	:
+	m_min{ std::min(from_, to_) },
+	m_max{ std::max(from_, to_) }
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+template <typename TType>
+template <typename TEngine>
+inline constexpr TType Uniform<TType>::operator()(TEngine & engine_) const
+{
+	if constexpr (std::is_integral_v<ValueType>)
+	{
+		using UnsignedType = std::make_unsigned_t<ValueType>;
+
+		// Range size minus one, computed in unsigned arithmetic to avoid overflow:
+		auto const span = static_cast<UnsignedType>(static_cast<UnsignedType>(m_max) - static_cast<UnsignedType>(m_min));
+
+		if constexpr (sizeof(ValueType) <= 4)
+		{
+			if (span == std::numeric_limits<std::uint32_t>::max())
+				return static_cast<ValueType>(detail::next32(engine_));
+			return static_cast<ValueType>(static_cast<UnsignedType>(m_min) + detail::bounded32(engine_, static_cast<std::uint32_t>(span) + 1));
+		}
+		else
+		{
+			if (span == std::numeric_limits<std::uint64_t>::max())
+				return static_cast<ValueType>(detail::next64(engine_));
+			return static_cast<ValueType>(static_cast<UnsignedType>(m_min) + detail::bounded64(engine_, static_cast<std::uint64_t>(span) + 1));
+		}
+	}
+	else
+	{
+		ValueType unit;
+		if constexpr (std::is_same_v<ValueType, float>)
+			unit = static_cast<float>(detail::next32(engine_) >> 8) * (1.f / 16'777'216.f);							// 2^-24
+		else
+			unit = static_cast<ValueType>(static_cast<double>(detail::next64(engine_) >> 11) * (1.0 / 9'007'199'254'740'992.0));	// 2^-53
+
+		ValueType const result = m_min + (m_max - m_min) * unit;
+
+		// Rounding can reach the upper bound for very wide ranges, keep the range half-open:
+		return result < m_max || m_min == m_max ? result : std::nextafter(m_max, m_min);
+	}
+}
+
 //////////////////////////////////////////////////////////////////////////////
 template <typename TType>
 inline TType generate(TType const & from_, TType const & to_)
@@ -17,31 +172,10 @@ inline TType generate(TType const & from_, TType const & to_)
 	// Check at compile time if the type is a floating point number.
 	constexpr bool cxIsFloatType = std::is_same_v<TType, float> || std::is_same_v<TType, double> || std::is_same_v< TType, long double>;
 
-	// Check if the type require 64 bit engine or not.
-	constexpr bool cxCanUse32BitEngine = sizeof(TType) <= 4;
-
 	// Assert compilation, when type is not supported.
 	static_assert(cxIsIntegerType || cxIsFloatType, "math::random does not support this type.");
 
-	// Calculate min and max value:
-	auto[minValue, maxValue] = std::minmax(static_cast<TType>(from_), static_cast<TType>(to_));
-
-
-	// For every integer type:
-	if constexpr(cxIsIntegerType)
-	{
-		if constexpr(cxCanUse32BitEngine)
-			return std::uniform_int_distribution<TType>(minValue, maxValue)(detail::getGenerator());
-		else
-			return std::uniform_int_distribution<TType>(minValue, maxValue)(detail::getGenerator64());
-	}
-	else // For every real (floating point) type:
-	{
-		if constexpr(cxCanUse32BitEngine)
-			return std::uniform_real_distribution<TType>(minValue, maxValue)(detail::getGenerator());
-		else
-			return std::uniform_real_distribution<TType>(minValue, maxValue)(detail::getGenerator64());
-	}
+	return Uniform<TType>{ from_, to_ }(threadEngine());
 }
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,74 @@
+// File description:
+// Implements bulk generation of random values and points, producing several values per iteration.
+#pragma once
+
+// Precompiled header:
+#include SFMLUI_PCH
+
+// Custom includes:
+#include "Random.hpp"
+#include "Vector2.hpp"
+
+#include <span>
+
+namespace math::random
+{
+
+// Batch functions below run several independent xoshiro256++ generators side by side (one per SIMD lane).
+// The lane generators are seeded from the calling thread's engine (see threadEngine), so the output
+// is reproducible with seedThread, but differs from the sequence of repeated generate calls.
+// Kernels use the widest instruction set supported by the CPU (see sfui::cpu::getInstructionSet).
+
+/// <summary>
+/// Fills the span with uniformly distributed integers.
+/// </summary>
+/// <param name="values_">The output values.</param>
+/// <param name="distribution_">The distribution.</param>
+void fill(std::span<std::int32_t> values_, Uniform<std::int32_t> const & distribution_);
+
+/// <summary>
+/// Fills the span with uniformly distributed floating point values.
+/// </summary>
+/// <param name="values_">The output values.</param>
+/// <param name="distribution_">The distribution.</param>
+void fill(std::span<float> values_, Uniform<float> const & distribution_);
+
+/// <summary>
+/// Fills the span with points uniformly distributed in axis-aligned rectangle.
+/// </summary>
+/// <param name="points_">The output points.</param>
+/// <param name="min_">The rectangle's minimal corner.</param>
+/// <param name="max_">The rectangle's maximal corner.</param>
+void fillInRectangle(std::span<Vector2f> points_, Vector2f const & min_, Vector2f const & max_);
+
+/// <summary>
+/// Fills the span with points uniformly distributed in disc.
+/// </summary>
+/// <remarks>
+/// <para>Uses fast approximate square root and sine/cosine (see <see cref="math::FastMath"/>).</para>
+/// </remarks>
+/// <param name="points_">The output points.</param>
+/// <param name="center_">The center of the disc.</param>
+/// <param name="radius_">The radius of the disc.</param>
+void fillInDisc(std::span<Vector2f> points_, Vector2f const & center_, float const radius_);
+
+/// <summary>
+/// Fills the span with points uniformly distributed in annulus (ring).
+/// </summary>
+/// <remarks>
+/// <para>Uses fast approximate square root and sine/cosine (see <see cref="math::FastMath"/>).</para>
+/// </remarks>
+/// <param name="points_">The output points.</param>
+/// <param name="center_">The center of the annulus.</param>
+/// <param name="innerRadius_">The inner radius.</param>
+/// <param name="outerRadius_">The outer radius.</param>
+void fillInAnnulus(std::span<Vector2f> points_, Vector2f const & center_, float const innerRadius_, float const outerRadius_);
+
+/// <summary>
+/// Fills the span with points uniformly distributed along polyline (by arc length).
+/// </summary>
+/// <param name="points_">The output points.</param>
+/// <param name="vertices_">The polyline's vertices. Throws std::invalid_argument when empty.</param>
+void fillOnPolyline(std::span<Vector2f> points_, std::span<Vector2f const> vertices_);
+
+} // namespace
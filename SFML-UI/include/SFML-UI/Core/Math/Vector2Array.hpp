@@ -0,0 +1,415 @@
+// File description:
+// Implements structure-of-arrays container of 2D vectors.
+#pragma once
+
+// Precompiled header:
+#include SFMLUI_PCH
+
+// Custom includes:
+#include "AlignedAllocator.hpp"
+#include "Vector2Batch.hpp"
+#include "Vector2.hpp"
+
+namespace math
+{
+
+/// <summary>
+/// Container of 2D vectors storing every component in a separate, aligned array (structure of arrays).
+/// </summary>
+/// <remarks>
+/// <para>Element access returns proxies convertible to and assignable from <see cref="Vector2"/>.</para>
+/// <para>Range algorithms run plain loops over component arrays, so they are vectorized by the compiler
+/// when the passed function is inlinable (floating point reductions in <see cref="reduce"/> need fast math to be vectorized).</para>
+/// </remarks>
+template <typename TVectorType>
+class Vector2Array
+{
+public:
+	// Aliases:
+	using ValueType		= TVectorType;
+	using VectorType	= Vector2<TVectorType>;
+	using StorageType	= std::vector<ValueType, AlignedAllocator<ValueType>>;
+
+	// Nested types:
+
+	/// <summary>
+	/// Proxy referencing the components of a single vector.
+	/// </summary>
+	struct Reference
+	{
+		ValueType& x;
+		ValueType& y;
+
+		/// <summary>
+		/// Assigns values of the vector.
+		/// </summary>
+		/// <param name="vector_">The vector.</param>
+		/// <returns>Reference to self.</returns>
+		constexpr Reference& operator = (VectorType const & vector_)
+		{
+			x = vector_.x;
+			y = vector_.y;
+			return *this;
+		}
+
+		/// <summary>
+		/// Assigns values of the referenced vector (does not rebind the proxy).
+		/// </summary>
+		/// <param name="rhs_">The other proxy.</param>
+		/// <returns>Reference to self.</returns>
+		constexpr Reference& operator = (Reference const & rhs_) {
+			return *this = static_cast<VectorType>(rhs_);
+		}
+
+		/// <summary>
+		/// Adds vector to the referenced one.
+		/// </summary>
+		/// <param name="vector_">The vector.</param>
+		/// <returns>Reference to self.</returns>
+		constexpr Reference& operator += (VectorType const & vector_) {
+			return *this = static_cast<VectorType>(*this) + vector_;
+		}
+
+		/// <summary>
+		/// Subtracts vector from the referenced one.
+		/// </summary>
+		/// <param name="vector_">The vector.</param>
+		/// <returns>Reference to self.</returns>
+		constexpr Reference& operator -= (VectorType const & vector_) {
+			return *this = static_cast<VectorType>(*this) - vector_;
+		}
+
+		/// <summary>
+		/// Multiplies referenced vector by a scalar.
+		/// </summary>
+		/// <param name="scalar_">The scalar.</param>
+		/// <returns>Reference to self.</returns>
+		constexpr Reference& operator *= (ValueType const scalar_) {
+			return *this = static_cast<VectorType>(*this) * scalar_;
+		}
+
+		/// <summary>
+		/// Converts proxy to vector.
+		/// </summary>
+		constexpr operator VectorType() const {
+			return VectorType{ x, y };
+		}
+	};
+
+	/// <summary>
+	/// Read-only proxy referencing the components of a single vector.
+	/// </summary>
+	struct ConstReference
+	{
+		ValueType const& x;
+		ValueType const& y;
+
+		/// <summary>
+		/// Converts proxy to vector.
+		/// </summary>
+		constexpr operator VectorType() const {
+			return VectorType{ x, y };
+		}
+	};
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="Vector2Array"/> class.
+	/// </summary>
+	Vector2Array() = default;
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="Vector2Array"/> class.
+	/// </summary>
+	/// <param name="count_">Number of vectors.</param>
+	/// <param name="value_">Initial value of every vector.</param>
+	explicit Vector2Array(std::size_t const count_, VectorType const & value_ = VectorType{})
+		: m_xs(count_, value_.x), m_ys(count_, value_.y)
+	{
+	}
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="Vector2Array"/> class.
+	/// </summary>
+	/// <param name="vectors_">The vectors.</param>
+	Vector2Array(std::initializer_list<VectorType> vectors_) {
+		this->assign(vectors_.begin(), vectors_.size());
+	}
+
+	/// <summary>
+	/// Replaces content with copy of interleaved vectors.
+	/// </summary>
+	/// <param name="vectors_">The vectors.</param>
+	/// <param name="count_">Number of vectors.</param>
+	void assign(VectorType const * vectors_, std::size_t const count_)
+	{
+		this->resize(count_);
+		for (std::size_t i = 0; i < count_; ++i)
+		{
+			m_xs[i] = vectors_[i].x;
+			m_ys[i] = vectors_[i].y;
+		}
+	}
+
+	/// <summary>
+	/// Copies content to interleaved vectors.
+	/// </summary>
+	/// <param name="vectors_">The output vectors, must have room for <see cref="size"/> vectors.</param>
+	void copyTo(VectorType * vectors_) const
+	{
+		for (std::size_t i = 0; i < this->size(); ++i)
+			vectors_[i] = VectorType{ m_xs[i], m_ys[i] };
+	}
+
+	/// <summary>
+	/// Appends vector at the end.
+	/// </summary>
+	/// <param name="vector_">The vector.</param>
+	void push(VectorType const & vector_)
+	{
+		m_xs.push_back(vector_.x);
+		m_ys.push_back(vector_.y);
+	}
+
+	/// <summary>
+	/// Removes the last vector.
+	/// </summary>
+	void pop()
+	{
+		m_xs.pop_back();
+		m_ys.pop_back();
+	}
+
+	/// <summary>
+	/// Removes vector by moving the last one in its place (does not preserve order).
+	/// </summary>
+	/// <param name="index_">Index of the vector.</param>
+	void swapRemove(std::size_t const index_)
+	{
+		m_xs[index_] = m_xs.back();
+		m_ys[index_] = m_ys.back();
+		this->pop();
+	}
+
+	/// <summary>
+	/// Changes number of vectors.
+	/// </summary>
+	/// <param name="count_">Number of vectors.</param>
+	/// <param name="value_">Value of appended vectors.</param>
+	void resize(std::size_t const count_, VectorType const & value_ = VectorType{})
+	{
+		m_xs.resize(count_, value_.x);
+		m_ys.resize(count_, value_.y);
+	}
+
+	/// <summary>
+	/// Reserves memory for the specified number of vectors.
+	/// </summary>
+	/// <param name="count_">Number of vectors.</param>
+	void reserve(std::size_t const count_)
+	{
+		m_xs.reserve(count_);
+		m_ys.reserve(count_);
+	}
+
+	/// <summary>
+	/// Removes every vector.
+	/// </summary>
+	void clear()
+	{
+		m_xs.clear();
+		m_ys.clear();
+	}
+
+	/// <summary>
+	/// Returns number of vectors.
+	/// </summary>
+	/// <returns>Number of vectors.</returns>
+	std::size_t size() const {
+		return m_xs.size();
+	}
+
+	/// <summary>
+	/// Checks whether container is empty.
+	/// </summary>
+	/// <returns>
+	///		<c>true</c> if container is empty; otherwise, <c>false</c>.
+	/// </returns>
+	bool empty() const {
+		return m_xs.empty();
+	}
+
+	/// <summary>
+	/// Returns proxy to vector at specified index.
+	/// </summary>
+	/// <param name="index_">The index.</param>
+	/// <returns>Proxy to the vector.</returns>
+	Reference operator[](std::size_t const index_) {
+		return Reference{ m_xs[index_], m_ys[index_] };
+	}
+
+	/// <summary>
+	/// Returns read-only proxy to vector at specified index.
+	/// </summary>
+	/// <param name="index_">The index.</param>
+	/// <returns>Read-only proxy to the vector.</returns>
+	ConstReference operator[](std::size_t const index_) const {
+		return ConstReference{ m_xs[index_], m_ys[index_] };
+	}
+
+	/// <summary>
+	/// Returns copy of vector at specified index.
+	/// </summary>
+	/// <param name="index_">The index.</param>
+	/// <returns>The vector.</returns>
+	VectorType get(std::size_t const index_) const {
+		return VectorType{ m_xs[index_], m_ys[index_] };
+	}
+
+	/// <summary>
+	/// Sets vector at specified index.
+	/// </summary>
+	/// <param name="index_">The index.</param>
+	/// <param name="vector_">The vector.</param>
+	void set(std::size_t const index_, VectorType const & vector_)
+	{
+		m_xs[index_] = vector_.x;
+		m_ys[index_] = vector_.y;
+	}
+
+	/// <summary>
+	/// Returns array of x components.
+	/// </summary>
+	/// <returns>Array of x components.</returns>
+	ValueType* xData() {
+		return m_xs.data();
+	}
+
+	/// <summary>
+	/// Returns array of x components.
+	/// </summary>
+	/// <returns>Array of x components.</returns>
+	ValueType const* xData() const {
+		return m_xs.data();
+	}
+
+	/// <summary>
+	/// Returns array of y components.
+	/// </summary>
+	/// <returns>Array of y components.</returns>
+	ValueType* yData() {
+		return m_ys.data();
+	}
+
+	/// <summary>
+	/// Returns array of y components.
+	/// </summary>
+	/// <returns>Array of y components.</returns>
+	ValueType const* yData() const {
+		return m_ys.data();
+	}
+
+	/// <summary>
+	/// Replaces every vector with result of the function.
+	/// </summary>
+	/// <param name="function_">Function taking and returning the vector.</param>
+	template <typename TFunction>
+	void transform(TFunction && function_) {
+		this->transform(*this, std::forward<TFunction>(function_));
+	}
+
+	/// <summary>
+	/// Replaces content with vectors of the source array passed through the function.
+	/// </summary>
+	/// <param name="source_">The source array (may be this array).</param>
+	/// <param name="function_">Function taking and returning the vector.</param>
+	template <typename TFunction>
+	void transform(Vector2Array const & source_, TFunction && function_)
+	{
+		std::size_t const count = source_.size();
+		if (&source_ != this)
+			this->resize(count);
+
+		ValueType const* sourceXs	= source_.m_xs.data();
+		ValueType const* sourceYs	= source_.m_ys.data();
+		ValueType* xs				= m_xs.data();
+		ValueType* ys				= m_ys.data();
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			VectorType const result = function_(VectorType{ sourceXs[i], sourceYs[i] });
+			xs[i] = result.x;
+			ys[i] = result.y;
+		}
+	}
+
+	/// <summary>
+	/// Folds every vector into accumulated value.
+	/// </summary>
+	/// <param name="initial_">The initial value.</param>
+	/// <param name="function_">Function taking accumulated value and the vector, returning new accumulated value.</param>
+	/// <returns>Accumulated value.</returns>
+	template <typename TResult, typename TFunction>
+	TResult reduce(TResult initial_, TFunction && function_) const
+	{
+		ValueType const* xs = m_xs.data();
+		ValueType const* ys = m_ys.data();
+		for (std::size_t i = 0; i < this->size(); ++i)
+			initial_ = function_(std::move(initial_), VectorType{ xs[i], ys[i] });
+		return initial_;
+	}
+
+	/// <summary>
+	/// Computes component-wise lower and upper bounds of every vector.
+	/// </summary>
+	/// <param name="lower_">The output lower bound.</param>
+	/// <param name="upper_">The output upper bound.</param>
+	/// <returns>
+	///		<c>true</c> if container is not empty (bounds were computed); otherwise, <c>false</c>.
+	/// </returns>
+	bool bounds(VectorType & lower_, VectorType & upper_) const
+	{
+		if (this->empty())
+			return false;
+
+		// Each component is a separate min/max reduction over contiguous memory:
+		auto const [lowerX, upperX] = componentBounds(m_xs);
+		auto const [lowerY, upperY] = componentBounds(m_ys);
+		lower_ = VectorType{ lowerX, lowerY };
+		upper_ = VectorType{ upperX, upperY };
+		return true;
+	}
+private:
+
+	/// <summary>
+	/// Computes lower and upper bound of a non-empty component array.
+	/// </summary>
+	/// <param name="values_">The component values.</param>
+	/// <returns>Pair of lower and upper bound.</returns>
+	static std::pair<ValueType, ValueType> componentBounds(StorageType const & values_)
+	{
+		ValueType lower = values_[0];
+		ValueType upper = values_[0];
+
+		// Compilers do not vectorize floating point min/max reductions without fast math, use SIMD kernel instead:
+		if constexpr (std::is_same_v<ValueType, float>)
+			batch::bounds(values_.data(), values_.size(), lower, upper);
+		else
+		{
+			for (std::size_t i = 1; i < values_.size(); ++i)
+			{
+				lower = values_[i] < lower ? values_[i] : lower;
+				upper = values_[i] > upper ? values_[i] : upper;
+			}
+		}
+		return { lower, upper };
+	}
+
+	// Members:
+	StorageType m_xs;
+	StorageType m_ys;
+};
+
+// Aliases:
+using Vector2fArray = Vector2Array<float>;
+using Vector2dArray = Vector2Array<double>;
+
+}
@@ -0,0 +1,92 @@
+// File description:
+// Implements batch operations on contiguous arrays of 2D vectors, vectorized with runtime instruction set dispatch.
+#pragma once
+
+// Precompiled header:
+#include SFMLUI_PCH
+
+// Custom includes:
+#include "Affine2.hpp"
+#include "Vector2.hpp"
+
+namespace math
+{
+
+namespace batch
+{
+
+// Every function below picks the widest instruction set supported by the CPU (see sfui::cpu::getInstructionSet).
+// Kernels use only exact operations (no fused multiply-add, no reciprocal approximations),
+// so results are bit-identical to the scalar math::Vector2 operations.
+// Output arrays may be the same as input arrays (in-place operation), but must not partially overlap them.
+
+/// <summary>
+/// Adds two arrays of vectors: result_[i] = lhs_[i] + rhs_[i].
+/// </summary>
+/// <param name="lhs_">The lhs vectors.</param>
+/// <param name="rhs_">The rhs vectors.</param>
+/// <param name="result_">The output vectors.</param>
+/// <param name="count_">Number of vectors.</param>
+void add(Vector2f const * lhs_, Vector2f const * rhs_, Vector2f * result_, std::size_t const count_);
+
+/// <summary>
+/// Multiplies array of vectors by a scalar: result_[i] = vectors_[i] * factor_.
+/// </summary>
+/// <param name="vectors_">The vectors.</param>
+/// <param name="factor_">The scale factor.</param>
+/// <param name="result_">The output vectors.</param>
+/// <param name="count_">Number of vectors.</param>
+void scale(Vector2f const * vectors_, float const factor_, Vector2f * result_, std::size_t const count_);
+
+/// <summary>
+/// Transforms array of points by affine matrix: result_[i] = matrix_.transformPoint(points_[i]).
+/// </summary>
+/// <param name="matrix_">The matrix.</param>
+/// <param name="points_">The points.</param>
+/// <param name="result_">The output points.</param>
+/// <param name="count_">Number of points.</param>
+void transform(Affine2f const & matrix_, Vector2f const * points_, Vector2f * result_, std::size_t const count_);
+
+/// <summary>
+/// Normalizes array of vectors: result_[i] = vectors_[i].normalize(). Zero vectors stay zero.
+/// </summary>
+/// <param name="vectors_">The vectors.</param>
+/// <param name="result_">The output vectors.</param>
+/// <param name="count_">Number of vectors.</param>
+void normalize(Vector2f const * vectors_, Vector2f * result_, std::size_t const count_);
+
+/// <summary>
+/// Computes lengths of array of vectors: result_[i] = vectors_[i].length().
+/// </summary>
+/// <param name="vectors_">The vectors.</param>
+/// <param name="result_">The output lengths.</param>
+/// <param name="count_">Number of vectors.</param>
+void length(Vector2f const * vectors_, float * result_, std::size_t const count_);
+
+/// <summary>
+/// Computes component-wise lower and upper bounds of array of vectors.
+/// </summary>
+/// <param name="vectors_">The vectors.</param>
+/// <param name="count_">Number of vectors.</param>
+/// <param name="lower_">The output lower bound.</param>
+/// <param name="upper_">The output upper bound.</param>
+/// <returns>
+///		<c>true</c> if array is not empty (bounds were computed); otherwise, <c>false</c>.
+/// </returns>
+bool bounds(Vector2f const * vectors_, std::size_t const count_, Vector2f & lower_, Vector2f & upper_);
+
+/// <summary>
+/// Computes lower and upper bound of array of scalars (single component of structure-of-arrays storage).
+/// </summary>
+/// <param name="values_">The values.</param>
+/// <param name="count_">Number of values.</param>
+/// <param name="lower_">The output lower bound.</param>
+/// <param name="upper_">The output upper bound.</param>
+/// <returns>
+///		<c>true</c> if array is not empty (bounds were computed); otherwise, <c>false</c>.
+/// </returns>
+bool bounds(float const * values_, std::size_t const count_, float & lower_, float & upper_);
+
+}
+
+}
@@ -8,6 +8,7 @@
 #include SFMLUI_PCH
 
 // Custom includes:
+#include "FastMath.hpp"
 #include "Helper.hpp"
 #include "VectorStringBuilder.hpp"
 
@@ -202,21 +203,20 @@ public:
 		z = static_cast<ValueType>(z_);
 	}
 
-	// not constexpr - std::sqrt is not constexpr :(
 	/// <summary>
 	/// Returns length of the vector.
 	/// </summary>
 	/// <returns>Length of the vector.</returns>
 	template <typename TLengthType = ValueType,
 		typename = std::enable_if_t< type_traits::isMathScalarV<TLengthType> > >
-	TLengthType length() const
+	constexpr TLengthType length() const
 	{
 		if constexpr(std::is_same_v<TLengthType, ValueType>)
-			return std::sqrt(x * x + y * y + z * z);
+			return math::sqrt(x * x + y * y + z * z);
 		else
 		{
 			auto conv = this->convert<TLengthType>();
-			return std::sqrt(conv.x * conv.x + conv.y * conv.y + conv.z * conv.z);
+			return math::sqrt(conv.x * conv.x + conv.y * conv.y + conv.z * conv.z);
 		}
 	}
 
@@ -237,7 +237,6 @@ public:
 		}
 	}
 
-	// not constexpr - length() is not constexpr :(
 	/// <summary>
 	/// Computes distance between two instances.
 	/// </summary>
@@ -245,10 +244,29 @@ public:
 	/// <returns>Distance between two instances.</returns>
 	template <typename TDistanceType = ValueType,
 		typename = std::enable_if_t< type_traits::isMathScalarV<TDistanceType> > >
-	TDistanceType distance(Vector3 const & other_) const
+	constexpr TDistanceType distance(Vector3 const & other_) const
 	{
 		return (*this - other_).template length<TDistanceType>();
 	}
+
+	/// <summary>
+	/// Returns length of the vector, computed with specified math policy (e.g. `math::Fast`).
+	/// </summary>
+	/// <returns>Length of the vector.</returns>
+	template <typename TMathPolicy>
+	constexpr ValueType length(TMathPolicy) const {
+		return TMathPolicy::sqrt(this->lengthSquared());
+	}
+
+	/// <summary>
+	/// Computes distance between two instances with specified math policy (e.g. `math::Fast`).
+	/// </summary>
+	/// <param name="other_">The other vector.</param>
+	/// <returns>Distance between two instances.</returns>
+	template <typename TMathPolicy>
+	constexpr ValueType distance(Vector3 const & other_, TMathPolicy const policy_) const {
+		return (*this - other_).length(policy_);
+	}
 	
 	/// <summary>
 	/// Computes squared distance between two instances.
@@ -349,13 +367,60 @@ public:
 		return *this;
 	}
 
+	/// <summary>
+	/// Computes normalized vector with specified math policy (e.g. `math::Fast`).
+	/// </summary>
+	/// <remarks>
+	/// <para>Multiplies by inverse square root instead of dividing by length.</para>
+	/// </remarks>
+	/// <returns>Normalized vector</returns>
+	template <typename TMathPolicy>
+	constexpr Vector3 normalize(TMathPolicy) const
+	{
+		auto const lenSquared = this->lengthSquared();
+		if (lenSquared != 0) {
+			return *this * TMathPolicy::inverseSqrt(lenSquared);
+		}
+		return *this;
+	}
+
+	/// <summary>
+	/// Normalizes self with specified math policy (e.g. `math::Fast`) and returns reference.
+	/// </summary>
+	/// <returns>Reference to normalized self.</returns>
+	template <typename TMathPolicy>
+	constexpr Vector3& normalizeSelf(TMathPolicy const policy_) {
+		return *this = this->normalize(policy_);
+	}
+
 	/// <summary>
 	/// Returns vector with absolute values.
 	/// </summary>
 	/// <returns>Vector with absolute values.</returns>
-	Vector3 absolute() const
+	constexpr Vector3 absolute() const
 	{
-		return Vector3{ std::abs(x), std::abs(y), std::abs(y) };
+		return Vector3{ math::abs(x), math::abs(y), math::abs(z) };
+	}
+
+	/// <summary>
+	/// Writes vector as text into the buffer, without allocating.
+	/// </summary>
+	/// <param name="buffer_">The output buffer.</param>
+	/// <param name="setup_">The string building setup.</param>
+	/// <returns>Pointer past the last written character, or <c>std::errc::value_too_large</c> when the buffer is too small.</returns>
+	std::to_chars_result formatTo(std::span<char> const buffer_, VectorStringBuilder const & setup_ = VectorStringBuilder{}) const
+	{
+		return detail::formatVector(buffer_.data(), buffer_.data() + buffer_.size(), std::array{ x, y, z }, setup_);
+	}
+
+	/// <summary>
+	/// Appends vector as text to the string.
+	/// </summary>
+	/// <param name="output_">The output string.</param>
+	/// <param name="setup_">The string building setup.</param>
+	void formatTo(std::string & output_, VectorStringBuilder const & setup_ = VectorStringBuilder{}) const
+	{
+		detail::appendVector(output_, std::array{ x, y, z }, setup_);
 	}
 
 	// yet non-constexpr
@@ -366,48 +431,9 @@ public:
 	/// <returns>Vector converted to std::string.</returns>
 	std::string toString(VectorStringBuilder const & setup_ = VectorStringBuilder{}) const
 	{
-		std::stringstream stream;
-		switch (setup_.wrap)
-		{
-		case VectorStringBuilder::Wrap::Round:	{ stream << "( "; break; }
-		case VectorStringBuilder::Wrap::Square: { stream << "[ "; break; }
-		case VectorStringBuilder::Wrap::Curly:	{ stream << "{ "; break; }
-		default: break;
-		}
-
-		if (setup_.mantissaFixed)
-			stream << std::fixed;
-
-		stream.precision(setup_.precision);
-
-		switch (setup_.compVisibility)
-		{
-		case VectorStringBuilder::CompVisibility::WithColon: {
-			stream	<< "x: " << x << setup_.separator << ' '
-					<< "y: " << y << setup_.separator << ' '
-					<< "z: " << z;
-			break;
-		}
-		case VectorStringBuilder::CompVisibility::WithEqual: {
-			stream	<< "x = " << x << setup_.separator << ' '
-					<< "y = " << y << setup_.separator << ' '
-					<< "z = " << z;
-			break;
-		}
-		default: {
-			stream << x << setup_.separator << ' ' << y << setup_.separator << ' ' << z;
-			break;
-		}
-		}
-
-		switch (setup_.wrap)
-		{
-		case VectorStringBuilder::Wrap::Round:	{ stream << " )"; break; }
-		case VectorStringBuilder::Wrap::Square: { stream << " ]"; break; }
-		case VectorStringBuilder::Wrap::Curly:	{ stream << " }"; break; }
-		default: break;
-		}
-		return stream.str();
+		std::string result;
+		formatTo(result, setup_);
+		return result;
 	}
 
 	/// <summary>
@@ -423,9 +449,9 @@ public:
 	constexpr bool nearlyEqual(Vector3 const & other_, TEqualityType const equalityTolerance_ = constants::LowTolerance<TEqualityType>) const
 	{
 		return (
-			std::abs(static_cast<TEqualityType>(x) - static_cast<TEqualityType>(other_.x)) <= equalityTolerance_ &&
-			std::abs(static_cast<TEqualityType>(y) - static_cast<TEqualityType>(other_.y)) <= equalityTolerance_ &&
-			std::abs(static_cast<TEqualityType>(z) - static_cast<TEqualityType>(other_.z)) <= equalityTolerance_
+			math::abs(static_cast<TEqualityType>(x) - static_cast<TEqualityType>(other_.x)) <= equalityTolerance_ &&
+			math::abs(static_cast<TEqualityType>(y) - static_cast<TEqualityType>(other_.y)) <= equalityTolerance_ &&
+			math::abs(static_cast<TEqualityType>(z) - static_cast<TEqualityType>(other_.z)) <= equalityTolerance_
 			);
 	}
 
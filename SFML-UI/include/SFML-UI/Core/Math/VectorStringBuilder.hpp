@@ -5,6 +5,11 @@
 // Precompiled header:
 #include SFMLUI_PCH
 
+#include <array>
+#include <charconv>
+#include <span>
+#include <string_view>
+
 namespace math
 {
 
@@ -74,4 +79,104 @@ struct VectorStringBuilder final
 	};
 };
 
+namespace detail
+{
+
+/// <summary>
+/// Writes vector components into the character range, as configured by the setup. Does not allocate.
+/// </summary>
+/// <param name="first_">The beginning of the output range.</param>
+/// <param name="last_">The end of the output range.</param>
+/// <param name="components_">The vector components.</param>
+/// <param name="setup_">The string building setup.</param>
+/// <returns>Pointer past the last written character, or <c>std::errc::value_too_large</c> when the range is too small.</returns>
+template <typename TValueType, std::size_t TCount>
+std::to_chars_result formatVector(char * first_, char * last_, std::array<TValueType, TCount> const & components_, VectorStringBuilder const & setup_)
+{
+	static_assert(TCount <= 3, "Vector formatting supports up to 3 components.");
+
+	constexpr char				Names[]		= { 'x', 'y', 'z' };
+	constexpr std::string_view	Openings[]	= { "", "( ", "[ ", "{ " };
+	constexpr std::string_view	Closings[]	= { "", " )", " ]", " }" };
+
+	char * out		= first_;
+	bool overflow	= false;
+
+	auto const write = [&](std::string_view const text_) {
+		if (overflow || static_cast<std::size_t>(last_ - out) < text_.size())
+			overflow = true;
+		else
+			out = std::copy(text_.begin(), text_.end(), out);
+	};
+
+	char const separator[] = { static_cast<char>(setup_.separator), ' ' };
+
+	write(Openings[static_cast<std::size_t>(setup_.wrap)]);
+	for (std::size_t i = 0; i < TCount; ++i)
+	{
+		if (i != 0)
+			write(std::string_view{ separator, 2 });
+
+		switch (setup_.compVisibility)
+		{
+		case VectorStringBuilder::CompVisibility::WithColon: { write(std::string_view{ &Names[i], 1 }); write(": "); break; }
+		case VectorStringBuilder::CompVisibility::WithEqual: { write(std::string_view{ &Names[i], 1 }); write(" = "); break; }
+		default: break;
+		}
+
+		if (overflow)
+			break;
+
+		std::to_chars_result result;
+		if constexpr (std::is_floating_point_v<TValueType>)
+		{
+			// Same output as std::fixed or default float notation of streams with the given precision:
+			auto const format = setup_.mantissaFixed ? std::chars_format::fixed : std::chars_format::general;
+			result = std::to_chars(out, last_, components_[i], format, static_cast<int>(setup_.precision));
+		}
+		else
+			result = std::to_chars(out, last_, components_[i]);
+
+		if (result.ec != std::errc{})
+			overflow = true;
+		else
+			out = result.ptr;
+	}
+	write(Closings[static_cast<std::size_t>(setup_.wrap)]);
+
+	if (overflow)
+		return { last_, std::errc::value_too_large };
+	return { out, std::errc{} };
+}
+
+/// <summary>
+/// Appends vector components to the string, as configured by the setup.
+/// </summary>
+/// <param name="output_">The output string.</param>
+/// <param name="components_">The vector components.</param>
+/// <param name="setup_">The string building setup.</param>
+template <typename TValueType, std::size_t TCount>
+void appendVector(std::string & output_, std::array<TValueType, TCount> const & components_, VectorStringBuilder const & setup_)
+{
+	std::size_t const offset = output_.size();
+
+	// Enough for common values; grows only for huge numbers in fixed notation.
+	std::size_t capacity = 32 * TCount;
+	while (true)
+	{
+		output_.resize(offset + capacity);
+
+		char * const first = output_.data() + offset;
+		std::to_chars_result const result = formatVector(first, first + capacity, components_, setup_);
+		if (result.ec == std::errc{})
+		{
+			output_.resize(offset + static_cast<std::size_t>(result.ptr - first));
+			return;
+		}
+		capacity *= 2;
+	}
+}
+
+} // namespace detail
+
 } // namespace math
@@ -1,8 +1,16 @@
 #pragma once
 
+#include "Math/Affine2.hpp"
+#include "Math/AlignedAllocator.hpp"
+#include "Math/FastMath.hpp"
+#include "Math/FixedPoint.hpp"
 #include "Math/Helper.hpp"
 #include "Math/Length.hpp"
 #include "Math/Random.hpp"
+#include "Math/RandomBatch.hpp"
 #include "Math/Vector2.hpp"
+#include "Math/Vector2Array.hpp"
+#include "Math/Vector2Batch.hpp"
 #include "Math/Vector3.hpp"
+#include "Math/Vector3Array.hpp"
 #include "Math/VectorStringBuilder.hpp"
\ No newline at end of file
@@ -51,4 +51,32 @@ inline math::Vector3<TType> fromSFMLVector(const sf::Vector3<TType> &vector_)
 	return math::Vector2<TType>{ vector_.x, vector_.y, vector_.z };
 }
 
+/// <summary>
+/// Converts math::Affine2 to sf::Transform.
+/// </summary>
+/// <param name="matrix_">The affine matrix.</param>
+/// <returns>sf::Transform equivalent to passed math::Affine2.</returns>
+inline sf::Transform toSFMLTransform(math::Affine2f const & matrix_)
+{
+	return sf::Transform{
+			matrix_.m00,	matrix_.m01,	matrix_.m02,
+			matrix_.m10,	matrix_.m11,	matrix_.m12,
+			0.f,			0.f,			1.f
+		};
+}
+
+/// <summary>
+/// Converts sf::Transform to math::Affine2. Projective part of the transform is ignored.
+/// </summary>
+/// <param name="transform_">The SFML transform.</param>
+/// <returns>math::Affine2 equivalent to passed sf::Transform.</returns>
+inline math::Affine2f fromSFMLTransform(sf::Transform const & transform_)
+{
+	auto const matrix = transform_.getMatrix();
+	return math::Affine2f{
+			matrix[0],	matrix[4],	matrix[12],
+			matrix[1],	matrix[5],	matrix[13]
+		};
+}
+
 }
\ No newline at end of file
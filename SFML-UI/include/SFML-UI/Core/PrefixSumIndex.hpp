@@ -0,0 +1,101 @@
+#pragma once
+
+#include SFMLUI_PCH
+
+#include <span>
+
+namespace sfui
+{
+
+/// <summary>
+/// Sequence of non-negative extents (e.g. row heights) with fast prefix sums (offsets).
+/// </summary>
+/// <remarks>
+/// <para>Stored as Fenwick (binary indexed) tree: changing one extent, finding offset of an item and finding item at offset
+/// take O(log n), appending and truncating is O(log n) per item. Sums are accumulated in double precision,
+/// so offsets stay exact for millions of items.</para>
+/// </remarks>
+class PrefixSumIndex
+{
+public:
+	// Methods:
+
+	/// <summary>
+	/// Replaces contents with specified number of equal extents.
+	/// </summary>
+	/// <param name="count_">The number of items.</param>
+	/// <param name="extent_">The extent of every item.</param>
+	void assign(std::size_t const count_, double const extent_);
+
+	/// <summary>
+	/// Replaces contents with specified extents. Builds the index in O(n).
+	/// </summary>
+	/// <param name="extents_">The extents.</param>
+	void assign(std::span<double const> const extents_);
+
+	/// <summary>
+	/// Changes number of items. New items receive specified extent.
+	/// </summary>
+	/// <param name="count_">The number of items.</param>
+	/// <param name="extent_">The extent of new items.</param>
+	void resize(std::size_t const count_, double const extent_);
+
+	/// <summary>
+	/// Appends an item.
+	/// </summary>
+	/// <param name="extent_">The item's extent.</param>
+	void pushBack(double const extent_);
+
+	/// <summary>
+	/// Changes extent of the item.
+	/// </summary>
+	/// <param name="index_">The item index. Throws std::out_of_range when not lower than size.</param>
+	/// <param name="extent_">The new extent.</param>
+	void set(std::size_t const index_, double const extent_);
+
+	/// <summary>
+	/// Returns extent of the item.
+	/// </summary>
+	/// <param name="index_">The item index.</param>
+	/// <returns>The extent.</returns>
+	double get(std::size_t const index_) const {
+		return m_extents[index_];
+	}
+
+	/// <summary>
+	/// Returns sum of extents of items before the specified one (its offset).
+	/// </summary>
+	/// <param name="index_">The item index (size is allowed, giving the total).</param>
+	/// <returns>The offset.</returns>
+	double getOffset(std::size_t const index_) const;
+
+	/// <summary>
+	/// Returns sum of all extents.
+	/// </summary>
+	/// <returns>The total.</returns>
+	double getTotal() const {
+		return this->getOffset(m_extents.size());
+	}
+
+	/// <summary>
+	/// Finds item covering specified offset (the last one whose offset is not greater than it).
+	/// </summary>
+	/// <param name="offset_">The offset.</param>
+	/// <returns>The item index, clamped to [0, size - 1]; 0 if there are no items.</returns>
+	std::size_t findIndex(double const offset_) const;
+
+	/// <summary>
+	/// Returns number of items.
+	/// </summary>
+	/// <returns>Number of items.</returns>
+	std::size_t getSize() const {
+		return m_extents.size();
+	}
+private:
+	// Members:
+
+	std::vector<double>	m_extents;	// Extent of every item.
+	std::vector<double>	m_tree;		// Fenwick tree, 1-based: m_tree[i - 1] is sum of extents in (i - lowbit(i), i].
+};
+
+}
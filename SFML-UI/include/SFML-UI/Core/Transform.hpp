@@ -2,12 +2,59 @@
 
 #include SFMLUI_PCH
 
+#include <SFML-UI/Core/Math/Affine2.hpp>
+#include <SFML-UI/Core/Math/FastMath.hpp>
+
 namespace sfui
 {
 	
 namespace transform_algorithm
 {
 
+/// <summary>
+/// Position, rotation and scale extracted from a transform.
+/// </summary>
+struct Decomposed
+{
+	sf::Vector2f	position;
+	float			rotation;	// In degrees, in range [0, 360).
+	sf::Vector2f	scale;
+};
+
+/// <summary>
+/// Extracts position, rotation and scale from specified transform at once.
+/// </summary>
+/// <remarks>
+/// <para>Reflection is always attributed to the y-axis scale. Transforms with zero x-axis scale take rotation from the y-axis.</para>
+/// </remarks>
+/// <param name="transform_">The transform.</param>
+/// <returns>Decomposed transform.</returns>
+Decomposed decompose(sf::Transform const & transform_);
+
+/// <summary>
+/// Extracts position, rotation and scale from specified affine matrix at once.
+/// </summary>
+/// <param name="matrix_">The matrix.</param>
+/// <returns>Decomposed matrix.</returns>
+Decomposed decompose(math::Affine2f const & matrix_);
+
+/// <summary>
+/// Extracts position, rotation and scale from specified transform at once, using fast approximate math (see <see cref="math::FastMath"/>).
+/// </summary>
+/// <remarks>
+/// <para>Meant for visual-only computations: rotation differs from the precise result by less than 0.0002 degree, scale by relative 5e-6.</para>
+/// </remarks>
+/// <param name="transform_">The transform.</param>
+/// <returns>Decomposed transform.</returns>
+Decomposed decompose(sf::Transform const & transform_, math::FastMath);
+
+/// <summary>
+/// Extracts position, rotation and scale from specified affine matrix at once, using fast approximate math (see <see cref="math::FastMath"/>).
+/// </summary>
+/// <param name="matrix_">The matrix.</param>
+/// <returns>Decomposed matrix.</returns>
+Decomposed decompose(math::Affine2f const & matrix_, math::FastMath);
+
 /// <summary>
 /// Extracts position from specified transform.
 /// </summary>
@@ -31,6 +78,34 @@ sf::Vector2f extractScale(sf::Transform const & transform_);
 /// <returns>Extracted rotation.</returns>
 float extractRotation(sf::Transform const & transform_);
 
+/// <summary>
+/// Decomposes many transforms at once, see <see cref="decompose"/>.
+/// </summary>
+/// <remarks>
+/// <para>Uses the widest SIMD instruction set supported by the CPU (see <see cref="cpu::getInstructionSet"/>).</para>
+/// <para>SIMD kernels use polynomial approximations - rotation differs from the scalar result by less than 0.001 degree.</para>
+/// </remarks>
+/// <param name="transforms_">The transforms.</param>
+/// <param name="count_">Number of transforms.</param>
+/// <param name="positions_">The output positions.</param>
+/// <param name="rotations_">The output rotations.</param>
+/// <param name="scales_">The output scales.</param>
+void decompose(sf::Transform const * transforms_, std::size_t const count_, sf::Vector2f * positions_, float * rotations_, sf::Vector2f * scales_);
+
+/// <summary>
+/// Composes many transforms at once, the same way sf::Transformable does.
+/// </summary>
+/// <remarks>
+/// <para>Uses the widest SIMD instruction set supported by the CPU (see <see cref="cpu::getInstructionSet"/>).</para>
+/// </remarks>
+/// <param name="positions_">The positions.</param>
+/// <param name="rotations_">The rotations (in degrees).</param>
+/// <param name="scales_">The scales.</param>
+/// <param name="origins_">The origins. nullptr if every origin is zero.</param>
+/// <param name="count_">Number of transforms.</param>
+/// <param name="transforms_">The output transforms.</param>
+void compose(sf::Vector2f const * positions_, float const * rotations_, sf::Vector2f const * scales_, sf::Vector2f const * origins_, std::size_t const count_, sf::Transform * transforms_);
+
 }
 
 }
@@ -2,6 +2,12 @@
 
 #include SFMLUI_PCH
 
+namespace math
+{
+template <typename TStorageType, std::size_t _fractionBits>
+class FixedPoint;
+}
+
 namespace type_traits
 {
 
@@ -42,6 +48,19 @@ constexpr bool isRatioV = false;
 template<intmax_t _ratioNumerator, intmax_t _ratioDenumerator>
 constexpr bool isRatioV<std::ratio<_ratioNumerator, _ratioDenumerator> > = true;
 
+template <typename TNonFixedPointType>
+struct isFixedPoint {
+	static constexpr bool value = false;
+};
+
+template <typename TStorageType, std::size_t _fractionBits>
+struct isFixedPoint< math::FixedPoint<TStorageType, _fractionBits> > {
+	static constexpr bool value = true;
+};
+
+template <typename TType>
+constexpr bool isFixedPointV = isFixedPoint<TType>::value;
+
 template <typename TType>
 struct isMathScalar {
 	static constexpr bool value = isCVRefV<TType> && std::is_arithmetic_v<TType> && !std::is_same_v<TType, bool>;
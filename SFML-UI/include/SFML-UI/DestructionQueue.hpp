@@ -0,0 +1,109 @@
+#pragma once
+
+#include SFMLUI_PCH
+
+#include <SFML-UI/Interfaces/Updatable.hpp>
+#include <SFML-UI/Core/Pointers.hpp>
+
+namespace sfui
+{
+
+class Element;
+
+/// <summary>
+/// Takes ownership of removed subtrees and destroys them later, a limited number of elements per update.
+/// </summary>
+/// <remarks>
+/// <para>Assign the queue to an element with <see cref="Element::setDestructionQueue"/>; subtrees removed
+/// by <see cref="Element::remove"/> of that element (and not parked by <see cref="ElementRecycler"/>) are then
+/// enqueued instead of destroyed immediately. Like the recycler, the queue is not inherited by children -
+/// one queue may be assigned to many elements.</para>
+/// <para>Destruction is iterative: children of an element are moved to the queue before it is destroyed,
+/// so every destructor runs on an element without children. Elements still owned elsewhere are only released
+/// (they stay alive with their subtrees).</para>
+/// <para>Destruction happens on the thread calling <see cref="update"/> (elements may release graphics resources).
+/// Destroying the queue destroys everything pending. The queue must outlive elements it is assigned to.</para>
+/// </remarks>
+class DestructionQueue
+	: public IUpdatable
+{
+public:
+	// Aliases:
+
+	using ElementPtrType	= SharedPtr< Element >;
+	using DurationType		= std::chrono::microseconds;
+
+	// Methods:
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="DestructionQueue"/> class.
+	/// </summary>
+	DestructionQueue();
+
+	DestructionQueue(DestructionQueue const &) = delete;
+	DestructionQueue& operator=(DestructionQueue const &) = delete;
+
+	/// <summary>
+	/// Destroys every pending element.
+	/// </summary>
+	virtual ~DestructionQueue();
+
+	/// <summary>
+	/// Takes ownership of the subtree. Its root must not have a parent.
+	/// </summary>
+	/// <param name="element_">The root of the subtree.</param>
+	void enqueue(ElementPtrType element_);
+
+	/// <summary>
+	/// Sets limits of work done by one update. Destruction stops when either is reached.
+	/// </summary>
+	/// <param name="maxElements_">The maximal number of released elements.</param>
+	/// <param name="maxDuration_">The maximal duration (checked every few elements, so it may be exceeded slightly).</param>
+	void setSliceLimits(std::size_t const maxElements_, DurationType const maxDuration_);
+
+	/// <summary>
+	/// Releases pending elements.
+	/// </summary>
+	/// <param name="maxElements_">The maximal number of released elements.</param>
+	/// <returns>Number of released elements.</returns>
+	std::size_t process(std::size_t const maxElements_);
+
+	/// <summary>
+	/// Releases every pending element.
+	/// </summary>
+	void flush();
+
+	/// <summary>
+	/// Returns number of pending elements (their descendants are not counted until they are reached).
+	/// </summary>
+	/// <returns>Number of pending elements.</returns>
+	std::size_t getPendingCount() const {
+		return m_pending.size();
+	}
+
+	/// <summary>
+	/// Returns number of elements released so far.
+	/// </summary>
+	/// <returns>Number of released elements.</returns>
+	std::size_t getReleasedCount() const {
+		return m_releasedCount;
+	}
+
+	// Overriden methods from IUpdatable:
+	/// <summary>
+	/// Releases pending elements within slice limits.
+	/// </summary>
+	/// <param name="deltaTime_">Time that passed since previous frame.</param>
+	/// <param name="frameTime_">The frame start time.</param>
+	virtual void update(double const deltaTime_, TimePoint const & frameTime_) override;
+
+private:
+	// Members:
+
+	std::vector<ElementPtrType>	m_pending;				// Used as a stack: subtrees are taken apart depth-first.
+	std::size_t					m_maxElementsPerSlice;
+	DurationType				m_maxSliceDuration;
+	std::size_t					m_releasedCount;
+};
+
+}
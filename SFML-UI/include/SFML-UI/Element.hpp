@@ -3,11 +3,15 @@
 #include SFMLUI_PCH
 
 #include <SFML-UI/Interfaces/Updatable.hpp>
+#include <SFML-UI/ElementRecycler.hpp>
 #include <SFML-UI/Core/Pointers.hpp>
+#include <SFML-UI/Core/Math/Affine2.hpp>
 
 namespace sfui
 {
 
+class DestructionQueue;
+
 /// <summary>
 /// Contains and manages every element inside.
 /// </summary>
@@ -44,6 +48,7 @@ public:
 
 	using ElementPtrType	= SharedPtr< Element >;
 	using ElementPoolType	= std::vector< ElementPtrType >;
+	using PropertyMapType	= std::map< std::string, std::string, std::less<> >;
 
 	// Methods:
 	
@@ -51,14 +56,36 @@ public:
 	/// Initializes a new instance of the <see cref="Element"/> class.
 	/// </summary>
 	Element();
+
+	/// <summary>
+	/// Finalizes an instance of the <see cref="Element"/> class. The subtree is destroyed iteratively (deep trees do not overflow the stack).
+	/// </summary>
+	virtual ~Element();
 		
 	/// <summary>
-	/// Spawns an element inside this scene.
+	/// Spawns an element inside this scene. Reuses parked element when recycling is set up (see <see cref="ElementRecycler"/>).
 	/// </summary>
 	/// <returns>Reference to the created element.</returns>
 	template <typename TElementType, typename... TArgs>		
 	TElementType& spawn(TArgs&&... arguments_)
 	{
+		// Parked element can be reused only if it can be brought to the requested state:
+		if constexpr (sizeof...(TArgs) == 0 || requires(TElementType & element_, TArgs&&... reinitializeArguments_) { element_.reinitialize(std::forward<TArgs>(reinitializeArguments_)...); })
+		{
+			if (m_recycler)
+			{
+				if (auto element = m_recycler->template acquire<TElementType>())
+				{
+					if constexpr (sizeof...(TArgs) > 0)
+						element->reinitialize(std::forward<TArgs>(arguments_)...);
+
+					auto& elementRef = *element;
+					this->attach( std::move(element), AttachTransform::SnapToTarget, AttachPolicy::Unchecked );
+					return elementRef;
+				}
+			}
+		}
+
 		if (auto element = std::make_shared<TElementType>( std::forward<TArgs>(arguments_)... ))
 		{
 			auto& elementRef = *element;
@@ -81,7 +108,8 @@ public:
 	bool attach(ElementPtrType && element_, AttachTransform const transform_, AttachPolicy const policy_ = AttachPolicy::Checked);
 		
 	/// <summary>
-	/// Removes the specified element from the scene.
+	/// Removes the specified element from the scene. Parks it when recycling is set up (see <see cref="ElementRecycler"/>),
+	/// otherwise hands it to destruction queue when one is assigned (see <see cref="DestructionQueue"/>).
 	/// </summary>
 	/// <param name="element_">The element.</param>
 	/// <returns>
@@ -149,6 +177,12 @@ public:
 	/// <returns>World transform.</returns>
 	sf::Transform getWorldTransform() const;
 
+	/// <summary>
+	/// Returns the world transform as compact affine matrix. Calculated only when the element or any of its ancestors moved.
+	/// </summary>
+	/// <returns>World transform matrix.</returns>
+	math::Affine2f const& getWorldMatrix() const;
+
 	/// <summary>
 	/// Returns cref to element pool.
 	/// </summary>
@@ -157,14 +191,97 @@ public:
 		return m_children;
 	}
 
+	/// <summary>
+	/// Sets the recycler used by spawn and remove of this element. Not inherited by children, the same as the destruction queue,
+	/// so spawn and remove stay constant-time lookups.
+	/// </summary>
+	/// <param name="recycler_">The recycler (must outlive the element); <c>nullptr</c> to disable recycling.</param>
+	void setRecycler(ElementRecycler* recycler_) {
+		m_recycler = recycler_;
+	}
+
+	/// <summary>
+	/// Returns the recycler assigned to this element.
+	/// </summary>
+	/// <returns>The recycler; <c>nullptr</c> if not assigned.</returns>
+	ElementRecycler* getRecycler() const {
+		return m_recycler;
+	}
+
+	/// <summary>
+	/// Sets the queue that destroys subtrees removed from this element. Not inherited by children, the same as the recycler.
+	/// </summary>
+	/// <param name="queue_">The queue (must outlive the element); <c>nullptr</c> to destroy removed subtrees immediately.</param>
+	void setDestructionQueue(DestructionQueue* queue_) {
+		m_destructionQueue = queue_;
+	}
+
+	/// <summary>
+	/// Returns the destruction queue assigned to this element.
+	/// </summary>
+	/// <returns>The queue; <c>nullptr</c> if not assigned.</returns>
+	DestructionQueue* getDestructionQueue() const {
+		return m_destructionQueue;
+	}
+
+	/// <summary>
+	/// Determines whether element moves with its parent.
+	/// </summary>
+	/// <returns>
+	///		<c>true</c> if transform is relative to the parent; otherwise, <c>false</c>.
+	/// </returns>
+	bool usesRelativeTransform() const {
+		return m_usesRelativeTransform;
+	}
+
+	// User properties:
+
+	/// <summary>
+	/// Sets the user property (free-form text attached to the element, e.g. by UI descriptions).
+	/// </summary>
+	/// <param name="name_">The property name.</param>
+	/// <param name="value_">The property value.</param>
+	void setProperty(std::string_view const name_, std::string value_);
+
+	/// <summary>
+	/// Returns the user property.
+	/// </summary>
+	/// <param name="name_">The property name.</param>
+	/// <returns>Pointer to the value; <c>nullptr</c> if the property is not set.</returns>
+	std::string const* getProperty(std::string_view const name_) const;
+
+	/// <summary>
+	/// Removes the user property.
+	/// </summary>
+	/// <param name="name_">The property name.</param>
+	/// <returns>
+	///		<c>true</c> if property was set; otherwise, <c>false</c>.
+	/// </returns>
+	bool removeProperty(std::string_view const name_);
+
+	/// <summary>
+	/// Returns cref to user properties.
+	/// </summary>
+	/// <returns>const-ref to user properties.</returns>
+	PropertyMapType const& getProperties() const {
+		return m_properties;
+	}
+
 
 	// Overriden methods from IUpdatable:
 	/// <summary>
-	/// Updates this instance.
+	/// Updates this instance and its descendants (parents first), calling <see cref="updateSelf"/> of each.
+	/// Traversal is iterative, so deep trees do not overflow the stack.
 	/// </summary>
+	/// <remarks>
+	/// <para>Breaking change: update is final, subclasses that overrode it no longer compile.
+	/// The traversal calls updateSelf of descendants directly, so an override of update would be silently skipped for every element but the root.</para>
+	/// <para>Migration: move the element's own work to <see cref="updateSelf"/>. An override that called the base implementation and updated children by hand
+	/// only needs the element's part, children are updated right after it.</para>
+	/// </remarks>
 	/// <param name="deltaTime_">Time that passed since previous frame.</param>
 	/// <param name="frameTime_">The frame start time.</param>
-	virtual void update(double const deltaTime_, TimePoint const & frameTime_) override;
+	virtual void update(double const deltaTime_, TimePoint const & frameTime_) override final;
 
 	// Overriden (shadowed) methods for sf::Transformable
 
@@ -303,11 +420,47 @@ protected:
 	// Methods:
 	// Overriden methods from sf::Drawable:
 	/// <summary>
-	/// Draws the entire scene on specified target.
+	/// Draws the entire scene on specified target, calling <see cref="drawSelf"/> of each element (parents first).
+	/// Traversal is iterative, so deep trees do not overflow the stack.
 	/// </summary>
+	/// <remarks>
+	/// <para>Breaking change: draw is final, subclasses that overrode it no longer compile (same reason as <see cref="update"/>).</para>
+	/// <para>Migration: move drawing of the element itself to <see cref="drawSelf"/> - the states it gets already include the element's transform,
+	/// so do not multiply by getTransform() again. Work done after drawing children (e.g. restoring state) goes to <see cref="drawAfterChildren"/>,
+	/// enabled with <see cref="setDrawsAfterChildren"/>.</para>
+	/// </remarks>
 	/// <param name="target_">The target.</param>
 	/// <param name="states_">The render states.</param>
-	virtual void draw(sf::RenderTarget & target_, sf::RenderStates states_) const override;
+	virtual void draw(sf::RenderTarget & target_, sf::RenderStates states_) const override final;
+
+	/// <summary>
+	/// Updates the element itself. Called before its children are updated, so it may change them.
+	/// </summary>
+	/// <param name="deltaTime_">Time that passed since previous frame.</param>
+	/// <param name="frameTime_">The frame start time.</param>
+	virtual void updateSelf(double const deltaTime_, TimePoint const & frameTime_);
+
+	/// <summary>
+	/// Draws the element itself. Called before its children are drawn.
+	/// </summary>
+	/// <param name="target_">The target.</param>
+	/// <param name="states_">The render states, transform already includes the element's own.</param>
+	virtual void drawSelf(sf::RenderTarget & target_, sf::RenderStates states_) const;
+
+	/// <summary>
+	/// Called after the element's children are drawn, if enabled with <see cref="setDrawsAfterChildren"/>.
+	/// </summary>
+	/// <param name="target_">The target.</param>
+	/// <param name="states_">The render states, transform already includes the element's own.</param>
+	virtual void drawAfterChildren(sf::RenderTarget & target_, sf::RenderStates states_) const;
+
+	/// <summary>
+	/// Enables calling <see cref="drawAfterChildren"/> (disabled by default, so other elements do not pay for it).
+	/// </summary>
+	/// <param name="enabled_">Whether to call it.</param>
+	void setDrawsAfterChildren(bool const enabled_) {
+		m_drawsAfterChildren = enabled_;
+	}
 	
 	/// <summary>
 	/// Sets the element's parent.
@@ -325,6 +478,11 @@ protected:
 	/// </summary>
 	void reinsertChildWithOrder(Element & element_);
 	
+	/// <summary>
+	/// Invalidates the world transform of the element and its whole subtree.
+	/// </summary>
+	void invalidateWorldTransform();
+
 	/// <summary>
 	/// Invalidates the children world transform.
 	/// </summary>
@@ -358,17 +516,48 @@ protected:
 	/// <param name="element_">The element.</param>
 	virtual void whenChildChangesZIndex(Element & element_);
 
+	/// <summary>
+	/// Called when the element is parked by <see cref="ElementRecycler"/>, to reset its state before reuse.
+	/// Resets transform, origin, z index and user properties. Children are kept.
+	/// </summary>
+	virtual void whenRecycled();
+
 	// Members:
 
 	ElementPoolType			m_children;						// Every direct child element is stored inside this container.
 	Element*				m_parent;						// Element's parent in the UI tree. nullptr if this element is a root.
 private:
+	friend class SceneSnapshot;		// Builds whole subtrees at once, bypassing per-child attach.
+	friend class SceneReconciler;	// Restores description order of siblings with equal z-index.
+	friend class ElementRecycler;	// Resets parked elements.
+	friend class DestructionQueue;	// Takes subtrees apart.
+
+	/// <summary>
+	/// Moves every child to the pool, clearing their parent.
+	/// </summary>
+	/// <param name="pending_">The pool.</param>
+	void releaseChildrenTo(ElementPoolType & pending_);
+
+	ElementRecycler*		m_recycler;						// Recycler used by spawn and remove of this element.
+	DestructionQueue*		m_destructionQueue;				// Queue that destroys subtrees removed from this element.
+
+	PropertyMapType			m_properties;					// User properties (free-form text, not interpreted by the element).
 	std::int32_t			m_zIndex;						// Index used to determine which element of the siblings (inside parent's draw and update loop) will be considered first. The lower the z-index is, the earlier element is processed.
 	
 	bool					m_usesRelativeTransform;		// Determines whether object moves with its parent or not.
+	bool					m_drawsAfterChildren;			// Determines whether drawAfterChildren is called.
+
+	/// <summary>
+	/// Decomposes the world transform if it changed since the last decomposition.
+	/// </summary>
+	void updateWorldDecomposition() const;
 
-	mutable sf::Transform	m_worldTransform;				// Pre-calculated world transform, used to improve performance.
-	mutable bool			m_needsWorldTransformUpdate;	// Determines whether world transform must be updated.
+	mutable math::Affine2f	m_worldMatrix;					// Pre-calculated world transform, used to improve performance.
+	mutable sf::Vector2f	m_worldPosition;				// Pre-calculated world position (decomposed from world transform).
+	mutable sf::Vector2f	m_worldScale;					// Pre-calculated world scale (decomposed from world transform).
+	mutable float			m_worldRotation;				// Pre-calculated world rotation (decomposed from world transform).
+	mutable bool			m_needsWorldTransformUpdate;	// Determines whether world transform must be updated. When set, the same flag is set for every descendant.
+	mutable bool			m_needsWorldDecompositionUpdate;// Determines whether world position, rotation and scale must be updated.
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,180 @@
+#pragma once
+
+#include SFMLUI_PCH
+
+#include <SFML-UI/Core/Pointers.hpp>
+
+#include <typeindex>
+#include <unordered_map>
+
+namespace sfui
+{
+
+class Element;
+class AnimationEngine;
+
+/// <summary>
+/// Keeps removed elements of chosen types parked, so spawning another element of the same type reuses one
+/// instead of constructing it (and allocating its shared pointer control block) again.
+/// </summary>
+/// <remarks>
+/// <para>Assign the recycler to an element (e.g. tooltip or toast layer) with <see cref="Element::setRecycler"/>;
+/// it is then used by <see cref="Element::spawn"/> and <see cref="Element::remove"/> of that element.
+/// One recycler may be assigned to many elements. Only types enabled with <see cref="enable"/> are parked,
+/// matched by exact dynamic type.</para>
+/// <para>Parked element is reset by <see cref="Element::whenRecycled"/> (children are kept - they usually are
+/// the element's own parts). Spawn reuses it when called without arguments, or when the type provides
+/// <c>reinitialize</c> member function accepting the spawn arguments.</para>
+/// <para>Parked elements stay alive, so tweens targeting them would keep running after reuse - assign the engine
+/// with <see cref="setAnimationEngine"/> to cancel tweens of parked elements and their descendants.</para>
+/// <para>Element is not parked (it is destroyed as usual) when something else still owns it, or when
+/// its pool is full. Elements released by <see cref="Element::detach"/> or by destruction of their parent
+/// are never parked. The recycler must outlive elements it is assigned to.</para>
+/// </remarks>
+class ElementRecycler
+{
+public:
+	// Aliases:
+
+	using ElementPtrType = SharedPtr< Element >;
+
+	// Nested types:
+
+	/// <summary>
+	/// Counters of one pool.
+	/// </summary>
+	struct Stats
+	{
+		std::size_t spawnCount		= 0;	// Spawns that could reuse a parked element.
+		std::size_t reuseCount		= 0;	// Spawns that reused a parked element.
+		std::size_t parkCount		= 0;	// Removed elements that were parked.
+		std::size_t discardCount	= 0;	// Removed elements that were destroyed (pool full or element still owned elsewhere).
+
+		/// <summary>
+		/// Returns ratio of spawns that reused a parked element.
+		/// </summary>
+		/// <returns>The ratio (0 when nothing was spawned).</returns>
+		double getReuseRatio() const {
+			return spawnCount > 0 ? static_cast<double>(reuseCount) / static_cast<double>(spawnCount) : 0.0;
+		}
+	};
+
+	// Methods:
+
+	/// <summary>
+	/// Enables parking of the element type.
+	/// </summary>
+	/// <remarks>
+	/// <para>Spawning without arguments may return an element that was constructed with arguments. Enable only types
+	/// whose state after <see cref="Element::whenRecycled"/> (override it for own state) matches a default-constructed one.</para>
+	/// </remarks>
+	/// <param name="capacity_">The maximal number of parked elements of the type.</param>
+	template <typename TElementType>
+	void enable(std::size_t const capacity_)
+	{
+		this->enable(std::type_index{ typeid(TElementType) }, capacity_);
+	}
+
+	/// <summary>
+	/// Enables parking of the element type.
+	/// </summary>
+	/// <param name="type_">The exact element type.</param>
+	/// <param name="capacity_">The maximal number of parked elements of the type. Lowering it destroys surplus parked elements.</param>
+	void enable(std::type_index const type_, std::size_t const capacity_);
+
+	/// <summary>
+	/// Takes a parked element of the type.
+	/// </summary>
+	/// <returns>The element; <c>nullptr</c> if none is parked (or the type is not enabled).</returns>
+	template <typename TElementType>
+	SharedPtr<TElementType> acquire()
+	{
+		// Pools hold elements of exact types only, so the cast is safe:
+		return std::static_pointer_cast<TElementType>(this->acquire(std::type_index{ typeid(TElementType) }));
+	}
+
+	/// <summary>
+	/// Takes a parked element of the type.
+	/// </summary>
+	/// <param name="type_">The exact element type.</param>
+	/// <returns>The element; <c>nullptr</c> if none is parked (or the type is not enabled).</returns>
+	ElementPtrType acquire(std::type_index const type_);
+
+	/// <summary>
+	/// Parks the element, if its type is enabled, its pool is not full and nothing else owns it.
+	/// The element must not have a parent.
+	/// </summary>
+	/// <param name="element_">The element.</param>
+	/// <returns>
+	///		<c>true</c> if parked; otherwise, <c>false</c> (element_ is left untouched).
+	/// </returns>
+	bool park(ElementPtrType & element_);
+
+	/// <summary>
+	/// Destroys every parked element. Stats are kept.
+	/// </summary>
+	void clear();
+
+	/// <summary>
+	/// Sets the animation engine whose tweens are cancelled when an element is parked.
+	/// </summary>
+	/// <param name="engine_">The engine (must outlive the recycler); <c>nullptr</c> to cancel nothing.</param>
+	void setAnimationEngine(AnimationEngine* engine_) {
+		m_animationEngine = engine_;
+	}
+
+	/// <summary>
+	/// Returns the animation engine whose tweens are cancelled when an element is parked.
+	/// </summary>
+	/// <returns>The engine; <c>nullptr</c> if not assigned.</returns>
+	AnimationEngine* getAnimationEngine() const {
+		return m_animationEngine;
+	}
+
+	/// <summary>
+	/// Returns counters of the element type.
+	/// </summary>
+	/// <returns>The counters (zeros when the type is not enabled).</returns>
+	template <typename TElementType>
+	Stats getStats() const
+	{
+		return this->getStats(std::type_index{ typeid(TElementType) });
+	}
+
+	/// <summary>
+	/// Returns counters of the element type.
+	/// </summary>
+	/// <param name="type_">The exact element type.</param>
+	/// <returns>The counters (zeros when the type is not enabled).</returns>
+	Stats getStats(std::type_index const type_) const;
+
+	/// <summary>
+	/// Returns counters summed over every type.
+	/// </summary>
+	/// <returns>The counters.</returns>
+	Stats getTotalStats() const;
+
+	/// <summary>
+	/// Returns number of parked elements of every type.
+	/// </summary>
+	/// <returns>Number of parked elements.</returns>
+	std::size_t getParkedCount() const;
+
+private:
+	/// <summary>
+	/// Parked elements of one type.
+	/// </summary>
+	struct Pool
+	{
+		std::vector<ElementPtrType>	parked;
+		std::size_t					capacity = 0;
+		Stats						stats;
+	};
+
+	// Members:
+
+	std::unordered_map<std::type_index, Pool>	m_pools;
+	AnimationEngine*							m_animationEngine = nullptr;
+};
+
+}
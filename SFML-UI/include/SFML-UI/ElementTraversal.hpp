@@ -0,0 +1,264 @@
+#pragma once
+
+#include SFMLUI_PCH
+
+#include <SFML-UI/Element.hpp>
+
+#include <iterator>
+
+namespace sfui
+{
+
+/// <summary>
+/// Visits element and its descendants, parents before children (in children order). Uses explicit stack, so deep trees are fine.
+/// </summary>
+/// <typeparam name="TElementType">Element or const Element.</typeparam>
+/// <remarks>
+/// <para>The tree must not change during iteration.</para>
+/// </remarks>
+template <typename TElementType>
+class PreorderIterator
+{
+public:
+	// Aliases:
+
+	using iterator_category	= std::forward_iterator_tag;
+	using value_type		= std::remove_const_t<TElementType>;
+	using difference_type	= std::ptrdiff_t;
+	using pointer			= TElementType*;
+	using reference			= TElementType&;
+
+	// Methods:
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="PreorderIterator"/> class (the end iterator).
+	/// </summary>
+	PreorderIterator() = default;
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="PreorderIterator"/> class, pointing to the root.
+	/// </summary>
+	/// <param name="root_">The root of visited subtree.</param>
+	explicit PreorderIterator(TElementType & root_)
+	{
+		m_stack.push_back(&root_);
+	}
+
+	/// <summary>
+	/// Makes the next increment skip the current element's descendants (e.g. to skip hidden subtrees).
+	/// </summary>
+	/// <remarks>
+	/// <para>Does not move the iterator - call it before <c>++</c>, e.g. <c>if (isHidden(*it)) it.skipChildren(); ++it;</c>.
+	/// Range-based for loops hide the iterator, so use an explicit loop over <see cref="preorder"/>.</para>
+	/// </remarks>
+	void skipChildren()
+	{
+		m_skipChildren = true;
+	}
+
+	reference operator*() const {
+		return *m_stack.back();
+	}
+
+	pointer operator->() const {
+		return m_stack.back();
+	}
+
+	PreorderIterator& operator++()
+	{
+		TElementType* const element = m_stack.back();
+		m_stack.pop_back();
+
+		if (m_skipChildren)
+		{
+			m_skipChildren = false;
+			return *this;
+		}
+
+		auto const & children = element->getChildren();
+		for (auto it = children.rbegin(); it != children.rend(); ++it)
+			m_stack.push_back(it->get());
+
+		return *this;
+	}
+
+	PreorderIterator operator++(int)
+	{
+		auto previous = *this;
+		++(*this);
+		return previous;
+	}
+
+	bool operator==(PreorderIterator const & other_) const
+	{
+		// Pending stacks only grow or shrink at the back, so the size and the top identify the position:
+		return m_stack.size() == other_.m_stack.size() && (m_stack.empty() || m_stack.back() == other_.m_stack.back());
+	}
+
+private:
+	// Members:
+
+	std::vector<TElementType*>	m_stack;					// Elements to visit, the next one at the back.
+	bool						m_skipChildren = false;		// Whether the next increment skips children of the current element.
+};
+
+/// <summary>
+/// Visits element and its descendants, children (in children order) before parents. Uses explicit stack, so deep trees are fine.
+/// </summary>
+/// <typeparam name="TElementType">Element or const Element.</typeparam>
+/// <remarks>
+/// <para>The tree must not change during iteration.</para>
+/// </remarks>
+template <typename TElementType>
+class PostorderIterator
+{
+public:
+	// Aliases:
+
+	using iterator_category	= std::forward_iterator_tag;
+	using value_type		= std::remove_const_t<TElementType>;
+	using difference_type	= std::ptrdiff_t;
+	using pointer			= TElementType*;
+	using reference			= TElementType&;
+
+	// Methods:
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="PostorderIterator"/> class (the end iterator).
+	/// </summary>
+	PostorderIterator() = default;
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="PostorderIterator"/> class, pointing to the first leaf.
+	/// </summary>
+	/// <param name="root_">The root of visited subtree.</param>
+	explicit PostorderIterator(TElementType & root_)
+	{
+		this->descend(root_);
+	}
+
+	reference operator*() const {
+		return *m_stack.back().element;
+	}
+
+	pointer operator->() const {
+		return m_stack.back().element;
+	}
+
+	PostorderIterator& operator++()
+	{
+		m_stack.pop_back();
+		if (!m_stack.empty())
+		{
+			// Continue with the next sibling's subtree, or visit the parent:
+			auto & parent = m_stack.back();
+			auto const & siblings = parent.element->getChildren();
+			if (++parent.nextChild < siblings.size())
+				this->descend(*siblings[parent.nextChild]);
+		}
+		return *this;
+	}
+
+	PostorderIterator operator++(int)
+	{
+		auto previous = *this;
+		++(*this);
+		return previous;
+	}
+
+	bool operator==(PostorderIterator const & other_) const
+	{
+		return m_stack.size() == other_.m_stack.size() && (m_stack.empty() || m_stack.back().element == other_.m_stack.back().element);
+	}
+
+private:
+	/// <summary>
+	/// Element on the path from the root to the current one.
+	/// </summary>
+	struct Entry
+	{
+		TElementType*	element;
+		std::size_t		nextChild;		// Index of the child whose subtree is visited now.
+	};
+
+	/// <summary>
+	/// Pushes the element and its first descendants down to the first leaf.
+	/// </summary>
+	/// <param name="element_">The element.</param>
+	void descend(TElementType & element_)
+	{
+		TElementType* element = &element_;
+		while (true)
+		{
+			m_stack.push_back({ element, 0 });
+			auto const & children = element->getChildren();
+			if (children.empty())
+				break;
+			element = children.front().get();
+		}
+	}
+
+	// Members:
+
+	std::vector<Entry> m_stack;		// Path from the root to the current element (at the back).
+};
+
+/// <summary>
+/// Range of iterators, usable in range-based for loops.
+/// </summary>
+template <typename TIterator>
+struct ElementRange
+{
+	TIterator first;
+	TIterator last;
+
+	TIterator begin() const {
+		return first;
+	}
+
+	TIterator end() const {
+		return last;
+	}
+};
+
+/// <summary>
+/// Returns range visiting the element and its descendants, parents first.
+/// </summary>
+/// <param name="root_">The root.</param>
+/// <returns>The range.</returns>
+inline ElementRange<PreorderIterator<Element>> preorder(Element & root_)
+{
+	return { PreorderIterator<Element>{ root_ }, PreorderIterator<Element>{} };
+}
+
+/// <summary>
+/// Returns range visiting the element and its descendants, parents first.
+/// </summary>
+/// <param name="root_">The root.</param>
+/// <returns>The range.</returns>
+inline ElementRange<PreorderIterator<Element const>> preorder(Element const & root_)
+{
+	return { PreorderIterator<Element const>{ root_ }, PreorderIterator<Element const>{} };
+}
+
+/// <summary>
+/// Returns range visiting the element and its descendants, children first.
+/// </summary>
+/// <param name="root_">The root.</param>
+/// <returns>The range.</returns>
+inline ElementRange<PostorderIterator<Element>> postorder(Element & root_)
+{
+	return { PostorderIterator<Element>{ root_ }, PostorderIterator<Element>{} };
+}
+
+/// <summary>
+/// Returns range visiting the element and its descendants, children first.
+/// </summary>
+/// <param name="root_">The root.</param>
+/// <returns>The range.</returns>
+inline ElementRange<PostorderIterator<Element const>> postorder(Element const & root_)
+{
+	return { PostorderIterator<Element const>{ root_ }, PostorderIterator<Element const>{} };
+}
+
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include SFMLUI_PCH
+
+#include <SFML-UI/Element.hpp>
+#include <SFML-UI/Graphics/TextureAtlas.hpp>
+
+namespace sfui
+{
+
+/// <summary>
+/// Displays single image stored in the <see cref="TextureAtlas"/>, optionally stretched as a nine-slice.
+/// </summary>
+/// <remarks>
+/// <para>Sprites sharing one atlas page are drawn with one draw call when placed inside a <see cref="TextBatch"/>.</para>
+/// </remarks>
+class AtlasSprite
+	: public Element
+{
+public:
+	// Nested types:
+
+	/// <summary>
+	/// Widths of the nine-slice borders (in pixels of the source image).
+	/// </summary>
+	struct Borders
+	{
+		float left		= 0.f;
+		float top		= 0.f;
+		float right		= 0.f;
+		float bottom	= 0.f;
+	};
+
+	// Methods:
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="AtlasSprite"/> class.
+	/// </summary>
+	/// <param name="atlas_">The texture atlas. Must outlive the sprite.</param>
+	/// <param name="region_">The atlas region.</param>
+	AtlasSprite(TextureAtlas & atlas_, TextureAtlas::RegionId const region_);
+
+	/// <summary>
+	/// Sets the displayed atlas region. Resets size to the size of the region.
+	/// </summary>
+	/// <param name="region_">The atlas region.</param>
+	void setRegion(TextureAtlas::RegionId const region_);
+
+	/// <summary>
+	/// Sets the displayed size. Only the center slice is stretched when borders are set.
+	/// </summary>
+	/// <param name="size_">The size.</param>
+	void setSize(sf::Vector2f const & size_);
+
+	/// <summary>
+	/// Sets the nine-slice borders. Zero borders draw the image as single quad.
+	/// </summary>
+	/// <param name="borders_">The borders.</param>
+	void setBorders(Borders const & borders_);
+
+	/// <summary>
+	/// Sets the sprite color.
+	/// </summary>
+	/// <param name="color_">The color.</param>
+	void setColor(sf::Color const color_);
+
+	/// <summary>
+	/// Returns the displayed atlas region.
+	/// </summary>
+	/// <returns>The displayed atlas region.</returns>
+	TextureAtlas::RegionId getRegion() const {
+		return m_region;
+	}
+
+	/// <summary>
+	/// Returns the displayed size.
+	/// </summary>
+	/// <returns>The displayed size.</returns>
+	sf::Vector2f getSize() const {
+		return m_size;
+	}
+
+	/// <summary>
+	/// Returns the nine-slice borders.
+	/// </summary>
+	/// <returns>The nine-slice borders.</returns>
+	Borders const& getBorders() const {
+		return m_borders;
+	}
+
+	/// <summary>
+	/// Returns the sprite color.
+	/// </summary>
+	/// <returns>The sprite color.</returns>
+	sf::Color getColor() const {
+		return m_color;
+	}
+
+protected:
+	// Methods:
+	// Overriden methods from Element:
+	/// <summary>
+	/// Draws the sprite (before children).
+	/// </summary>
+	/// <param name="target_">The target.</param>
+	/// <param name="states_">The render states, including the element's transform.</param>
+	virtual void drawSelf(sf::RenderTarget & target_, sf::RenderStates states_) const override;
+
+private:
+	/// <summary>
+	/// Rebuilds vertices if the region moved or any property changed.
+	/// </summary>
+	/// <returns>Current region location or std::nullopt if the region does not exist.</returns>
+	std::optional<TextureAtlas::Region> updateVertices() const;
+
+	// Members:
+
+	TextureAtlas*					m_atlas;
+	TextureAtlas::RegionId			m_region;
+	sf::Vector2f					m_size;
+	Borders							m_borders;
+	sf::Color						m_color;
+
+	mutable std::vector<sf::Vertex>	m_vertices;
+	mutable sf::IntRect				m_builtRect;		// Region rectangle the vertices were built with.
+	mutable bool					m_needsUpdate;
+};
+
+}
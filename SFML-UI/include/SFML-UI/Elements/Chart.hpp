@@ -0,0 +1,277 @@
+#pragma once
+
+#include SFMLUI_PCH
+
+#include <SFML-UI/Element.hpp>
+
+#include <span>
+
+namespace sfui
+{
+
+/// <summary>
+/// Displays time series (lines through points with ascending x) of any size.
+/// </summary>
+/// <remarks>
+/// <para>Points are kept in structure-of-arrays buffers (x and y separately). Every pixel column is drawn from at most
+/// four points: the first and the last one in the column, and its minimum and maximum. Min/max decimation keeps
+/// every spike visible, regardless of the zoom.</para>
+/// <para>Minima and maxima of blocks of 8, 64, 512... points are kept in a pyramid, updated on append in amortized
+/// constant time, so summary of any column takes O(log n). Column summaries are cached per series: panning
+/// only summarizes columns that came into view, appending only the columns touched by new points,
+/// changing the y range none at all. Zooming (changing the x scale) summarizes every visible column again.</para>
+/// <para>Changes are applied lazily, on next <see cref="update"/> or <see cref="refresh"/>.
+/// Lines are connected to the nearest points outside of the view, clip the chart with a view if needed.</para>
+/// </remarks>
+class Chart
+	: public Element
+{
+public:
+	// Constants:
+
+	static constexpr std::size_t PyramidFactorLog2 = 3;		// Every pyramid level summarizes 8 entries of the previous one.
+
+	// Methods:
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="Chart"/> class.
+	/// </summary>
+	Chart();
+
+	/// <summary>
+	/// Adds empty series.
+	/// </summary>
+	/// <param name="color_">The line color.</param>
+	/// <returns>Index of the series.</returns>
+	std::size_t addSeries(sf::Color const color_);
+
+	/// <summary>
+	/// Appends point to the series.
+	/// </summary>
+	/// <param name="series_">The series index.</param>
+	/// <param name="x_">The x (usually time). Throws std::invalid_argument when lower than x of the last point.</param>
+	/// <param name="y_">The value.</param>
+	void append(std::size_t const series_, double const x_, float const y_);
+
+	/// <summary>
+	/// Appends points to the series.
+	/// </summary>
+	/// <param name="series_">The series index.</param>
+	/// <param name="xs_">The x values, ascending. Throws std::invalid_argument when not.</param>
+	/// <param name="ys_">The values. Throws std::invalid_argument when size differs from size of xs_.</param>
+	void append(std::size_t const series_, std::span<double const> const xs_, std::span<float const> const ys_);
+
+	/// <summary>
+	/// Removes every point of the series.
+	/// </summary>
+	/// <param name="series_">The series index.</param>
+	void clearSeries(std::size_t const series_);
+
+	/// <summary>
+	/// Sets the chart size (the plot area, in pixels). Visible ranges are kept (stretched).
+	/// </summary>
+	/// <param name="size_">The size.</param>
+	void setSize(sf::Vector2f const & size_);
+
+	/// <summary>
+	/// Sets visible range of x.
+	/// </summary>
+	/// <param name="min_">The x at the left edge.</param>
+	/// <param name="max_">The x at the right edge. Throws std::invalid_argument when not greater than min_.</param>
+	void setXRange(double const min_, double const max_);
+
+	/// <summary>
+	/// Sets visible range of values.
+	/// </summary>
+	/// <param name="min_">The value at the bottom edge.</param>
+	/// <param name="max_">The value at the top edge. Throws std::invalid_argument when not greater than min_.</param>
+	void setYRange(float const min_, float const max_);
+
+	/// <summary>
+	/// Moves the visible x range, keeping the scale (so cached columns can be reused).
+	/// </summary>
+	/// <param name="delta_">The x distance.</param>
+	void pan(double const delta_);
+
+	/// <summary>
+	/// Scales the visible x range around specified x.
+	/// </summary>
+	/// <param name="factor_">The factor (greater than 1 zooms in). Throws std::invalid_argument when not positive.</param>
+	/// <param name="anchor_">The x that stays in place.</param>
+	void zoom(double const factor_, double const anchor_);
+
+	/// <summary>
+	/// Sets the x range to span points of every series.
+	/// </summary>
+	void fitX();
+
+	/// <summary>
+	/// Sets the value range to span values visible in the current x range.
+	/// </summary>
+	void fitY();
+
+	/// <summary>
+	/// Applies pending changes: summarizes columns that are not cached and builds the vertices.
+	/// </summary>
+	void refresh();
+
+	/// <summary>
+	/// Returns x values of the series.
+	/// </summary>
+	/// <param name="series_">The series index.</param>
+	/// <returns>The x values.</returns>
+	std::span<double const> getX(std::size_t const series_) const {
+		return m_series.at(series_).x;
+	}
+
+	/// <summary>
+	/// Returns values of the series.
+	/// </summary>
+	/// <param name="series_">The series index.</param>
+	/// <returns>The values.</returns>
+	std::span<float const> getY(std::size_t const series_) const {
+		return m_series.at(series_).y;
+	}
+
+	/// <summary>
+	/// Returns number of series.
+	/// </summary>
+	/// <returns>Number of series.</returns>
+	std::size_t getSeriesCount() const {
+		return m_series.size();
+	}
+
+	/// <summary>
+	/// Returns the x at the left edge.
+	/// </summary>
+	/// <returns>The x at the left edge.</returns>
+	double getXMin() const {
+		return m_xMin;
+	}
+
+	/// <summary>
+	/// Returns the x at the right edge.
+	/// </summary>
+	/// <returns>The x at the right edge.</returns>
+	double getXMax() const {
+		return m_xMin + m_xSpan;
+	}
+
+	/// <summary>
+	/// Returns the visible value range.
+	/// </summary>
+	/// <returns>The value at the bottom and the top edge.</returns>
+	std::pair<float, float> getYRange() const {
+		return { m_yMin, m_yMax };
+	}
+
+	/// <summary>
+	/// Returns number of column summaries computed so far (cached ones are not counted again).
+	/// </summary>
+	/// <returns>Number of computed column summaries.</returns>
+	std::size_t getSummarizedColumnCount() const {
+		return m_summarizedColumnCount;
+	}
+
+	/// <summary>
+	/// Returns number of vertices built by last refresh.
+	/// </summary>
+	/// <returns>Number of vertices.</returns>
+	std::size_t getVertexCount() const {
+		return m_vertices.size();
+	}
+
+protected:
+	// Methods:
+	// Overriden methods from Element:
+	/// <summary>
+	/// Applies pending changes (before children are updated).
+	/// </summary>
+	/// <param name="deltaTime_">Time that passed since previous frame.</param>
+	/// <param name="frameTime_">The frame start time.</param>
+	virtual void updateSelf(double const deltaTime_, TimePoint const & frameTime_) override;
+
+	/// <summary>
+	/// Draws the series (before children).
+	/// </summary>
+	/// <param name="target_">The target.</param>
+	/// <param name="states_">The render states, including the element's transform.</param>
+	virtual void drawSelf(sf::RenderTarget & target_, sf::RenderStates states_) const override;
+
+private:
+	/// <summary>
+	/// Points of one pixel column.
+	/// </summary>
+	struct ColumnSummary
+	{
+		std::size_t	begin;		// First point in the column.
+		std::size_t	end;		// One past the last point in the column.
+		float		min;
+		float		max;
+	};
+
+	/// <summary>
+	/// Points, their pyramid and cached column summaries.
+	/// </summary>
+	struct Series
+	{
+		std::vector<double>				x;
+		std::vector<float>				y;
+		std::vector<std::vector<float>>	minLevels;		// minLevels[k][i] - minimum of points [i * 8^(k+1), (i + 1) * 8^(k+1)). Complete blocks only.
+		std::vector<std::vector<float>>	maxLevels;		// Same for maxima.
+		sf::Color						color;
+
+		std::vector<ColumnSummary>		columns;		// Cached summaries of columns [firstColumn, firstColumn + columns.size()).
+		std::int64_t					firstColumn	= 0;
+		double							columnWidth	= 0;	// X per pixel the cache was computed for.
+		std::size_t						dirtyFrom	= 0;	// Points from this index were appended after the cache was computed.
+	};
+
+	/// <summary>
+	/// Adds the last point of the series to the pyramid.
+	/// </summary>
+	/// <param name="series_">The series.</param>
+	static void updatePyramid(Series & series_);
+
+	/// <summary>
+	/// Returns minimum and maximum of points in range, using the pyramid.
+	/// </summary>
+	/// <param name="series_">The series.</param>
+	/// <param name="begin_">The first point.</param>
+	/// <param name="end_">One past the last point.</param>
+	/// <returns>Minimum and maximum.</returns>
+	static std::pair<float, float> findMinMax(Series const & series_, std::size_t begin_, std::size_t end_);
+
+	/// <summary>
+	/// Brings cached column summaries of the series to the visible column range.
+	/// </summary>
+	/// <param name="series_">The series.</param>
+	/// <param name="columnWidth_">The x per pixel.</param>
+	/// <param name="firstColumn_">The first visible column (column c spans x from c * columnWidth_ to (c + 1) * columnWidth_).</param>
+	/// <param name="endColumn_">One past the last visible column.</param>
+	void updateColumns(Series & series_, double const columnWidth_, std::int64_t const firstColumn_, std::int64_t const endColumn_);
+
+	/// <summary>
+	/// Returns the series.
+	/// </summary>
+	/// <param name="series_">The series index. Throws std::out_of_range when invalid.</param>
+	/// <returns>The series.</returns>
+	Series& getSeries(std::size_t const series_);
+
+	// Members:
+
+	std::vector<Series>			m_series;
+	std::vector<ColumnSummary>	m_scratchColumns;			// Reused storage for column updates.
+
+	sf::Vector2f				m_size;
+	double						m_xMin;
+	double						m_xSpan;					// Visible x range width. Kept by panning, so column width and cached columns stay valid.
+	float						m_yMin;
+	float						m_yMax;
+
+	std::vector<sf::Vertex>		m_vertices;					// Line segments of every series.
+	std::size_t					m_summarizedColumnCount;
+	bool						m_needsRefresh;
+};
+
+}
@@ -0,0 +1,291 @@
+#pragma once
+
+#include SFMLUI_PCH
+
+#include <SFML-UI/Element.hpp>
+#include <SFML-UI/Core/PrefixSumIndex.hpp>
+
+#include <functional>
+#include <optional>
+
+namespace sfui
+{
+
+/// <summary>
+/// Table of (possibly) huge number of rows and columns that keeps cell elements only for the visible cells.
+/// </summary>
+/// <remarks>
+/// <para>Works like <see cref="VirtualList"/> in both directions: cell elements are created for the visible range
+/// (plus overscan), bound to cells, and rebound to other cells when they scroll out of view.
+/// Cell elements are shared by columns of the same kind (see <see cref="setColumnKind"/>), so columns that need
+/// different element types must have different kinds.</para>
+/// <para>Sorting and filtering never touch the data: the grid displays data rows through a permutation of their indices.
+/// Sorted permutation of all rows is kept separately from the filtered one, so changing the filter does not sort again.</para>
+/// <para>Rows share one height, columns may have different widths (see <see cref="PrefixSumIndex"/>).
+/// Changes are applied lazily, on next <see cref="update"/> or <see cref="refresh"/>.
+/// Cell elements are placed with their top-left corner relative to the grid.</para>
+/// </remarks>
+class DataGrid
+	: public Element
+{
+public:
+	// Aliases:
+
+	using CellFactoryType	= std::function< ElementPtrType(std::size_t const column_) >;
+	using CellBinderType	= std::function< void(Element & cell_, std::size_t const row_, std::size_t const column_) >;
+	using RowComparerType	= std::function< bool(std::size_t const lhsRow_, std::size_t const rhsRow_) >;
+	using RowFilterType		= std::function< bool(std::size_t const row_) >;
+
+	// Methods:
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="DataGrid"/> class.
+	/// </summary>
+	/// <param name="factory_">Creates cell element for the column (it must be able to display any cell of columns of the same kind).</param>
+	/// <param name="binder_">Makes the cell element display specified data row and column.</param>
+	DataGrid(CellFactoryType factory_, CellBinderType binder_);
+
+	/// <summary>
+	/// Sets size of the visible area.
+	/// </summary>
+	/// <param name="size_">The size.</param>
+	void setViewportSize(sf::Vector2f const & size_);
+
+	/// <summary>
+	/// Sets number of rows and columns kept bound around the visible area.
+	/// </summary>
+	/// <param name="rows_">The number of rows above and below.</param>
+	/// <param name="columns_">The number of columns on the left and right.</param>
+	void setOverscan(std::size_t const rows_, std::size_t const columns_);
+
+	/// <summary>
+	/// Changes number of data rows. Sort and filter are applied again.
+	/// </summary>
+	/// <param name="count_">The number of rows. Throws std::length_error when larger than 2^32 - 1.</param>
+	void setRowCount(std::size_t const count_);
+
+	/// <summary>
+	/// Sets height of every row.
+	/// </summary>
+	/// <param name="height_">The height.</param>
+	void setRowHeight(float const height_);
+
+	/// <summary>
+	/// Changes number of columns. Existing columns keep their widths.
+	/// </summary>
+	/// <param name="count_">The number of columns.</param>
+	/// <param name="width_">The width of added columns.</param>
+	void setColumnCount(std::size_t const count_, float const width_);
+
+	/// <summary>
+	/// Changes width of the column.
+	/// </summary>
+	/// <param name="column_">The column. Throws std::out_of_range when not lower than column count.</param>
+	/// <param name="width_">The width.</param>
+	void setColumnWidth(std::size_t const column_, float const width_);
+
+	/// <summary>
+	/// Sets kind of the column. Cell elements are only reused by columns of the same kind. Every column has kind 0 by default.
+	/// </summary>
+	/// <param name="column_">The column. Throws std::out_of_range when not lower than column count.</param>
+	/// <param name="kind_">The kind (small number, used as index).</param>
+	void setColumnKind(std::size_t const column_, std::size_t const kind_);
+
+	/// <summary>
+	/// Sorts displayed rows (stable, starting from data order).
+	/// </summary>
+	/// <param name="comparer_">Determines whether data row should be displayed before another one.</param>
+	void sortBy(RowComparerType comparer_);
+
+	/// <summary>
+	/// Displays rows in data order.
+	/// </summary>
+	void clearSort();
+
+	/// <summary>
+	/// Displays only rows accepted by the filter.
+	/// </summary>
+	/// <param name="filter_">Determines whether data row should be displayed.</param>
+	void filterBy(RowFilterType filter_);
+
+	/// <summary>
+	/// Displays every row.
+	/// </summary>
+	void clearFilter();
+
+	/// <summary>
+	/// Notifies the grid that data changed: sort and filter are applied again and every bound cell is bound again.
+	/// </summary>
+	void invalidateData();
+
+	/// <summary>
+	/// Sets the scroll offset (distance from the top-left corner of the first cell to the top-left corner of the viewport).
+	/// </summary>
+	/// <param name="offset_">The offset. Clamped to the scrollable range (as of last refresh for rows).</param>
+	void setScrollOffset(sf::Vector2<double> const & offset_);
+
+	/// <summary>
+	/// Moves the scroll offset.
+	/// </summary>
+	/// <param name="delta_">The distance.</param>
+	void scrollBy(sf::Vector2<double> const & delta_);
+
+	/// <summary>
+	/// Applies pending changes: sorts, filters, binds and places cell elements for current scroll offset.
+	/// </summary>
+	void refresh();
+
+	/// <summary>
+	/// Returns element bound to the cell (as of last refresh).
+	/// </summary>
+	/// <param name="viewRow_">The displayed row index (position in sorted and filtered rows).</param>
+	/// <param name="column_">The column.</param>
+	/// <returns>The element; <c>nullptr</c> if the cell is not bound.</returns>
+	Element* getCellElement(std::size_t const viewRow_, std::size_t const column_) const;
+
+	/// <summary>
+	/// Finds the cell at specified point.
+	/// </summary>
+	/// <param name="point_">The point relative to the top-left corner of the viewport (in grid's local coordinates).</param>
+	/// <returns>Displayed row index and column; <c>std::nullopt</c> if there is no cell there.</returns>
+	std::optional<std::pair<std::size_t, std::size_t>> findCellAt(sf::Vector2f const & point_) const;
+
+	/// <summary>
+	/// Returns data row displayed at specified position (as of last refresh).
+	/// </summary>
+	/// <param name="viewRow_">The displayed row index.</param>
+	/// <returns>The data row index.</returns>
+	std::size_t getDataRow(std::size_t const viewRow_) const {
+		return m_viewRows[viewRow_];
+	}
+
+	/// <summary>
+	/// Returns number of displayed rows (as of last refresh).
+	/// </summary>
+	/// <returns>Number of displayed rows.</returns>
+	std::size_t getViewRowCount() const {
+		return m_viewRows.size();
+	}
+
+	/// <summary>
+	/// Returns number of data rows.
+	/// </summary>
+	/// <returns>Number of data rows.</returns>
+	std::size_t getRowCount() const {
+		return m_rowCount;
+	}
+
+	/// <summary>
+	/// Returns number of columns.
+	/// </summary>
+	/// <returns>Number of columns.</returns>
+	std::size_t getColumnCount() const {
+		return m_columnWidths.getSize();
+	}
+
+	/// <summary>
+	/// Returns the scroll offset.
+	/// </summary>
+	/// <returns>The scroll offset.</returns>
+	sf::Vector2<double> const& getScrollOffset() const {
+		return m_scrollOffset;
+	}
+
+	/// <summary>
+	/// Returns size of all displayed cells (as of last refresh).
+	/// </summary>
+	/// <returns>Size of all displayed cells.</returns>
+	sf::Vector2<double> getContentSize() const {
+		return { m_columnWidths.getTotal(), static_cast<double>(m_viewRows.size()) * m_rowHeight };
+	}
+
+	/// <summary>
+	/// Returns number of cell elements created by the factory so far.
+	/// </summary>
+	/// <returns>Number of created cell elements.</returns>
+	std::size_t getCreatedCellElementCount() const {
+		return m_createdCellElementCount;
+	}
+
+	/// <summary>
+	/// Returns number of binder calls so far.
+	/// </summary>
+	/// <returns>Number of binder calls.</returns>
+	std::size_t getBindCount() const {
+		return m_bindCount;
+	}
+
+protected:
+	// Methods:
+	// Overriden methods from Element:
+	/// <summary>
+	/// Applies pending changes (before children are updated).
+	/// </summary>
+	/// <param name="deltaTime_">Time that passed since previous frame.</param>
+	/// <param name="frameTime_">The frame start time.</param>
+	virtual void updateSelf(double const deltaTime_, TimePoint const & frameTime_) override;
+
+private:
+	// Aliases:
+
+	using RowIndexType = std::uint32_t;
+
+	/// <summary>
+	/// Element bound to a cell.
+	/// </summary>
+	struct BoundCell
+	{
+		ElementPtrType	element;
+		RowIndexType	dataRow		= 0;
+		bool			needsBind	= false;	// Data changed since the element was bound.
+	};
+
+	/// <summary>
+	/// Rebuilds sorted and filtered row permutations, if needed.
+	/// </summary>
+	void updateView();
+
+	/// <summary>
+	/// Takes a cell element for the column: released one, spare one (of the same kind) or a new one.
+	/// </summary>
+	/// <param name="column_">The column.</param>
+	/// <returns>Attached cell element.</returns>
+	ElementPtrType acquireCellElement(std::size_t const column_);
+
+	// Members:
+
+	CellFactoryType				m_factory;
+	CellBinderType				m_binder;
+	RowComparerType				m_comparer;
+	RowFilterType				m_filter;
+
+	std::size_t					m_rowCount;
+	float						m_rowHeight;
+	PrefixSumIndex				m_columnWidths;
+	std::vector<std::size_t>	m_columnKinds;
+	std::vector<RowIndexType>	m_sortedRows;				// Every data row, in display order.
+	std::vector<RowIndexType>	m_viewRows;					// Displayed data rows (m_sortedRows accepted by the filter).
+
+	sf::Vector2<double>			m_scrollOffset;
+	sf::Vector2f				m_viewportSize;
+	std::size_t					m_rowOverscan;
+	std::size_t					m_columnOverscan;
+
+	std::size_t					m_firstBoundRow;			// Displayed row of the first bound cell.
+	std::size_t					m_firstBoundColumn;			// Column of the first bound cell.
+	std::size_t					m_boundRowCount;
+	std::size_t					m_boundColumnCount;
+	std::vector<BoundCell>		m_boundCells;				// Row-major cells of the bound range.
+	std::vector<BoundCell>		m_scratchCells;				// Reused storage for refresh.
+
+	std::vector<std::vector<ElementPtrType>>	m_releasedCellElements;	// Per column kind: attached elements released by current refresh.
+	std::vector<std::vector<ElementPtrType>>	m_spareCellElements;	// Per column kind: detached elements, left over when fewer cells were bound.
+
+	std::size_t					m_createdCellElementCount;
+	std::size_t					m_bindCount;
+	bool						m_needsSort;
+	bool						m_needsFilter;
+	bool						m_needsRefresh;
+};
+
+}
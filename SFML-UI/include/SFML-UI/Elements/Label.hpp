@@ -0,0 +1,135 @@
+#pragma once
+
+#include SFMLUI_PCH
+
+#include <SFML-UI/Element.hpp>
+#include <SFML-UI/Graphics/TextRunCache.hpp>
+
+namespace sfui
+{
+
+/// <summary>
+/// Displays single run of text.
+/// </summary>
+/// <remarks>
+/// <para>Laid out glyphs are shared through <see cref="TextRunCache"/>.</para>
+/// <para>When drawn inside <see cref="TextBatch"/>, glyphs are appended to the batch instead of being drawn separately.</para>
+/// </remarks>
+class Label
+	: public Element
+{
+public:
+	// Methods:
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="Label"/> class.
+	/// </summary>
+	Label();
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="Label"/> class.
+	/// </summary>
+	/// <param name="font_">The font.</param>
+	/// <param name="characterSize_">The character size.</param>
+	/// <param name="string_">The string.</param>
+	Label(sf::Font const & font_, unsigned const characterSize_, sf::String const & string_ = sf::String{});
+
+	/// <summary>
+	/// Sets the displayed string.
+	/// </summary>
+	/// <param name="string_">The string.</param>
+	void setString(sf::String const & string_);
+
+	/// <summary>
+	/// Sets the font.
+	/// </summary>
+	/// <param name="font_">The font.</param>
+	void setFont(sf::Font const & font_);
+
+	/// <summary>
+	/// Sets the character size.
+	/// </summary>
+	/// <param name="characterSize_">The character size.</param>
+	void setCharacterSize(unsigned const characterSize_);
+
+	/// <summary>
+	/// Sets the text color.
+	/// </summary>
+	/// <param name="color_">The color.</param>
+	void setColor(sf::Color const color_);
+
+	/// <summary>
+	/// Sets the run cache used by this label.
+	/// </summary>
+	/// <param name="cache_">The cache.</param>
+	void setRunCache(TextRunCache & cache_);
+
+	/// <summary>
+	/// Returns the displayed string.
+	/// </summary>
+	/// <returns>Displayed string.</returns>
+	sf::String const& getString() const {
+		return m_string;
+	}
+
+	/// <summary>
+	/// Returns the font.
+	/// </summary>
+	/// <returns>The font or nullptr if not set.</returns>
+	sf::Font const* getFont() const {
+		return m_font;
+	}
+
+	/// <summary>
+	/// Returns the character size.
+	/// </summary>
+	/// <returns>The character size.</returns>
+	unsigned getCharacterSize() const {
+		return m_characterSize;
+	}
+
+	/// <summary>
+	/// Returns the text color.
+	/// </summary>
+	/// <returns>The text color.</returns>
+	sf::Color getColor() const {
+		return m_color;
+	}
+
+	/// <summary>
+	/// Returns the local bounds of the text.
+	/// </summary>
+	/// <returns>Local bounds of the text.</returns>
+	sf::FloatRect getLocalBounds() const;
+
+protected:
+	// Methods:
+	// Overriden methods from Element:
+	/// <summary>
+	/// Draws the label (before children).
+	/// </summary>
+	/// <param name="target_">The target.</param>
+	/// <param name="states_">The render states, including the element's transform.</param>
+	virtual void drawSelf(sf::RenderTarget & target_, sf::RenderStates states_) const override;
+
+private:
+	/// <summary>
+	/// Acquires the run matching current font, size and string.
+	/// </summary>
+	void updateRun();
+
+	// Members:
+
+	sf::String					m_string;
+	sf::Font const*				m_font;
+	unsigned					m_characterSize;
+	sf::Color					m_color;
+
+	TextRunCache*				m_runCache;				// Cache the run is acquired from.
+	TextRunCache::RunPtrType	m_run;					// Laid out text, shared with every label displaying the same text.
+
+	mutable std::vector<sf::Vertex>	m_coloredVertices;		// Colored copy of the run, used when drawn outside of a batch with non-white color.
+	mutable bool					m_needsColorUpdate;
+};
+
+}
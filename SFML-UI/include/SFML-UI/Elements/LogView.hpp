@@ -0,0 +1,288 @@
+#pragma once
+
+#include SFMLUI_PCH
+
+#include <SFML-UI/Element.hpp>
+#include <SFML-UI/Core/PrefixSumIndex.hpp>
+
+#include <array>
+
+namespace sfui
+{
+
+/// <summary>
+/// Displays stream of text lines (e.g. live log), keeping only the newest ones within fixed line and byte limits.
+/// </summary>
+/// <remarks>
+/// <para>Lines are stored in ring buffers: text bytes (UTF-8) in one preallocated buffer, line records in another.
+/// Appending never allocates; when either buffer is full, the oldest lines are dropped.</para>
+/// <para>Lines are wrapped to the width (at spaces when possible). Appended lines are wrapped once, on append.
+/// After width or font change, line heights are estimated and exact wrapping is computed only for the visible lines
+/// and then for a limited number of lines per update (see <see cref="setWrapBudget"/>). Row offsets of lines are kept
+/// in <see cref="PrefixSumIndex"/> over ring slots.</para>
+/// <para>Only rows inside the viewport are laid out, into one vertex array drawn with a single draw call.
+/// Kerning is ignored (logs are usually displayed with monospace fonts).</para>
+/// <para>When scrolled to the bottom, the view follows appended lines. Otherwise it stays anchored to its top line.
+/// Changes are applied lazily, on next <see cref="update"/> or <see cref="refresh"/>.</para>
+/// </remarks>
+class LogView
+	: public Element
+{
+public:
+	// Methods:
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="LogView"/> class.
+	/// </summary>
+	/// <param name="font_">The font. Must outlive the view.</param>
+	/// <param name="characterSize_">The character size.</param>
+	/// <param name="lineCapacity_">The maximal number of kept lines. Throws std::invalid_argument when 0.</param>
+	/// <param name="byteBudget_">The maximal number of kept text bytes (longer lines are truncated). Throws std::invalid_argument when 0 or not lower than 2^32.</param>
+	LogView(sf::Font const & font_, unsigned const characterSize_, std::size_t const lineCapacity_, std::size_t const byteBudget_);
+
+	/// <summary>
+	/// Appends text. Every '\n' starts new line (trailing one does not add empty line), '\r' characters are ignored.
+	/// </summary>
+	/// <param name="text_">The text (UTF-8).</param>
+	/// <param name="color_">The text color.</param>
+	void append(std::string_view const text_, sf::Color const color_ = sf::Color::White);
+
+	/// <summary>
+	/// Removes every line.
+	/// </summary>
+	void clear();
+
+	/// <summary>
+	/// Sets the font.
+	/// </summary>
+	/// <param name="font_">The font. Must outlive the view.</param>
+	/// <param name="characterSize_">The character size.</param>
+	void setFont(sf::Font const & font_, unsigned const characterSize_);
+
+	/// <summary>
+	/// Sets size of the visible area. Lines are wrapped to its width (0 disables wrapping).
+	/// </summary>
+	/// <param name="size_">The size.</param>
+	void setViewportSize(sf::Vector2f const & size_);
+
+	/// <summary>
+	/// Sets number of lines wrapped again (after width or font change) per update, besides the visible ones.
+	/// </summary>
+	/// <param name="lines_">The number of lines.</param>
+	void setWrapBudget(std::size_t const lines_);
+
+	/// <summary>
+	/// Moves the view.
+	/// </summary>
+	/// <param name="delta_">The distance, in pixels (positive scrolls down, towards newer lines).</param>
+	void scrollBy(double const delta_);
+
+	/// <summary>
+	/// Scrolls so the line is at the top of the viewport.
+	/// </summary>
+	/// <param name="lineNumber_">The line number (see <see cref="getFirstLineNumber"/>). Clamped to kept lines.</param>
+	void scrollToLine(std::uint64_t const lineNumber_);
+
+	/// <summary>
+	/// Scrolls to the newest line and follows appended lines.
+	/// </summary>
+	void scrollToBottom();
+
+	/// <summary>
+	/// Applies pending changes: wraps what is needed and lays out visible rows.
+	/// </summary>
+	void refresh();
+
+	/// <summary>
+	/// Returns text of the line.
+	/// </summary>
+	/// <param name="lineNumber_">The line number. Throws std::out_of_range when the line is not kept.</param>
+	/// <returns>The text (valid until next append).</returns>
+	std::string_view getLine(std::uint64_t const lineNumber_) const;
+
+	/// <summary>
+	/// Returns number of the oldest kept line. Lines are numbered from 0 since construction (or last clear).
+	/// </summary>
+	/// <returns>Number of the oldest kept line.</returns>
+	std::uint64_t getFirstLineNumber() const {
+		return m_firstLine;
+	}
+
+	/// <summary>
+	/// Returns number of kept lines.
+	/// </summary>
+	/// <returns>Number of kept lines.</returns>
+	std::size_t getLineCount() const {
+		return m_lineCount;
+	}
+
+	/// <summary>
+	/// Returns number of the line displayed at the top of the viewport (as of last refresh).
+	/// </summary>
+	/// <returns>Number of the top line.</returns>
+	std::uint64_t getTopLineNumber() const {
+		return m_topLine;
+	}
+
+	/// <summary>
+	/// Returns number of text bytes of kept lines.
+	/// </summary>
+	/// <returns>Number of text bytes.</returns>
+	std::size_t getByteSize() const {
+		return m_byteSize;
+	}
+
+	/// <summary>
+	/// Returns number of rows of all kept lines (some of them may be estimated, see remarks).
+	/// </summary>
+	/// <returns>Number of rows.</returns>
+	std::uint64_t getRowCount() const {
+		return static_cast<std::uint64_t>(m_rowOffsets.getTotal());
+	}
+
+	/// <summary>
+	/// Determines whether the view follows appended lines.
+	/// </summary>
+	/// <returns>
+	///		<c>true</c> if the view is scrolled to the bottom; otherwise, <c>false</c>.
+	/// </returns>
+	bool isFollowingTail() const {
+		return m_followTail;
+	}
+
+	/// <summary>
+	/// Returns number of glyphs laid out by last refresh.
+	/// </summary>
+	/// <returns>Number of glyphs.</returns>
+	std::size_t getVisibleGlyphCount() const {
+		return m_vertices.size() / 6;
+	}
+
+protected:
+	// Methods:
+	// Overriden methods from Element:
+	/// <summary>
+	/// Applies pending changes (before children are updated).
+	/// </summary>
+	/// <param name="deltaTime_">Time that passed since previous frame.</param>
+	/// <param name="frameTime_">The frame start time.</param>
+	virtual void updateSelf(double const deltaTime_, TimePoint const & frameTime_) override;
+
+	/// <summary>
+	/// Draws the visible rows (before children).
+	/// </summary>
+	/// <param name="target_">The target.</param>
+	/// <param name="states_">The render states, including the element's transform.</param>
+	virtual void drawSelf(sf::RenderTarget & target_, sf::RenderStates states_) const override;
+
+private:
+	/// <summary>
+	/// Kept line.
+	/// </summary>
+	struct Line
+	{
+		std::uint32_t	offset;			// Position of the text in m_bytes.
+		std::uint32_t	length;
+		std::uint32_t	rows;			// Number of rows (estimated unless wrapGeneration is current).
+		std::uint32_t	wrapGeneration;	// Value of m_wrapGeneration when rows were computed exactly.
+		sf::Color		color;
+	};
+
+	/// <summary>
+	/// Appends one line, dropping the oldest ones to make room.
+	/// </summary>
+	/// <param name="text_">The text without line breaks.</param>
+	/// <param name="color_">The color.</param>
+	void appendLine(std::string_view text_, sf::Color const color_);
+
+	/// <summary>
+	/// Drops the oldest line.
+	/// </summary>
+	void dropFirstLine();
+
+	/// <summary>
+	/// Returns record of kept line.
+	/// </summary>
+	/// <param name="lineNumber_">The line number.</param>
+	/// <returns>The record.</returns>
+	Line& getRecord(std::uint64_t const lineNumber_) {
+		return m_lines[lineNumber_ % m_lines.size()];
+	}
+
+	/// <summary>
+	/// Wraps the line exactly (if not done for current width and font yet).
+	/// </summary>
+	/// <param name="lineNumber_">The line number.</param>
+	/// <returns>Number of rows of the line.</returns>
+	std::uint32_t wrapExactly(std::uint64_t const lineNumber_);
+
+	/// <summary>
+	/// Estimates rows of every line after width or font change.
+	/// </summary>
+	void estimateRows();
+
+	/// <summary>
+	/// Returns number of rows of lines older than the specified one.
+	/// </summary>
+	/// <param name="lineNumber_">The line number (first line number + line count is allowed).</param>
+	/// <returns>Number of rows.</returns>
+	double getRowOffset(std::uint64_t const lineNumber_) const;
+
+	/// <summary>
+	/// Finds the line containing specified row.
+	/// </summary>
+	/// <param name="row_">The row (counted from the first row of the oldest line).</param>
+	/// <returns>The line number and row inside of the line.</returns>
+	std::pair<std::uint64_t, std::uint32_t> findRow(double const row_) const;
+
+	/// <summary>
+	/// Returns advance of the code point.
+	/// </summary>
+	/// <param name="codePoint_">The code point.</param>
+	/// <returns>The advance.</returns>
+	float getAdvance(std::uint32_t const codePoint_) const;
+
+	/// <summary>
+	/// Returns glyph of the code point.
+	/// </summary>
+	/// <param name="codePoint_">The code point.</param>
+	/// <returns>The glyph.</returns>
+	sf::Glyph const& getGlyph(std::uint32_t const codePoint_) const;
+
+	/// <summary>
+	/// Lays out rows visible from the top line.
+	/// </summary>
+	void layoutRows();
+
+	// Members:
+
+	sf::Font const*				m_font;
+	unsigned					m_characterSize;
+	float						m_lineSpacing;
+	std::array<sf::Glyph, 128>	m_asciiGlyphs;			// Glyphs of ASCII characters (the common case), looked up once per font.
+	std::array<float, 128>		m_asciiAdvances;		// Advances of ASCII characters (tab is four spaces wide).
+
+	std::vector<char>			m_bytes;				// Ring buffer of line texts. Text of a line is never split, unused tail is skipped instead.
+	std::uint32_t				m_writeOffset;			// Where the next line's text goes.
+	std::size_t					m_byteSize;
+
+	std::vector<Line>			m_lines;				// Ring buffer of lines, indexed by line number modulo capacity.
+	std::uint64_t				m_firstLine;
+	std::size_t					m_lineCount;
+	PrefixSumIndex				m_rowOffsets;			// Rows of every ring slot (0 for empty ones).
+
+	sf::Vector2f				m_viewportSize;
+	std::uint32_t				m_wrapGeneration;		// Incremented when width or font changes.
+	std::uint64_t				m_wrapCursor;			// Next line to wrap exactly in the background.
+	std::size_t					m_wrapBudget;
+
+	bool						m_followTail;
+	double						m_pendingScroll;		// Scroll distance (in pixels) not applied yet.
+	std::uint64_t				m_topLine;				// Line at the top of the viewport (when not following the tail).
+	std::uint32_t				m_topRow;				// Row of the top line displayed at the top of the viewport.
+	bool						m_needsRefresh;
+
+	std::vector<sf::Vertex>		m_vertices;				// Glyphs of visible rows.
+};
+
+}
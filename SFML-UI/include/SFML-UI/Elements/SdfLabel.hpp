@@ -0,0 +1,112 @@
+#pragma once
+
+#include SFMLUI_PCH
+
+#include <SFML-UI/Element.hpp>
+#include <SFML-UI/Graphics/SdfGlyphAtlas.hpp>
+#include <SFML-UI/Graphics/TextRunCache.hpp>
+
+namespace sfui
+{
+
+/// <summary>
+/// Displays single run of text using signed distance field glyphs.
+/// </summary>
+/// <remarks>
+/// <para>Unlike <see cref="Label"/>, text stays sharp at every character size and scale without rasterizing the font again.</para>
+/// <para>Glyphs that are not generated yet are skipped, and the text is laid out again once they are ready.</para>
+/// </remarks>
+class SdfLabel
+	: public Element
+{
+public:
+	// Methods:
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="SdfLabel"/> class.
+	/// </summary>
+	/// <param name="atlas_">The glyph atlas. Must outlive the label.</param>
+	/// <param name="characterSize_">The character size.</param>
+	/// <param name="string_">The string.</param>
+	SdfLabel(SdfGlyphAtlas & atlas_, float const characterSize_, sf::String const & string_ = sf::String{});
+
+	/// <summary>
+	/// Sets the displayed string.
+	/// </summary>
+	/// <param name="string_">The string.</param>
+	void setString(sf::String const & string_);
+
+	/// <summary>
+	/// Sets the character size. Does not require any rasterization.
+	/// </summary>
+	/// <param name="characterSize_">The character size.</param>
+	void setCharacterSize(float const characterSize_);
+
+	/// <summary>
+	/// Sets the text color.
+	/// </summary>
+	/// <param name="color_">The color.</param>
+	void setColor(sf::Color const color_);
+
+	/// <summary>
+	/// Returns the displayed string.
+	/// </summary>
+	/// <returns>Displayed string.</returns>
+	sf::String const& getString() const {
+		return m_string;
+	}
+
+	/// <summary>
+	/// Returns the character size.
+	/// </summary>
+	/// <returns>The character size.</returns>
+	float getCharacterSize() const {
+		return m_characterSize;
+	}
+
+	/// <summary>
+	/// Returns the text color.
+	/// </summary>
+	/// <returns>The text color.</returns>
+	sf::Color getColor() const {
+		return m_color;
+	}
+
+	/// <summary>
+	/// Returns the local bounds of the text.
+	/// </summary>
+	/// <returns>Local bounds of the text.</returns>
+	sf::FloatRect getLocalBounds() const;
+
+protected:
+	// Methods:
+	// Overriden methods from Element:
+	/// <summary>
+	/// Draws the label (before children).
+	/// </summary>
+	/// <param name="target_">The target.</param>
+	/// <param name="states_">The render states, including the element's transform.</param>
+	virtual void drawSelf(sf::RenderTarget & target_, sf::RenderStates states_) const override;
+
+private:
+	/// <summary>
+	/// Lays out glyphs if anything changed since the last layout.
+	/// </summary>
+	void updateLayout() const;
+
+	// Members:
+
+	SdfGlyphAtlas*						m_atlas;
+	sf::String							m_string;
+	float								m_characterSize;
+	sf::Color							m_color;
+
+	mutable std::vector<TextRun>		m_runs;					// One run per atlas page.
+	mutable std::vector<std::size_t>	m_usedPages;			// Atlas pages referenced by the layout, marked used on every draw.
+	mutable sf::FloatRect				m_bounds;
+	mutable std::uint64_t				m_atlasGeneration;		// Atlas generation the layout was made with.
+	mutable bool						m_needsLayout;
+	mutable bool						m_isComplete;			// Whether every glyph was ready during the last layout.
+};
+
+}
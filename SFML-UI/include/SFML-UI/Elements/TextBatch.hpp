@@ -0,0 +1,86 @@
+#pragma once
+
+#include SFMLUI_PCH
+
+#include <SFML-UI/Element.hpp>
+
+namespace sfui
+{
+
+/// <summary>
+/// Collects quads of every label and atlas sprite inside its subtree and draws them with one draw call per texture.
+/// </summary>
+/// <remarks>
+/// <para>Batched labels are drawn after (on top of) every other element of the subtree.</para>
+/// </remarks>
+class TextBatch
+	: public Element
+{
+public:
+	// Methods:
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="TextBatch"/> class.
+	/// </summary>
+	TextBatch();
+
+	/// <summary>
+	/// Returns the batch that is currently being drawn.
+	/// </summary>
+	/// <returns>Batch that is currently being drawn or nullptr if no batch is active.</returns>
+	static TextBatch const* active();
+
+	/// <summary>
+	/// Appends vertices to the batch, transforming and coloring them on the way.
+	/// </summary>
+	/// <param name="texture_">The glyph atlas the vertices refer to.</param>
+	/// <param name="shader_">The shader used to draw the vertices (nullptr to use the one batch is drawn with).</param>
+	/// <param name="vertices_">The vertices.</param>
+	/// <param name="transform_">The transform applied to vertices.</param>
+	/// <param name="color_">The vertex color.</param>
+	void append(sf::Texture const * texture_, sf::Shader const * shader_, std::vector<sf::Vertex> const & vertices_, sf::Transform const & transform_, sf::Color const color_) const;
+
+	/// <summary>
+	/// Returns number of draw calls issued by the last draw.
+	/// </summary>
+	/// <returns>Number of draw calls issued by the last draw.</returns>
+	std::size_t getLastDrawCallCount() const {
+		return m_lastDrawCallCount;
+	}
+
+protected:
+	// Methods:
+	// Overriden methods from Element:
+	/// <summary>
+	/// Starts collecting glyphs of the subtree.
+	/// </summary>
+	/// <param name="target_">The target.</param>
+	/// <param name="states_">The render states, including the element's transform.</param>
+	virtual void drawSelf(sf::RenderTarget & target_, sf::RenderStates states_) const override;
+
+	/// <summary>
+	/// Flushes glyphs collected from the subtree.
+	/// </summary>
+	/// <param name="target_">The target.</param>
+	/// <param name="states_">The render states, including the element's transform.</param>
+	virtual void drawAfterChildren(sf::RenderTarget & target_, sf::RenderStates states_) const override;
+
+private:
+	/// <summary>
+	/// Vertices that share one glyph atlas and shader.
+	/// </summary>
+	struct Bucket
+	{
+		sf::Texture const*		texture;
+		sf::Shader const*		shader;
+		std::vector<sf::Vertex>	vertices;
+	};
+
+	// Members:
+
+	mutable std::vector<Bucket>	m_buckets;				// One bucket per used atlas and shader pair. Vertices are cleared every frame, but the memory is reused.
+	mutable std::size_t			m_lastDrawCallCount = 0;
+	mutable TextBatch const*	m_previousBatch		= nullptr;	// Batch that was active before this one started collecting (nested batches).
+};
+
+}
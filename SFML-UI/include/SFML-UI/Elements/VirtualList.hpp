@@ -0,0 +1,246 @@
+#pragma once
+
+#include SFMLUI_PCH
+
+#include <SFML-UI/Element.hpp>
+#include <SFML-UI/Core/PrefixSumIndex.hpp>
+
+#include <functional>
+
+namespace sfui
+{
+
+/// <summary>
+/// Vertical list of (possibly) huge number of rows that keeps row elements only for the visible ones.
+/// </summary>
+/// <remarks>
+/// <para>Rows are not elements themselves: the list creates just enough row elements to fill the viewport (plus overscan)
+/// and binds them to row indices. Scrolling moves elements of rows that went out of view to the rows that came into view
+/// and binds them again, so memory and attach cost do not depend on the number of rows.</para>
+/// <para>Rows may have different heights. Offsets are kept in <see cref="PrefixSumIndex"/>, so changing one height
+/// and finding the row at scroll offset is O(log n).</para>
+/// <para>Changes (scrolling, heights, row count) are applied lazily, on next <see cref="update"/> or <see cref="refresh"/>.
+/// Row elements are placed at x = 0, with their top edge relative to the list; rows in overscan lie outside of
+/// the viewport, clip the list with a view if they should not be visible.</para>
+/// </remarks>
+class VirtualList
+	: public Element
+{
+public:
+	// Aliases:
+
+	using RowFactoryType	= std::function< ElementPtrType() >;
+	using RowBinderType		= std::function< void(Element & row_, std::size_t const index_) >;
+
+	// Methods:
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="VirtualList"/> class.
+	/// </summary>
+	/// <param name="factory_">Creates row elements (every one of them must be able to display any row).</param>
+	/// <param name="binder_">Makes the row element display the row with specified index.</param>
+	VirtualList(RowFactoryType factory_, RowBinderType binder_);
+
+	/// <summary>
+	/// Sets height of the visible area.
+	/// </summary>
+	/// <param name="height_">The height.</param>
+	void setViewportHeight(float const height_);
+
+	/// <summary>
+	/// Sets number of rows kept bound above and below the visible area (ready to scroll in without binding).
+	/// </summary>
+	/// <param name="rows_">The number of rows on each side.</param>
+	void setOverscan(std::size_t const rows_);
+
+	/// <summary>
+	/// Changes number of rows. Existing rows keep their heights and bound elements.
+	/// </summary>
+	/// <param name="count_">The number of rows.</param>
+	/// <param name="rowHeight_">The height of added rows.</param>
+	void setRowCount(std::size_t const count_, float const rowHeight_);
+
+	/// <summary>
+	/// Changes height of the row.
+	/// </summary>
+	/// <param name="index_">The row index. Throws std::out_of_range when not lower than row count.</param>
+	/// <param name="height_">The height.</param>
+	void setRowHeight(std::size_t const index_, float const height_);
+
+	/// <summary>
+	/// Replaces heights of every row (and the row count).
+	/// </summary>
+	/// <param name="heights_">The heights.</param>
+	void setRowHeights(std::span<double const> const heights_);
+
+	/// <summary>
+	/// Marks rows as changed, so their elements are bound again (if bound at all).
+	/// </summary>
+	/// <param name="first_">The first row.</param>
+	/// <param name="count_">The number of rows.</param>
+	void invalidateRows(std::size_t const first_, std::size_t const count_);
+
+	/// <summary>
+	/// Marks every row as changed.
+	/// </summary>
+	void invalidateAllRows();
+
+	/// <summary>
+	/// Sets the scroll offset (distance from the top of the first row to the top of the viewport).
+	/// </summary>
+	/// <param name="offset_">The offset. Clamped to the scrollable range.</param>
+	void setScrollOffset(double const offset_);
+
+	/// <summary>
+	/// Moves the scroll offset.
+	/// </summary>
+	/// <param name="delta_">The distance (positive scrolls down).</param>
+	void scrollBy(double const delta_);
+
+	/// <summary>
+	/// Scrolls so the row is at the top of the viewport (as far as the scrollable range allows).
+	/// </summary>
+	/// <param name="index_">The row index.</param>
+	void scrollToRow(std::size_t const index_);
+
+	/// <summary>
+	/// Applies pending changes: binds and places row elements for current scroll offset.
+	/// </summary>
+	void refresh();
+
+	/// <summary>
+	/// Returns element bound to the row (as of last refresh).
+	/// </summary>
+	/// <param name="index_">The row index.</param>
+	/// <returns>The element; <c>nullptr</c> if the row is not bound.</returns>
+	Element* getRowElement(std::size_t const index_) const;
+
+	/// <summary>
+	/// Returns index of the row at specified distance from the top of the viewport.
+	/// </summary>
+	/// <param name="y_">The distance from the top of the viewport (e.g. of the mouse cursor, in list's local coordinates).</param>
+	/// <returns>The row index; row count if there is no row there.</returns>
+	std::size_t findRowAt(float const y_) const;
+
+	/// <summary>
+	/// Returns the scroll offset.
+	/// </summary>
+	/// <returns>The scroll offset.</returns>
+	double getScrollOffset() const {
+		return m_scrollOffset;
+	}
+
+	/// <summary>
+	/// Returns the largest scroll offset.
+	/// </summary>
+	/// <returns>The largest scroll offset.</returns>
+	double getMaxScrollOffset() const {
+		return std::max(0.0, m_heights.getTotal() - m_viewportHeight);
+	}
+
+	/// <summary>
+	/// Returns height of all rows.
+	/// </summary>
+	/// <returns>Height of all rows.</returns>
+	double getContentHeight() const {
+		return m_heights.getTotal();
+	}
+
+	/// <summary>
+	/// Returns offset of the row's top edge from the top of the first row.
+	/// </summary>
+	/// <param name="index_">The row index.</param>
+	/// <returns>The offset.</returns>
+	double getRowOffset(std::size_t const index_) const {
+		return m_heights.getOffset(index_);
+	}
+
+	/// <summary>
+	/// Returns height of the row.
+	/// </summary>
+	/// <param name="index_">The row index.</param>
+	/// <returns>The height.</returns>
+	float getRowHeight(std::size_t const index_) const {
+		return static_cast<float>(m_heights.get(index_));
+	}
+
+	/// <summary>
+	/// Returns number of rows.
+	/// </summary>
+	/// <returns>Number of rows.</returns>
+	std::size_t getRowCount() const {
+		return m_heights.getSize();
+	}
+
+	/// <summary>
+	/// Returns range of bound rows (including overscan), as of last refresh.
+	/// </summary>
+	/// <returns>Index of the first bound row and number of bound rows.</returns>
+	std::pair<std::size_t, std::size_t> getBoundRows() const {
+		return { m_firstBoundRow, m_boundRows.size() };
+	}
+
+	/// <summary>
+	/// Returns number of row elements created by the factory so far.
+	/// </summary>
+	/// <returns>Number of created row elements.</returns>
+	std::size_t getCreatedRowElementCount() const {
+		return m_createdRowElementCount;
+	}
+
+	/// <summary>
+	/// Returns number of binder calls so far.
+	/// </summary>
+	/// <returns>Number of binder calls.</returns>
+	std::size_t getBindCount() const {
+		return m_bindCount;
+	}
+
+protected:
+	// Methods:
+	// Overriden methods from Element:
+	/// <summary>
+	/// Applies pending changes (before children are updated).
+	/// </summary>
+	/// <param name="deltaTime_">Time that passed since previous frame.</param>
+	/// <param name="frameTime_">The frame start time.</param>
+	virtual void updateSelf(double const deltaTime_, TimePoint const & frameTime_) override;
+
+private:
+	/// <summary>
+	/// Element bound to a row.
+	/// </summary>
+	struct BoundRow
+	{
+		ElementPtrType	element;
+		bool			needsBind = false;	// Row data changed since the element was bound.
+	};
+
+	/// <summary>
+	/// Attaches a spare row element, or a new one if there are no spare elements.
+	/// </summary>
+	/// <returns>Attached row element.</returns>
+	ElementPtrType acquireRowElement();
+
+	// Members:
+
+	RowFactoryType				m_factory;
+	RowBinderType				m_binder;
+
+	PrefixSumIndex				m_heights;					// Height of every row.
+	double						m_scrollOffset;
+	float						m_viewportHeight;
+	std::size_t					m_overscan;
+
+	std::size_t					m_firstBoundRow;			// Row bound to m_boundRows[0].
+	std::vector<BoundRow>		m_boundRows;				// Elements bound to consecutive rows, starting with m_firstBoundRow.
+	std::vector<ElementPtrType>	m_spareRowElements;			// Detached elements, left over when fewer rows were bound.
+	std::vector<BoundRow>		m_scratchRows;				// Reused storage for refresh.
+	std::vector<ElementPtrType>	m_releasedRowElements;		// Reused storage for refresh.
+
+	std::size_t					m_createdRowElementCount;
+	std::size_t					m_bindCount;
+	bool						m_needsRefresh;
+};
+
+}
@@ -6,4 +6,23 @@
 
 #include SFMLUI_PCH
 
-#include "Element.hpp"
\ No newline at end of file
+#include "Core/Math/Affine2.hpp"
+#include "Core/MappedFile.hpp"
+#include "Element.hpp"
+#include "ElementRecycler.hpp"
+#include "DestructionQueue.hpp"
+#include "ElementTraversal.hpp"
+#include "Elements/Label.hpp"
+#include "Elements/TextBatch.hpp"
+#include "Elements/SdfLabel.hpp"
+#include "Elements/AtlasSprite.hpp"
+#include "Elements/VirtualList.hpp"
+#include "Elements/DataGrid.hpp"
+#include "Elements/LogView.hpp"
+#include "Elements/Chart.hpp"
+#include "Animation/AnimationEngine.hpp"
+#include "Serialization/ElementRegistry.hpp"
+#include "Serialization/SceneSnapshot.hpp"
+#include "Serialization/JsonReader.hpp"
+#include "Serialization/UiDescription.hpp"
+#include "Serialization/SceneReconciler.hpp"
\ No newline at end of file
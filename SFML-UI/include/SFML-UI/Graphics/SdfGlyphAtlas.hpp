@@ -0,0 +1,258 @@
+#pragma once
+
+#include SFMLUI_PCH
+
+#include <SFML-UI/Core/Pointers.hpp>
+#include <SFML-UI/Graphics/SkylinePacker.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace sfui
+{
+
+/// <summary>
+/// Glyph atlas storing signed distance fields of glyphs, so single atlas serves every character size and zoom level.
+/// </summary>
+/// <remarks>
+/// <para>Glyphs are rasterized once (at base character size) on the calling thread, distance fields are computed on a background thread.
+/// Coverage is read from CPU copy of the font texture, which is read back from the GPU only when a requested glyph is not in the copy yet -
+/// glyphs generated again after eviction never cause a read back.</para>
+/// <para>Atlas never grows above `maxPages` pages - when full, least recently used page is evicted and its glyphs are generated again on demand.
+/// Elements drawing the glyphs must report the pages they use every frame with <see cref="markPageUsed"/>.</para>
+/// <para>Glyphs bigger than a page are never generated - they are treated as whitespace.</para>
+/// <para>Every method must be called from the thread that owns the OpenGL context.</para>
+/// </remarks>
+class SdfGlyphAtlas
+{
+public:
+	// Nested types:
+
+	/// <summary>
+	/// Atlas configuration.
+	/// </summary>
+	struct Settings
+	{
+		unsigned	baseCharacterSize	= 48;	// Character size glyphs are rasterized with.
+		unsigned	spread				= 6;	// Maximal encoded distance (in pixels of base size).
+		unsigned	pageSize			= 1024;	// Width and height of single atlas page.
+		std::size_t	maxPages			= 4;	// Memory bound - pages plus the font texture of base size never use more than maxPages * pageSize^2 * 4 bytes (at least one page is always created).
+	};
+
+	/// <summary>
+	/// Glyph ready to be drawn.
+	/// </summary>
+	struct Glyph
+	{
+		sf::FloatRect	bounds;			// Quad bounds relative to the pen position, in base size units. Includes the spread.
+		float			advance;		// Pen advance in base size units.
+		sf::IntRect		textureRect;	// Rectangle of the distance field inside the page.
+		std::size_t		page;			// Page index or NoPage for glyphs without image (whitespace).
+	};
+
+	// Constants:
+
+	static constexpr std::size_t NoPage = std::numeric_limits<std::size_t>::max();
+
+	// Methods:
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="SdfGlyphAtlas"/> class with default settings.
+	/// </summary>
+	/// <param name="font_">The font. Must outlive the atlas.</param>
+	explicit SdfGlyphAtlas(sf::Font const & font_);
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="SdfGlyphAtlas"/> class.
+	/// </summary>
+	/// <param name="font_">The font. Must outlive the atlas.</param>
+	/// <param name="settings_">The settings.</param>
+	SdfGlyphAtlas(sf::Font const & font_, Settings const & settings_);
+
+	/// <summary>
+	/// Finalizes an instance of the <see cref="SdfGlyphAtlas"/> class. Stops the background thread.
+	/// </summary>
+	~SdfGlyphAtlas();
+
+	SdfGlyphAtlas(SdfGlyphAtlas const &) = delete;
+	SdfGlyphAtlas& operator = (SdfGlyphAtlas const &) = delete;
+
+	/// <summary>
+	/// Returns glyph of specified code point. Schedules its generation if it is not in the atlas yet.
+	/// </summary>
+	/// <param name="codePoint_">The code point.</param>
+	/// <returns>Pointer to the glyph or nullptr if it is not generated yet.</returns>
+	Glyph const* findGlyph(sf::Uint32 const codePoint_);
+
+	/// <summary>
+	/// Marks the page as used in the current frame, so it is evicted last.
+	/// </summary>
+	/// <param name="page_">The page index.</param>
+	void markPageUsed(std::size_t const page_) {
+		m_pages[page_]->lastUsedFrame = m_frame;
+	}
+
+	/// <summary>
+	/// Rasterizes scheduled glyphs and uploads finished distance fields. Should be called once per frame.
+	/// </summary>
+	void update();
+
+	/// <summary>
+	/// Blocks until every scheduled glyph is uploaded.
+	/// </summary>
+	void waitUntilReady();
+
+	/// <summary>
+	/// Returns kerning between two glyphs, in base size units.
+	/// </summary>
+	/// <param name="first_">The first code point.</param>
+	/// <param name="second_">The second code point.</param>
+	/// <returns>Kerning offset.</returns>
+	float getKerning(sf::Uint32 const first_, sf::Uint32 const second_) const;
+
+	/// <summary>
+	/// Returns line spacing, in base size units.
+	/// </summary>
+	/// <returns>Line spacing.</returns>
+	float getLineSpacing() const;
+
+	/// <summary>
+	/// Returns texture of specified page.
+	/// </summary>
+	/// <param name="page_">The page index.</param>
+	/// <returns>Page texture.</returns>
+	sf::Texture const& getPageTexture(std::size_t const page_) const {
+		return m_pages[page_]->texture;
+	}
+
+	/// <summary>
+	/// Returns number of memory used by page textures and the font texture of base size, in bytes.
+	/// </summary>
+	/// <returns>Number of bytes used by textures.</returns>
+	std::size_t getMemoryUsage() const;
+
+	/// <summary>
+	/// Returns counter incremented every time glyphs are evicted. Laid out text must be rebuilt when it changes.
+	/// </summary>
+	/// <returns>Eviction counter.</returns>
+	std::uint64_t getGeneration() const {
+		return m_generation;
+	}
+
+	/// <summary>
+	/// Returns the settings.
+	/// </summary>
+	/// <returns>The settings.</returns>
+	Settings const& getSettings() const {
+		return m_settings;
+	}
+
+	/// <summary>
+	/// Returns shader that renders distance fields, shared by every atlas.
+	/// </summary>
+	/// <returns>The shader or nullptr if shaders are not supported.</returns>
+	static sf::Shader const* getShader();
+
+	/// <summary>
+	/// Computes distance field of coverage bitmap.
+	/// </summary>
+	/// <param name="coverage_">Coverage (0-255) of `size_` pixels.</param>
+	/// <param name="size_">Size of the bitmap.</param>
+	/// <param name="spread_">The maximal encoded distance.</param>
+	/// <returns>Distance field, 0.5 (128) marks the edge, values above are inside.</returns>
+	static std::vector<sf::Uint8> computeDistanceField(std::vector<sf::Uint8> const & coverage_, sf::Vector2u const size_, unsigned const spread_);
+
+private:
+	/// <summary>
+	/// Single texture of the atlas.
+	/// </summary>
+	struct Page
+	{
+		sf::Texture				texture;
+		SkylinePacker			packer;
+		std::vector<sf::Uint32>	glyphs;			// Code points stored inside this page.
+		std::uint64_t			lastUsedFrame;
+	};
+
+	/// <summary>
+	/// Work item of the background thread.
+	/// </summary>
+	struct Job
+	{
+		sf::Uint32				codePoint;
+		sf::Vector2u			size;			// Size including the spread.
+		sf::FloatRect			bounds;
+		float					advance;
+		std::vector<sf::Uint8>	pixels;			// Coverage on input, distance field on output.
+	};
+
+	/// <summary>
+	/// Body of the background thread.
+	/// </summary>
+	void processJobs();
+
+	/// <summary>
+	/// Rasterizes scheduled glyphs and hands them to the background thread.
+	/// </summary>
+	void rasterizeScheduled();
+
+	/// <summary>
+	/// Uploads finished distance fields.
+	/// </summary>
+	/// <returns>Number of uploaded glyphs.</returns>
+	std::size_t uploadFinished();
+
+	/// <summary>
+	/// Places the job result inside one of the pages, evicting one if needed.
+	/// </summary>
+	void place(Job const & job_);
+
+	/// <summary>
+	/// Evicts least recently used page.
+	/// </summary>
+	/// <returns>Index of evicted page.</returns>
+	std::size_t evictPage();
+
+	/// <summary>
+	/// Returns whether another page fits in the memory bound.
+	/// </summary>
+	/// <returns><c>true</c> if a page may be created; otherwise, <c>false</c>.</returns>
+	bool canCreatePage() const;
+
+	/// <summary>
+	/// Returns number of bytes used by the font texture of base size.
+	/// </summary>
+	/// <returns>Number of bytes.</returns>
+	std::size_t getFontTextureMemoryUsage() const;
+
+	// Members:
+
+	sf::Font const*							m_font;
+	Settings								m_settings;
+
+	std::unordered_map<sf::Uint32, Glyph>	m_glyphs;			// Glyphs ready to be drawn.
+	std::unordered_set<sf::Uint32>			m_pending;			// Glyphs scheduled or in progress.
+	std::vector<sf::Uint32>					m_scheduled;		// Glyphs waiting for rasterization.
+	std::vector< UniquePtr<Page> >			m_pages;
+
+	sf::Image								m_fontImage;		// CPU copy of the font texture of base size.
+	std::unordered_set<sf::Uint32>			m_fontImageGlyphs;	// Glyphs whose coverage is inside the copy.
+
+	std::uint64_t							m_frame;
+	std::uint64_t							m_generation;
+
+	// Shared with the background thread:
+	std::mutex								m_mutex;
+	std::condition_variable					m_condition;
+	std::deque<Job>							m_jobs;
+	std::vector<Job>						m_finished;
+	bool									m_stopping;
+
+	std::thread								m_worker;
+};
+
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include SFMLUI_PCH
+
+#include <optional>
+
+namespace sfui
+{
+
+/// <summary>
+/// Packs rectangles into fixed size area, using skyline bottom-left heuristic.
+/// </summary>
+/// <remarks>
+/// <para>Packer does not support removal - free space is reclaimed by clearing and repacking.</para>
+/// </remarks>
+class SkylinePacker
+{
+public:
+	// Methods:
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="SkylinePacker"/> class.
+	/// </summary>
+	/// <param name="size_">The size of the packing area.</param>
+	explicit SkylinePacker(sf::Vector2u const size_);
+
+	/// <summary>
+	/// Finds place for rectangle of specified size and marks it as used.
+	/// </summary>
+	/// <param name="size_">The rectangle size.</param>
+	/// <returns>Top left corner of placed rectangle or std::nullopt if it does not fit.</returns>
+	std::optional<sf::Vector2u> insert(sf::Vector2u const size_);
+
+	/// <summary>
+	/// Marks whole area as free.
+	/// </summary>
+	void clear();
+
+	/// <summary>
+	/// Returns the size of the packing area.
+	/// </summary>
+	/// <returns>Size of the packing area.</returns>
+	sf::Vector2u getSize() const {
+		return m_size;
+	}
+
+	/// <summary>
+	/// Returns area of every rectangle inserted so far.
+	/// </summary>
+	/// <returns>Used area in pixels.</returns>
+	std::size_t getUsedArea() const {
+		return m_usedArea;
+	}
+
+private:
+	/// <summary>
+	/// Horizontal segment of the skyline.
+	/// </summary>
+	struct Segment
+	{
+		unsigned x;
+		unsigned y;
+		unsigned width;
+	};
+
+	/// <summary>
+	/// Computes at which height rectangle of specified width would be placed if its left edge was on segment `index_`.
+	/// </summary>
+	/// <param name="index_">The segment index.</param>
+	/// <param name="width_">The rectangle width.</param>
+	/// <returns>Height or std::nullopt if rectangle does not fit horizontally.</returns>
+	std::optional<unsigned> fitHeight(std::size_t const index_, unsigned const width_) const;
+
+	/// <summary>
+	/// Raises the skyline after rectangle was placed on segment `index_`.
+	/// </summary>
+	void addSegment(std::size_t const index_, Segment const & segment_);
+
+	// Members:
+
+	std::vector<Segment>	m_skyline;		// Segments sorted by x, covering whole width.
+	sf::Vector2u			m_size;
+	std::size_t				m_usedArea;
+};
+
+}
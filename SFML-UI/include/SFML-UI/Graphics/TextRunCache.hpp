@@ -0,0 +1,120 @@
+#pragma once
+
+#include SFMLUI_PCH
+
+#include <SFML-UI/Core/Pointers.hpp>
+
+#include <unordered_map>
+
+namespace sfui
+{
+
+/// <summary>
+/// Laid out (shaped) run of text, ready to be drawn as textured triangles.
+/// </summary>
+struct TextRun
+{
+	std::vector<sf::Vertex>	vertices;			// Six vertices per visible glyph, in local space. Texture coordinates point into `texture`.
+	sf::FloatRect			bounds;				// Local bounds of the run.
+	sf::Texture const*		texture = nullptr;	// Glyph atlas (font page) the run was laid out against.
+};
+
+/// <summary>
+/// Caches laid out text runs, keyed by (font, character size, string).
+/// </summary>
+/// <remarks>
+/// <para>Glyphs are taken from the font page of given character size, so every run of the same font and size shares one atlas texture.</para>
+/// <para>Runs are shared between users - assigning the same string twice does not lay the glyphs out again.</para>
+/// </remarks>
+class TextRunCache
+{
+public:
+	// Aliases:
+
+	using RunPtrType = SharedPtr<const TextRun>;
+
+	// Methods:
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="TextRunCache"/> class.
+	/// </summary>
+	/// <param name="capacity_">Number of cached runs, above which unused runs are evicted.</param>
+	explicit TextRunCache(std::size_t const capacity_ = 4096);
+
+	/// <summary>
+	/// Returns cache shared by every label that does not specify its own.
+	/// </summary>
+	/// <returns>Shared cache.</returns>
+	static TextRunCache& shared();
+
+	/// <summary>
+	/// Returns laid out run for specified key, laying it out if not yet cached.
+	/// </summary>
+	/// <param name="font_">The font.</param>
+	/// <param name="characterSize_">The character size.</param>
+	/// <param name="string_">The string.</param>
+	/// <returns>Shared pointer to laid out run.</returns>
+	RunPtrType acquire(sf::Font const & font_, unsigned const characterSize_, sf::String const & string_);
+
+	/// <summary>
+	/// Removes every run laid out with specified font. Must be called before the font is destroyed.
+	/// </summary>
+	/// <param name="font_">The font.</param>
+	void forget(sf::Font const & font_);
+
+	/// <summary>
+	/// Removes every run that is not used outside the cache.
+	/// </summary>
+	void trim();
+
+	/// <summary>
+	/// Sets the capacity of the cache.
+	/// </summary>
+	/// <param name="capacity_">The capacity.</param>
+	void setCapacity(std::size_t const capacity_);
+
+	/// <summary>
+	/// Returns number of cached runs.
+	/// </summary>
+	/// <returns>Number of cached runs.</returns>
+	std::size_t size() const {
+		return m_runs.size();
+	}
+
+	/// <summary>
+	/// Lays out specified string (without caching it).
+	/// </summary>
+	/// <param name="font_">The font.</param>
+	/// <param name="characterSize_">The character size.</param>
+	/// <param name="string_">The string.</param>
+	/// <returns>Laid out run.</returns>
+	static TextRun layout(sf::Font const & font_, unsigned const characterSize_, sf::String const & string_);
+
+private:
+	/// <summary>
+	/// Key of the cached run.
+	/// </summary>
+	struct Key
+	{
+		sf::Font const*	font;
+		unsigned		characterSize;
+		std::u32string	string;
+
+		bool operator == (Key const & rhs_) const {
+			return font == rhs_.font && characterSize == rhs_.characterSize && string == rhs_.string;
+		}
+	};
+
+	/// <summary>
+	/// Computes hash of the run key.
+	/// </summary>
+	struct KeyHash
+	{
+		std::size_t operator()(Key const & key_) const;
+	};
+
+	std::unordered_map<Key, RunPtrType, KeyHash>	m_runs;			// Every cached run.
+	std::size_t										m_capacity;		// Number of runs above which unused ones are evicted.
+};
+
+}
@@ -0,0 +1,173 @@
+#pragma once
+
+#include SFMLUI_PCH
+
+#include <SFML-UI/Core/Pointers.hpp>
+#include <SFML-UI/Graphics/SkylinePacker.hpp>
+
+#include <unordered_map>
+
+namespace sfui
+{
+
+/// <summary>
+/// Packs images added at runtime into a few large textures, so elements drawing them can be batched.
+/// </summary>
+/// <remarks>
+/// <para>Images are referenced by region identifiers - regions can move between pages when atlas is repacked, so they should be resolved every time they are drawn.</para>
+/// <para>Atlas keeps CPU copy of every image, used for repacking.</para>
+/// </remarks>
+class TextureAtlas
+{
+public:
+	// Aliases:
+
+	using RegionId = std::uint32_t;
+
+	// Constants:
+
+	static constexpr RegionId InvalidRegion = 0;
+
+	// Nested types:
+
+	/// <summary>
+	/// Atlas configuration.
+	/// </summary>
+	struct Settings
+	{
+		unsigned	pageSize		= 2048;	// Width and height of single page.
+		unsigned	padding			= 1;	// Transparent pixels around each image (cleared on every upload), prevents bleeding when filtered.
+		float		repackThreshold	= 0.5f;	// Page is repacked when this fraction of its used area belongs to removed images.
+	};
+
+	/// <summary>
+	/// Location of the image inside the atlas.
+	/// </summary>
+	struct Region
+	{
+		sf::Texture const*	texture;
+		sf::IntRect			rect;
+	};
+
+	// Methods:
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="TextureAtlas"/> class with default settings.
+	/// </summary>
+	TextureAtlas();
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="TextureAtlas"/> class.
+	/// </summary>
+	/// <param name="settings_">The settings.</param>
+	explicit TextureAtlas(Settings const & settings_);
+
+	TextureAtlas(TextureAtlas const &) = delete;
+	TextureAtlas& operator = (TextureAtlas const &) = delete;
+
+	/// <summary>
+	/// Adds image to the atlas.
+	/// </summary>
+	/// <param name="image_">The image.</param>
+	/// <returns>Identifier of the region containing the image.</returns>
+	RegionId add(sf::Image const & image_);
+
+	/// <summary>
+	/// Removes image from the atlas. Repacks its page if too much of it is wasted.
+	/// </summary>
+	/// <param name="region_">The region identifier.</param>
+	/// <returns>
+	///		<c>true</c> if succeeded; otherwise, <c>false</c>.
+	/// </returns>
+	bool remove(RegionId const region_);
+
+	/// <summary>
+	/// Finds the current location of the region.
+	/// </summary>
+	/// <param name="region_">The region identifier.</param>
+	/// <returns>Region location or std::nullopt if the region does not exist.</returns>
+	std::optional<Region> find(RegionId const region_) const;
+
+	/// <summary>
+	/// Repacks every page, sorting images by height.
+	/// </summary>
+	void repack();
+
+	/// <summary>
+	/// Returns number of pages.
+	/// </summary>
+	/// <returns>Number of pages.</returns>
+	std::size_t getPageCount() const {
+		return m_pages.size();
+	}
+
+	/// <summary>
+	/// Returns number of images stored in the atlas.
+	/// </summary>
+	/// <returns>Number of images.</returns>
+	std::size_t getRegionCount() const {
+		return m_entries.size();
+	}
+
+	/// <summary>
+	/// Returns counter incremented every time regions move.
+	/// </summary>
+	/// <returns>Repack counter.</returns>
+	std::uint64_t getGeneration() const {
+		return m_generation;
+	}
+
+private:
+	/// <summary>
+	/// Single image stored in the atlas.
+	/// </summary>
+	struct Entry
+	{
+		sf::Image		image;
+		std::size_t		page;
+		sf::IntRect		rect;
+	};
+
+	/// <summary>
+	/// Single texture of the atlas.
+	/// </summary>
+	struct Page
+	{
+		sf::Texture		texture;
+		SkylinePacker	packer;
+		std::size_t		liveArea;		// Area (with padding) of images that were not removed.
+	};
+
+	/// <summary>
+	/// Places the entry in the first page it fits in, creating new page if needed.
+	/// </summary>
+	/// <param name="entry_">The entry.</param>
+	/// <param name="firstPage_">Index of the first page to try.</param>
+	void place(Entry & entry_, std::size_t const firstPage_ = 0);
+
+	/// <summary>
+	/// Uploads entry image to its page.
+	/// </summary>
+	void upload(Entry const & entry_);
+
+	/// <summary>
+	/// Repacks single page. Entries that do not fit back are moved to other pages.
+	/// </summary>
+	/// <param name="page_">The page index.</param>
+	void repackPage(std::size_t const page_);
+
+	/// <summary>
+	/// Returns area occupied by the entry, including padding.
+	/// </summary>
+	std::size_t paddedArea(Entry const & entry_) const;
+
+	// Members:
+
+	Settings							m_settings;
+	std::unordered_map<RegionId, Entry>	m_entries;
+	std::vector< UniquePtr<Page> >		m_pages;
+	RegionId							m_nextRegion;
+	std::uint64_t						m_generation;
+};
+
+}
@@ -0,0 +1,136 @@
+// File description:
+// Implements registry mapping element types to names and factories, used to store and create element trees from data.
+#pragma once
+
+// Precompiled header:
+#include SFMLUI_PCH
+
+// Custom includes:
+#include <SFML-UI/Element.hpp>
+
+#include <functional>
+#include <typeindex>
+#include <unordered_map>
+
+namespace sfui
+{
+
+/// <summary>
+/// Maps element types to names and factories, so element trees can be stored and created from data.
+/// </summary>
+/// <remarks>
+/// <para>Base <see cref="Element"/> is registered as "Element" by default.</para>
+/// </remarks>
+class ElementRegistry
+{
+public:
+	// Aliases:
+
+	using ElementPtrType	= Element::ElementPtrType;
+	using FactoryType		= std::function< ElementPtrType() >;
+	using TypeIndex			= std::uint32_t;
+
+	// Constants:
+
+	static constexpr TypeIndex InvalidType = std::numeric_limits<TypeIndex>::max();
+
+	// Methods:
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="ElementRegistry"/> class.
+	/// </summary>
+	ElementRegistry();
+
+	/// <summary>
+	/// Registers the element type under specified name. Element is created with its default constructor.
+	/// </summary>
+	/// <param name="name_">The type name.</param>
+	template <typename TElementType>
+	void add(std::string name_)
+	{
+		static_assert(std::is_default_constructible_v<TElementType>, "Element type without default constructor needs a factory.");
+		this->add<TElementType>(std::move(name_), [] { return std::make_shared<TElementType>(); });
+	}
+
+	/// <summary>
+	/// Registers the element type under specified name, with custom factory (e.g. one that binds a font or an atlas).
+	/// </summary>
+	/// <param name="name_">The type name.</param>
+	/// <param name="factory_">The factory.</param>
+	template <typename TElementType>
+	void add(std::string name_, FactoryType factory_)
+	{
+		static_assert(std::is_base_of_v<Element, TElementType>, "Registered type must derive from sfui::Element.");
+		this->add(std::type_index{ typeid(TElementType) }, std::move(name_), std::move(factory_));
+	}
+
+	/// <summary>
+	/// Finds the type by name.
+	/// </summary>
+	/// <param name="name_">The type name.</param>
+	/// <returns>Index of the type; <see cref="InvalidType"/> if it is not registered.</returns>
+	TypeIndex find(std::string_view const name_) const;
+
+	/// <summary>
+	/// Finds the type of the element (its dynamic type).
+	/// </summary>
+	/// <param name="element_">The element.</param>
+	/// <returns>Index of the type; <see cref="InvalidType"/> if it is not registered.</returns>
+	TypeIndex find(Element const & element_) const;
+
+	/// <summary>
+	/// Returns name of the type.
+	/// </summary>
+	/// <param name="type_">The type index.</param>
+	/// <returns>The type name.</returns>
+	std::string const& getName(TypeIndex const type_) const {
+		return m_entries[type_].name;
+	}
+
+	/// <summary>
+	/// Creates element of specified type.
+	/// </summary>
+	/// <param name="type_">The type index.</param>
+	/// <returns>The created element.</returns>
+	ElementPtrType create(TypeIndex const type_) const;
+
+	/// <summary>
+	/// Creates element of specified type.
+	/// </summary>
+	/// <param name="name_">The type name.</param>
+	/// <returns>The created element.</returns>
+	/// <exception cref="std::invalid_argument">Type is not registered.</exception>
+	ElementPtrType create(std::string_view const name_) const;
+
+	/// <summary>
+	/// Returns number of registered types.
+	/// </summary>
+	/// <returns>Number of registered types.</returns>
+	std::size_t getSize() const {
+		return m_entries.size();
+	}
+private:
+	// Nested types:
+
+	struct Entry
+	{
+		std::string		name;
+		FactoryType		factory;
+	};
+
+	/// <summary>
+	/// Registers the type.
+	/// </summary>
+	/// <param name="type_">The type.</param>
+	/// <param name="name_">The type name.</param>
+	/// <param name="factory_">The factory.</param>
+	void add(std::type_index const type_, std::string name_, FactoryType factory_);
+
+	// Members:
+
+	std::vector<Entry>								m_entries;
+	std::unordered_map<std::type_index, TypeIndex>	m_typeToIndex;
+	std::map<std::string, TypeIndex, std::less<>>	m_nameToIndex;
+};
+
+}
@@ -0,0 +1,148 @@
+// File description:
+// Implements streaming (pull) JSON reader returning one token at a time, without building a document tree.
+#pragma once
+
+// Precompiled header:
+#include SFMLUI_PCH
+
+namespace sfui
+{
+
+/// <summary>
+/// Streaming (pull) JSON reader. Returns one token at a time, without building a document tree.
+/// </summary>
+/// <remarks>
+/// <para>Strings without escape sequences are returned as views into the source text, so the source must outlive the reader.</para>
+/// <para>Malformed input throws <see cref="JsonReader::Error"/> with line and column of the problem.</para>
+/// </remarks>
+class JsonReader
+{
+public:
+	// Enums:
+
+	/// <summary>
+	/// Lists the tokens returned by <see cref="next"/>.
+	/// </summary>
+	enum class Token
+	{
+		BeginObject,
+		EndObject,
+		BeginArray,
+		EndArray,
+		Key,		// Object member name, see getString.
+		String,		// See getString.
+		Number,		// See getNumber.
+		Boolean,	// See getBoolean.
+		Null,
+		End			// End of the document.
+	};
+
+	// Nested types:
+
+	/// <summary>
+	/// Error thrown for malformed input.
+	/// </summary>
+	class Error
+		: public std::runtime_error
+	{
+	public:
+		Error(std::string const & message_, std::size_t const line_, std::size_t const column_)
+			:
+			std::runtime_error{ message_ + " (line " + std::to_string(line_) + ", column " + std::to_string(column_) + ")" },
+			line{ line_ },
+			column{ column_ }
+		{
+		}
+
+		std::size_t line;	// 1-based line of the problem.
+		std::size_t column;	// 1-based column of the problem.
+	};
+
+	// Methods:
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="JsonReader"/> class.
+	/// </summary>
+	/// <param name="text_">The JSON text (UTF-8).</param>
+	explicit JsonReader(std::string_view const text_);
+
+	/// <summary>
+	/// Reads the next token.
+	/// </summary>
+	/// <returns>The token.</returns>
+	Token next();
+
+	/// <summary>
+	/// Skips the value that starts with the token (whole object or array for Begin tokens).
+	/// </summary>
+	/// <param name="token_">The first token of the value, as returned by <see cref="next"/>.</param>
+	void skip(Token const token_);
+
+	/// <summary>
+	/// Returns the last key or string value (unescaped). Valid until the next call to <see cref="next"/>.
+	/// </summary>
+	/// <returns>The string.</returns>
+	std::string_view getString() const {
+		return m_string;
+	}
+
+	/// <summary>
+	/// Returns the last number.
+	/// </summary>
+	/// <returns>The number.</returns>
+	double getNumber() const {
+		return m_number;
+	}
+
+	/// <summary>
+	/// Returns the last boolean.
+	/// </summary>
+	/// <returns>The boolean.</returns>
+	bool getBoolean() const {
+		return m_boolean;
+	}
+
+	/// <summary>
+	/// Throws <see cref="Error"/> with the current position.
+	/// </summary>
+	/// <param name="message_">The message.</param>
+	[[noreturn]] void fail(std::string const & message_) const;
+private:
+	// Nested types:
+
+	enum class State
+	{
+		Value,			// Expects value (document start, after ':' or ',' in array).
+		ValueOrEnd,		// After '['.
+		KeyOrEnd,		// After '{'.
+		Key,			// After ',' in object.
+		CommaOrEnd,		// After value inside object or array.
+		DocumentEnd		// After the top-level value.
+	};
+
+	// Methods:
+
+	Token readValue();
+	Token closeContainer(Token const token_);
+	void readString();
+	void readNumber();
+	void readLiteral(std::string_view const literal_);
+	void skipWhitespace();
+	void afterValue();
+
+	// Members:
+
+	std::string_view	m_text;
+	std::size_t			m_position		= 0;
+	std::size_t			m_lineStart		= 0;	// Position where the current line starts (for error columns).
+	std::size_t			m_line			= 1;
+	State				m_state			= State::Value;
+	std::vector<bool>	m_inObject;				// Stack of open containers (true for objects, false for arrays).
+
+	std::string_view	m_string;
+	std::string			m_unescaped;			// Storage for strings with escape sequences.
+	double				m_number		= 0.0;
+	bool				m_boolean		= false;
+};
+
+}
@@ -0,0 +1,109 @@
+// File description:
+// Implements scene reconciler keeping live element tree in sync with a changing description (hot reload).
+#pragma once
+
+// Precompiled header:
+#include SFMLUI_PCH
+
+// Custom includes:
+#include <SFML-UI/Serialization/SceneSnapshot.hpp>
+
+#include <filesystem>
+
+namespace sfui
+{
+
+/// <summary>
+/// Keeps live element tree in sync with a changing description (hot reload), applying only the differences.
+/// </summary>
+/// <remarks>
+/// <para>Every applied description is compared with the previous one, node by node. Unchanged elements are not touched at all,
+/// changed ones only receive changed fields, so runtime state of everything else (e.g. animated transforms) survives the reload.</para>
+/// <para>Nodes are matched by <see cref="IdProperty"/> user property when present (then they can move between parents).
+/// Other nodes are matched among children of matched parents: identical nodes first (by hash of their fields), then remaining
+/// ones of the same type in order - so inserting, removing or retyping one sibling does not touch the others.
+/// Matched nodes of different type are replaced.</para>
+/// <para><see cref="applyDescription"/> reuses the previous compiled snapshot when the description did not change.</para>
+/// <para>Elements created at runtime inside the tree are left alone, elements removed at runtime are created again.</para>
+/// </remarks>
+class SceneReconciler
+{
+public:
+	// Constants:
+
+	static constexpr std::string_view IdProperty = "id";
+
+	// Nested types:
+
+	/// <summary>
+	/// Describes changes made by one <see cref="apply"/> call.
+	/// </summary>
+	struct Stats
+	{
+		std::size_t created		= 0;	// Elements created for new nodes.
+		std::size_t removed		= 0;	// Elements removed with their nodes.
+		std::size_t moved		= 0;	// Elements attached to a different parent (all their fields are reapplied).
+		std::size_t updated		= 0;	// Elements with changed transform, z-index or user properties.
+		std::size_t unchanged	= 0;	// Elements that were not touched.
+
+		/// <summary>
+		/// Returns number of touched elements.
+		/// </summary>
+		/// <returns>Number of touched elements.</returns>
+		std::size_t getTouched() const {
+			return created + removed + moved + updated;
+		}
+	};
+
+	// Methods:
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="SceneReconciler"/> class.
+	/// </summary>
+	/// <param name="registry_">The registry with every used element type. Must outlive the reconciler.</param>
+	/// <param name="root_">The parent of top-level elements. Must outlive the reconciler.</param>
+	SceneReconciler(ElementRegistry const & registry_, Element & root_);
+
+	/// <summary>
+	/// Brings the tree to the state described by the snapshot. First call creates the whole tree (in bulk).
+	/// </summary>
+	/// <param name="snapshot_">The scene snapshot.</param>
+	/// <returns>Description of the changes.</returns>
+	/// <exception cref="std::runtime_error">Snapshot is corrupted or contains unregistered type (tree is not modified then).</exception>
+	Stats apply(std::vector<std::byte> snapshot_);
+
+	/// <summary>
+	/// Brings the tree to the state described by the UI description (see <see cref="UiDescription"/>).
+	/// Description equal to the last applied one is not compiled again.
+	/// </summary>
+	/// <param name="text_">The description (JSON).</param>
+	/// <returns>Description of the changes.</returns>
+	Stats applyDescription(std::string_view const text_);
+
+	/// <summary>
+	/// Brings the tree to the state described by the UI description file (see <see cref="UiDescription"/>).
+	/// </summary>
+	/// <param name="path_">The description file path.</param>
+	/// <returns>Description of the changes.</returns>
+	Stats applyDescriptionFile(std::filesystem::path const & path_);
+
+	/// <summary>
+	/// Returns element created for the node with specified <see cref="IdProperty"/>.
+	/// </summary>
+	/// <param name="id_">The id.</param>
+	/// <returns>The element; <c>nullptr</c> if there is no such node or its element was destroyed.</returns>
+	SharedPtr<Element> find(std::string_view const id_) const;
+private:
+	// Members:
+
+	ElementRegistry const &			m_registry;
+	Element &						m_root;
+
+	std::vector<std::byte>			m_snapshot;		// Currently applied snapshot.
+	SceneSnapshot::Contents			m_contents;		// Decoded m_snapshot (strings point into it).
+	std::vector<std::string_view>	m_ids;			// Id of every node (empty when it has none), points into m_snapshot.
+	std::string						m_description;	// Description m_snapshot was compiled from (empty when applied directly).
+	std::vector<WeakPtr<Element>>	m_elements;		// Element of every node.
+};
+
+}
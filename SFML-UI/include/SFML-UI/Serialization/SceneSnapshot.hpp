@@ -0,0 +1,297 @@
+// File description:
+// Implements versioned binary snapshots of element trees, saved in one pass and loaded from memory-mapped files.
+#pragma once
+
+// Precompiled header:
+#include SFMLUI_PCH
+
+// Custom includes:
+#include <SFML-UI/Element.hpp>
+#include <SFML-UI/Serialization/ElementRegistry.hpp>
+
+#include <filesystem>
+#include <span>
+#include <unordered_map>
+
+namespace sfui
+{
+
+/// <summary>
+/// Stores element trees in a versioned binary format: element types, local transforms, z-indices and user properties.
+/// </summary>
+/// <remarks>
+/// <para>Layout: header, type names, fixed-size element records in preorder (parent before children),
+/// property records and a shared string table. Loading reads records in one pass, creates every element through
+/// <see cref="ElementRegistry"/> and links children directly, without per-child attach or transform resets.
+/// Siblings stored in z-order (as saved from a tree) need no sorting.</para>
+/// <para>Snapshots use the byte order of the machine that wrote them; loading a snapshot with different byte order fails.</para>
+/// </remarks>
+class SceneSnapshot
+{
+public:
+	// Constants:
+
+	static constexpr std::uint32_t Version	= 1;
+	static constexpr std::uint32_t NoParent	= std::numeric_limits<std::uint32_t>::max();
+
+	// Nested types:
+
+	class Builder;
+
+	/// <summary>
+	/// Decoded user property. Strings point into the snapshot data.
+	/// </summary>
+	struct Property
+	{
+		std::string_view	name;
+		std::string_view	value;
+	};
+
+	/// <summary>
+	/// Decoded element.
+	/// </summary>
+	struct Node
+	{
+		std::uint32_t		type;			// Index in Contents::types.
+		std::uint32_t		parent;			// Index of the parent node (always lower); NoParent for top-level elements.
+		std::uint32_t		childCount;
+		std::uint32_t		firstProperty;	// Index in Contents::properties.
+		std::uint32_t		propertyCount;
+		std::int32_t		zIndex;
+		bool				relative;		// Whether transform is relative to the parent.
+		sf::Vector2f		position;
+		sf::Vector2f		origin;
+		sf::Vector2f		scale;
+		float				rotation;
+	};
+
+	/// <summary>
+	/// Decoded snapshot. Nodes are in preorder.
+	/// </summary>
+	struct Contents
+	{
+		std::vector<std::string_view>	types;
+		std::vector<Node>				nodes;
+		std::vector<Property>			properties;
+	};
+
+	// Methods:
+
+	/// <summary>
+	/// Stores descendants of the root (not the root itself) as a snapshot.
+	/// </summary>
+	/// <param name="root_">The root element.</param>
+	/// <param name="registry_">The registry with every stored element type.</param>
+	/// <returns>The snapshot.</returns>
+	/// <exception cref="std::invalid_argument">Some element type is not registered.</exception>
+	static std::vector<std::byte> save(Element const & root_, ElementRegistry const & registry_);
+
+	/// <summary>
+	/// Stores descendants of the root (not the root itself) as a snapshot file.
+	/// </summary>
+	/// <param name="root_">The root element.</param>
+	/// <param name="registry_">The registry with every stored element type.</param>
+	/// <param name="path_">The file path.</param>
+	static void saveToFile(Element const & root_, ElementRegistry const & registry_, std::filesystem::path const & path_);
+
+	/// <summary>
+	/// Creates elements stored in the snapshot and attaches top-level ones to the parent (in z-order).
+	/// </summary>
+	/// <param name="data_">The snapshot.</param>
+	/// <param name="registry_">The registry with every stored element type.</param>
+	/// <param name="parent_">The parent of top-level elements.</param>
+	/// <returns>Number of created elements.</returns>
+	/// <exception cref="std::runtime_error">Snapshot is corrupted, has different version or contains unregistered type.</exception>
+	static std::size_t load(std::span<std::byte const> const data_, ElementRegistry const & registry_, Element & parent_);
+
+	/// <summary>
+	/// Creates elements stored in the snapshot and attaches top-level ones to the parent (in z-order).
+	/// </summary>
+	/// <param name="data_">The snapshot.</param>
+	/// <param name="registry_">The registry with every stored element type.</param>
+	/// <param name="parent_">The parent of top-level elements.</param>
+	/// <param name="created_">Receives created elements, in order of decoded nodes.</param>
+	/// <returns>Number of created elements.</returns>
+	static std::size_t load(std::span<std::byte const> const data_, ElementRegistry const & registry_, Element & parent_, std::vector<Element::ElementPtrType> & created_);
+
+	/// <summary>
+	/// Validates and decodes the snapshot, without creating elements.
+	/// </summary>
+	/// <param name="data_">The snapshot. Must outlive the result (strings point into it).</param>
+	/// <returns>Decoded snapshot.</returns>
+	/// <exception cref="std::runtime_error">Snapshot is corrupted or has different version.</exception>
+	static Contents decode(std::span<std::byte const> const data_);
+
+	/// <summary>
+	/// Memory-maps the snapshot file, creates elements stored in it and attaches top-level ones to the parent.
+	/// </summary>
+	/// <param name="path_">The file path.</param>
+	/// <param name="registry_">The registry with every stored element type.</param>
+	/// <param name="parent_">The parent of top-level elements.</param>
+	/// <returns>Number of created elements.</returns>
+	static std::size_t loadFromFile(std::filesystem::path const & path_, ElementRegistry const & registry_, Element & parent_);
+};
+
+/// <summary>
+/// Builds a snapshot element by element, without creating elements. Used to save element trees and to compile UI descriptions.
+/// </summary>
+/// <remarks>
+/// <para>Every element must be added after its parent. Fields can be set in any order, until <see cref="finish"/> is called.</para>
+/// </remarks>
+class SceneSnapshot::Builder
+{
+public:
+	// Aliases:
+
+	using ElementIndex = std::uint32_t;
+
+	// Constants:
+
+	static constexpr ElementIndex NoParent = SceneSnapshot::NoParent;
+
+	// Methods:
+
+	/// <summary>
+	/// Adds element with default state (identity transform, z-index 0, relative transform, no properties).
+	/// </summary>
+	/// <param name="parent_">The parent element; <see cref="NoParent"/> for top-level elements.</param>
+	/// <returns>Index of the element.</returns>
+	ElementIndex addElement(ElementIndex const parent_ = NoParent);
+
+	/// <summary>
+	/// Sets the element type. Every element must have a type before the snapshot is finished.
+	/// </summary>
+	/// <param name="element_">The element index.</param>
+	/// <param name="typeName_">Name of the type, as in <see cref="ElementRegistry"/>.</param>
+	void setType(ElementIndex const element_, std::string_view const typeName_);
+
+	/// <summary>
+	/// Sets the element position.
+	/// </summary>
+	/// <param name="element_">The element index.</param>
+	/// <param name="position_">The position.</param>
+	void setPosition(ElementIndex const element_, sf::Vector2f const & position_);
+
+	/// <summary>
+	/// Sets the element origin.
+	/// </summary>
+	/// <param name="element_">The element index.</param>
+	/// <param name="origin_">The origin.</param>
+	void setOrigin(ElementIndex const element_, sf::Vector2f const & origin_);
+
+	/// <summary>
+	/// Sets the element scale.
+	/// </summary>
+	/// <param name="element_">The element index.</param>
+	/// <param name="scale_">The scale factors.</param>
+	void setScale(ElementIndex const element_, sf::Vector2f const & scale_);
+
+	/// <summary>
+	/// Sets the element rotation.
+	/// </summary>
+	/// <param name="element_">The element index.</param>
+	/// <param name="angle_">The angle (in degrees).</param>
+	void setRotation(ElementIndex const element_, float const angle_);
+
+	/// <summary>
+	/// Sets the element z index.
+	/// </summary>
+	/// <param name="element_">The element index.</param>
+	/// <param name="zIndex_">The z index.</param>
+	void setZIndex(ElementIndex const element_, std::int32_t const zIndex_);
+
+	/// <summary>
+	/// Sets whether the element moves with its parent.
+	/// </summary>
+	/// <param name="element_">The element index.</param>
+	/// <param name="relative_">Whether transform is relative to the parent.</param>
+	void setRelativeTransform(ElementIndex const element_, bool const relative_);
+
+	/// <summary>
+	/// Adds the user property.
+	/// </summary>
+	/// <param name="element_">The element index.</param>
+	/// <param name="name_">The property name.</param>
+	/// <param name="value_">The property value.</param>
+	void addProperty(ElementIndex const element_, std::string_view const name_, std::string_view const value_);
+
+	/// <summary>
+	/// Returns number of added elements.
+	/// </summary>
+	/// <returns>Number of added elements.</returns>
+	std::size_t getSize() const {
+		return m_elements.size();
+	}
+
+	/// <summary>
+	/// Creates the snapshot.
+	/// </summary>
+	/// <returns>The snapshot.</returns>
+	/// <exception cref="std::logic_error">Some element has no type.</exception>
+	std::vector<std::byte> finish() const;
+private:
+	// Constants:
+
+	static constexpr std::uint32_t NoType = std::numeric_limits<std::uint32_t>::max();
+
+	// Nested types:
+
+	struct StringRef
+	{
+		std::uint32_t	offset;
+		std::uint32_t	length;
+	};
+
+	struct PendingElement
+	{
+		std::uint32_t	type		= NoType;	// Index in m_typeNames.
+		ElementIndex	parent		= NoParent;
+		std::int32_t	zIndex		= 0;
+		bool			relative	= true;
+		sf::Vector2f	position	= { 0.f, 0.f };
+		sf::Vector2f	origin		= { 0.f, 0.f };
+		sf::Vector2f	scale		= { 1.f, 1.f };
+		float			rotation	= 0.f;
+	};
+
+	struct PendingProperty
+	{
+		ElementIndex	element;
+		StringRef		name;
+		StringRef		value;
+	};
+
+	/// <summary>
+	/// Allows lookup of std::string keys by std::string_view.
+	/// </summary>
+	struct StringHash
+	{
+		using is_transparent = void;
+
+		std::size_t operator()(std::string_view const string_) const {
+			return std::hash<std::string_view>{}(string_);
+		}
+	};
+
+	// Aliases:
+
+	using StringMapType = std::unordered_map<std::string, std::uint32_t, StringHash, std::equal_to<>>;
+
+	/// <summary>
+	/// Stores the string in the string table (once per distinct string).
+	/// </summary>
+	/// <param name="string_">The string.</param>
+	/// <returns>Reference to the stored string.</returns>
+	StringRef addString(std::string_view const string_);
+
+	// Members:
+
+	std::vector<PendingElement>			m_elements;
+	std::vector<PendingProperty>		m_properties;
+	std::vector<StringRef>				m_typeNames;		// Distinct type names, in order of first use.
+	StringMapType						m_typeIndices;		// Type name -> index in m_typeNames.
+	std::vector<char>					m_strings;			// String table.
+	StringMapType						m_stringOffsets;	// String -> offset in m_strings.
+};
+
+}
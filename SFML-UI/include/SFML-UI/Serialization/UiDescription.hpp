@@ -0,0 +1,75 @@
+// File description:
+// Implements JSON UI description loader, compiling descriptions into cached scene snapshots.
+#pragma once
+
+// Precompiled header:
+#include SFMLUI_PCH
+
+// Custom includes:
+#include <SFML-UI/Serialization/SceneSnapshot.hpp>
+
+#include <filesystem>
+
+namespace sfui
+{
+
+/// <summary>
+/// Loads element trees from JSON UI descriptions.
+/// </summary>
+/// <remarks>
+/// <para>Document is an array of elements (or a single element object). Element members:
+///		"type" (registered type name, required), "position", "origin", "scale" ([x, y]; scale also accepts one number),
+///		"rotation" (degrees), "zIndex", "relative" (moves with parent, default true),
+///		"properties" (object of strings, numbers or booleans, stored as user properties) and "children" (array of elements).
+///		Unknown members are ignored.</para>
+/// <para>Descriptions are compiled in one streaming pass straight into a <see cref="SceneSnapshot"/>, without a document tree.
+/// The compiled snapshot can be cached, so following loads of unchanged files skip parsing.</para>
+/// </remarks>
+class UiDescription
+{
+public:
+	// Methods:
+
+	/// <summary>
+	/// Compiles the description into a scene snapshot.
+	/// </summary>
+	/// <param name="text_">The description (JSON, UTF-8).</param>
+	/// <returns>The scene snapshot.</returns>
+	/// <exception cref="JsonReader::Error">Description is malformed.</exception>
+	static std::vector<std::byte> compile(std::string_view const text_);
+
+	/// <summary>
+	/// Creates elements from the description and attaches top-level ones to the parent.
+	/// </summary>
+	/// <param name="text_">The description (JSON, UTF-8).</param>
+	/// <param name="registry_">The registry with every used element type.</param>
+	/// <param name="parent_">The parent of top-level elements.</param>
+	/// <returns>Number of created elements.</returns>
+	static std::size_t load(std::string_view const text_, ElementRegistry const & registry_, Element & parent_);
+
+	/// <summary>
+	/// Creates elements from the description file and attaches top-level ones to the parent.
+	/// </summary>
+	/// <remarks>
+	/// <para>With cache directory set, compiled snapshot is stored there under a hash of the file contents.
+	/// Unchanged files are then loaded from the snapshot, skipping parsing. Stale entries are never read (the hash changes with contents),
+	/// failed cache writes are ignored.</para>
+	/// </remarks>
+	/// <param name="path_">The description file path.</param>
+	/// <param name="registry_">The registry with every used element type.</param>
+	/// <param name="parent_">The parent of top-level elements.</param>
+	/// <param name="cacheDirectory_">The directory for compiled snapshots; empty to disable caching.</param>
+	/// <returns>Number of created elements.</returns>
+	static std::size_t loadFromFile(std::filesystem::path const & path_, ElementRegistry const & registry_, Element & parent_,
+		std::filesystem::path const & cacheDirectory_ = {});
+
+	/// <summary>
+	/// Returns path of the compiled snapshot for specified description contents.
+	/// </summary>
+	/// <param name="text_">The description.</param>
+	/// <param name="cacheDirectory_">The cache directory.</param>
+	/// <returns>Path of the compiled snapshot.</returns>
+	static std::filesystem::path getCachePath(std::string_view const text_, std::filesystem::path const & cacheDirectory_);
+};
+
+}
@@ -0,0 +1,211 @@
+#include "SFMLUIPCH.hpp"
+
+#include <SFML-UI/Animation/AnimationEngine.hpp>
+
+namespace sfui
+{
+
+//////////////////////////////////////////////////////////////////////////////
+AnimationEngine::AnimationEngine()
+	:
+	m_nextTween{ InvalidTween + 1 }
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+AnimationEngine::TweenId AnimationEngine::animate(Element & target_, Property const property_, float const from_, float const to_, double const duration_, Easing const easing_)
+{
+	auto const laneIndex = static_cast<std::size_t>(easing_);
+	if (laneIndex >= m_lanes.size())
+		throw std::invalid_argument("Invalid easing function.");
+
+	auto & lane = m_lanes[laneIndex];
+
+	TweenId const tween = m_nextTween++;
+	auto lifetime = target_.getWeakPtr();
+	bool const isTracked = !lifetime.expired();
+
+	lane.ids.push_back(tween);
+	lane.targets.push_back(&target_);
+	lane.lifetimes.push_back(std::move(lifetime));
+	lane.isTracked.push_back(isTracked ? 1 : 0);
+	lane.properties.push_back(property_);
+	lane.from.push_back(from_);
+	lane.delta.push_back(to_ - from_);
+	lane.elapsed.push_back(0.f);
+	lane.inverseDuration.push_back(1.f / static_cast<float>(std::max(duration_, 1e-6)));
+	lane.values.push_back(from_);
+
+	m_locations.emplace(tween, Location{ laneIndex, lane.size() - 1 });
+
+	setValue(target_, property_, from_);
+	return tween;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+AnimationEngine::TweenId AnimationEngine::animateTo(Element & target_, Property const property_, float const to_, double const duration_, Easing const easing_)
+{
+	return this->animate(target_, property_, getValue(target_, property_), to_, duration_, easing_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+bool AnimationEngine::cancel(TweenId const tween_)
+{
+	auto const it = m_locations.find(tween_);
+	if (it == m_locations.end())
+		return false;
+
+	this->removeAt(it->second.lane, it->second.index);
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::size_t AnimationEngine::cancel(Element const & target_)
+{
+	std::size_t cancelled = 0;
+	for (std::size_t laneIndex = 0; laneIndex < m_lanes.size(); ++laneIndex)
+	{
+		auto & lane = m_lanes[laneIndex];
+		for (std::size_t i = lane.size(); i-- > 0;)
+		{
+			if (lane.targets[i] == &target_)
+			{
+				this->removeAt(laneIndex, i);
+				++cancelled;
+			}
+		}
+	}
+	return cancelled;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+float AnimationEngine::getValue(Element const & target_, Property const property_)
+{
+	switch (property_)
+	{
+	case Property::PositionX:	return target_.getPosition().x;
+	case Property::PositionY:	return target_.getPosition().y;
+	case Property::Rotation:	return target_.getRotation();
+	case Property::ScaleX:		return target_.getScale().x;
+	case Property::ScaleY:		return target_.getScale().y;
+	case Property::OriginX:		return target_.getOrigin().x;
+	case Property::OriginY:		return target_.getOrigin().y;
+	}
+	return 0.f;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void AnimationEngine::setValue(Element & target_, Property const property_, float const value_)
+{
+	switch (property_)
+	{
+	case Property::PositionX:	target_.setPosition(value_, target_.getPosition().y);	break;
+	case Property::PositionY:	target_.setPosition(target_.getPosition().x, value_);	break;
+	case Property::Rotation:	target_.setRotation(value_);							break;
+	case Property::ScaleX:		target_.setScale(value_, target_.getScale().y);			break;
+	case Property::ScaleY:		target_.setScale(target_.getScale().x, value_);			break;
+	case Property::OriginX:		target_.setOrigin(value_, target_.getOrigin().y);		break;
+	case Property::OriginY:		target_.setOrigin(target_.getOrigin().x, value_);		break;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void AnimationEngine::update(double const deltaTime_, TimePoint const &)
+{
+	float const deltaTime = static_cast<float>(deltaTime_);
+
+	for (std::size_t laneIndex = 0; laneIndex < m_lanes.size(); ++laneIndex)
+	{
+		auto & lane = m_lanes[laneIndex];
+		if (lane.size() == 0)
+			continue;
+
+		switch (static_cast<Easing>(laneIndex))
+		{
+		case Easing::Linear:		evaluateLane<Easing::Linear>(lane, deltaTime);		break;
+		case Easing::QuadIn:		evaluateLane<Easing::QuadIn>(lane, deltaTime);		break;
+		case Easing::QuadOut:		evaluateLane<Easing::QuadOut>(lane, deltaTime);		break;
+		case Easing::QuadInOut:		evaluateLane<Easing::QuadInOut>(lane, deltaTime);	break;
+		case Easing::CubicIn:		evaluateLane<Easing::CubicIn>(lane, deltaTime);		break;
+		case Easing::CubicOut:		evaluateLane<Easing::CubicOut>(lane, deltaTime);	break;
+		case Easing::CubicInOut:	evaluateLane<Easing::CubicInOut>(lane, deltaTime);	break;
+		case Easing::SmoothStep:	evaluateLane<Easing::SmoothStep>(lane, deltaTime);	break;
+		default:					break;
+		}
+
+		// Write back (backwards, so finished tweens can be removed on the way):
+		for (std::size_t i = lane.size(); i-- > 0;)
+		{
+			if (lane.isTracked[i] && lane.lifetimes[i].expired())
+			{
+				this->removeAt(laneIndex, i);
+				continue;
+			}
+
+			setValue(*lane.targets[i], lane.properties[i], lane.values[i]);
+
+			if (lane.elapsed[i] * lane.inverseDuration[i] >= 1.f)
+				this->removeAt(laneIndex, i);
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+template <Easing TEasing>
+void AnimationEngine::evaluateLane(Lane & lane_, float const deltaTime_)
+{
+	std::size_t const count = lane_.size();
+
+	float* const			values			= lane_.values.data();
+	float* const			elapsed			= lane_.elapsed.data();
+	float const* const		inverseDuration	= lane_.inverseDuration.data();
+	float const* const		from			= lane_.from.data();
+	float const* const		delta			= lane_.delta.data();
+
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		elapsed[i] += deltaTime_;
+		values[i] = std::min(elapsed[i] * inverseDuration[i], 1.f);
+	}
+
+	for (std::size_t i = 0; i < count; ++i)
+		values[i] = from[i] + delta[i] * easing::evaluate<TEasing>(values[i]);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void AnimationEngine::removeAt(std::size_t const lane_, std::size_t const index_)
+{
+	auto & lane = m_lanes[lane_];
+	std::size_t const last = lane.size() - 1;
+
+	m_locations.erase(lane.ids[index_]);
+
+	if (index_ != last)
+	{
+		lane.ids[index_]				= lane.ids[last];
+		lane.targets[index_]			= lane.targets[last];
+		lane.lifetimes[index_]			= std::move(lane.lifetimes[last]);
+		lane.isTracked[index_]			= lane.isTracked[last];
+		lane.properties[index_]			= lane.properties[last];
+		lane.from[index_]				= lane.from[last];
+		lane.delta[index_]				= lane.delta[last];
+		lane.elapsed[index_]			= lane.elapsed[last];
+		lane.inverseDuration[index_]	= lane.inverseDuration[last];
+		lane.values[index_]				= lane.values[last];
+
+		m_locations[lane.ids[index_]].index = index_;
+	}
+
+	lane.ids.pop_back();
+	lane.targets.pop_back();
+	lane.lifetimes.pop_back();
+	lane.isTracked.pop_back();
+	lane.properties.pop_back();
+	lane.from.pop_back();
+	lane.delta.pop_back();
+	lane.elapsed.pop_back();
+	lane.inverseDuration.pop_back();
+	lane.values.pop_back();
+}
+
+}
@@ -0,0 +1,30 @@
+#include "SFMLUIPCH.hpp"
+
+#include <SFML-UI/Animation/Easing.hpp>
+
+namespace sfui
+{
+
+namespace easing
+{
+
+//////////////////////////////////////////////////////////////////////////////
+float evaluate(Easing const easing_, float const t_)
+{
+	switch (easing_)
+	{
+	case Easing::Linear:		return evaluate<Easing::Linear>(t_);
+	case Easing::QuadIn:		return evaluate<Easing::QuadIn>(t_);
+	case Easing::QuadOut:		return evaluate<Easing::QuadOut>(t_);
+	case Easing::QuadInOut:		return evaluate<Easing::QuadInOut>(t_);
+	case Easing::CubicIn:		return evaluate<Easing::CubicIn>(t_);
+	case Easing::CubicOut:		return evaluate<Easing::CubicOut>(t_);
+	case Easing::CubicInOut:	return evaluate<Easing::CubicInOut>(t_);
+	case Easing::SmoothStep:	return evaluate<Easing::SmoothStep>(t_);
+	default:					return t_;
+	}
+}
+
+}
+
+}
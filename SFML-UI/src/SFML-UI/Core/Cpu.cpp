@@ -0,0 +1,87 @@
+#include "SFMLUIPCH.hpp"
+
+#include <SFML-UI/Core/Cpu.hpp>
+
+#if SFMLUI_ARCH_X86 && defined(_MSC_VER)
+	#include <intrin.h>
+	#include <immintrin.h>
+#endif
+
+#include <atomic>
+
+namespace sfui
+{
+
+namespace cpu
+{
+
+namespace
+{
+
+std::atomic<InstructionSet> g_instructionSetLimit{ InstructionSet::Avx2 };
+
+//////////////////////////////////////////////////////////////////////////////
+InstructionSet detectInstructionSet()
+{
+#if SFMLUI_ARCH_X86 && defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 0);
+	int const maxLeaf = info[0];
+
+	__cpuid(info, 1);
+	bool const hasSse2		= (info[3] & (1 << 26)) != 0;
+	bool const hasOsxsave	= (info[2] & (1 << 27)) != 0;
+	bool const hasAvx		= (info[2] & (1 << 28)) != 0;
+
+	bool hasAvx2 = false;
+	if (maxLeaf >= 7 && hasOsxsave && hasAvx)
+	{
+		// Operating system must save YMM registers on context switch:
+		bool const osSavesYmm = (_xgetbv(0) & 0x6) == 0x6;
+
+		__cpuidex(info, 7, 0);
+		hasAvx2 = osSavesYmm && (info[1] & (1 << 5)) != 0;
+	}
+
+	if (hasAvx2)
+		return InstructionSet::Avx2;
+	if (hasSse2)
+		return InstructionSet::Sse2;
+	return InstructionSet::Scalar;
+#elif SFMLUI_ARCH_X86 && (defined(__GNUC__) || defined(__clang__))
+	// Also verifies that the operating system saves YMM registers.
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+		return InstructionSet::Avx2;
+	if (__builtin_cpu_supports("sse2"))
+		return InstructionSet::Sse2;
+	return InstructionSet::Scalar;
+#else
+	return InstructionSet::Scalar;
+#endif
+}
+
+}
+
+//////////////////////////////////////////////////////////////////////////////
+InstructionSet getSupportedInstructionSet()
+{
+	static InstructionSet const supported = detectInstructionSet();
+	return supported;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+InstructionSet getInstructionSet()
+{
+	return std::min(getSupportedInstructionSet(), g_instructionSetLimit.load(std::memory_order_relaxed));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void setInstructionSetLimit(InstructionSet const limit_)
+{
+	g_instructionSetLimit.store(limit_, std::memory_order_relaxed);
+}
+
+}
+
+}
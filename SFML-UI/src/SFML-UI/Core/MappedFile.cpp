@@ -0,0 +1,147 @@
+#include "SFMLUIPCH.hpp"
+
+#include <SFML-UI/Core/MappedFile.hpp>
+
+#include <utility>
+
+#ifdef _WIN32
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+	#include <Windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace sfui
+{
+
+//////////////////////////////////////////////////////////////////////////////
+MappedFile::MappedFile(std::filesystem::path const & path_)
+{
+#ifdef _WIN32
+	HANDLE const file = ::CreateFileW(path_.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		throw std::runtime_error("Could not open file for mapping.");
+
+	LARGE_INTEGER size;
+	if (!::GetFileSizeEx(file, &size))
+	{
+		::CloseHandle(file);
+		throw std::runtime_error("Could not read size of the mapped file.");
+	}
+
+	m_file		= file;
+	m_isOpen	= true;
+	if (size.QuadPart == 0)
+		return;
+
+	m_mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	void const* const view = m_mapping ? ::MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+	if (!view)
+	{
+		this->close();
+		throw std::runtime_error("Could not map file into memory.");
+	}
+
+	m_data = static_cast<std::byte const*>(view);
+	m_size = static_cast<std::size_t>(size.QuadPart);
+#else
+	int const descriptor = ::open(path_.c_str(), O_RDONLY | O_CLOEXEC);
+	if (descriptor < 0)
+		throw std::runtime_error("Could not open file for mapping.");
+
+	struct stat status;
+	if (::fstat(descriptor, &status) != 0)
+	{
+		::close(descriptor);
+		throw std::runtime_error("Could not read size of the mapped file.");
+	}
+
+	m_isOpen = true;
+	if (status.st_size > 0)
+	{
+		void* const view = ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+		if (view == MAP_FAILED)
+		{
+			::close(descriptor);
+			m_isOpen = false;
+			throw std::runtime_error("Could not map file into memory.");
+		}
+
+		m_data = static_cast<std::byte const*>(view);
+		m_size = static_cast<std::size_t>(status.st_size);
+	}
+
+	// Mapping stays valid after the descriptor is closed.
+	::close(descriptor);
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////
+MappedFile::MappedFile(MappedFile && other_) noexcept
+	:
+	m_data{ std::exchange(other_.m_data, nullptr) },
+	m_size{ std::exchange(other_.m_size, 0) },
+	m_isOpen{ std::exchange(other_.m_isOpen, false) }
+#ifdef _WIN32
+	,
+	m_file{ std::exchange(other_.m_file, nullptr) },
+	m_mapping{ std::exchange(other_.m_mapping, nullptr) }
+#endif
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+MappedFile& MappedFile::operator=(MappedFile && other_) noexcept
+{
+	if (this != &other_)
+	{
+		this->close();
+
+		m_data		= std::exchange(other_.m_data, nullptr);
+		m_size		= std::exchange(other_.m_size, 0);
+		m_isOpen	= std::exchange(other_.m_isOpen, false);
+#ifdef _WIN32
+		m_file		= std::exchange(other_.m_file, nullptr);
+		m_mapping	= std::exchange(other_.m_mapping, nullptr);
+#endif
+	}
+	return *this;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+MappedFile::~MappedFile()
+{
+	this->close();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void MappedFile::close()
+{
+#ifdef _WIN32
+	if (m_data)
+		::UnmapViewOfFile(m_data);
+	if (m_mapping)
+		::CloseHandle(m_mapping);
+	if (m_file)
+		::CloseHandle(m_file);
+
+	m_file		= nullptr;
+	m_mapping	= nullptr;
+#else
+	if (m_data)
+		::munmap(const_cast<std::byte*>(m_data), m_size);
+#endif
+	m_data		= nullptr;
+	m_size		= 0;
+	m_isOpen	= false;
+}
+
+}
@@ -0,0 +1,48 @@
+#include "SFMLUIPCH.hpp"
+
+#include <SFML-UI/Core/Math/Random.hpp>
+
+#include <atomic>
+
+namespace math::random
+{
+
+namespace
+{
+
+//////////////////////////////////////////////////////////////////////////////
+std::uint64_t makeProcessSeed()
+{
+	std::random_device device;
+	return (std::uint64_t{ device() } << 32) | device();
+}
+
+std::atomic<std::uint64_t> g_seed{ makeProcessSeed() };
+std::atomic<std::uint64_t> g_nextStream{ 0 };
+
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void setSeed(std::uint64_t const seed_)
+{
+	g_seed.store(seed_, std::memory_order_relaxed);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::uint64_t getSeed()
+{
+	return g_seed.load(std::memory_order_relaxed);
+}
+
+namespace detail
+{
+
+//////////////////////////////////////////////////////////////////////////////
+std::uint64_t acquireStreamIndex()
+{
+	return g_nextStream.fetch_add(1, std::memory_order_relaxed);
+}
+
+}
+
+}
@@ -0,0 +1,356 @@
+#include "SFMLUIPCH.hpp"
+
+#include <SFML-UI/Core/Math/RandomBatch.hpp>
+#include <SFML-UI/Core/Math/FastMath.hpp>
+#include <SFML-UI/Core/Cpu.hpp>
+
+namespace math::random
+{
+
+namespace
+{
+
+using sfui::cpu::InstructionSet;
+
+// Number of generators advanced side by side, fills a 256-bit register with 32-bit results:
+constexpr std::size_t LaneCount = 8;
+
+constexpr float TwoPi = 2.f * constants::Pi<float>;
+
+/// <summary>
+/// Independent xoshiro256++ generators stored as structure of arrays, so every step is a loop the compiler vectorizes.
+/// </summary>
+struct LaneEngine
+{
+	alignas(32) std::uint64_t s0[LaneCount];
+	alignas(32) std::uint64_t s1[LaneCount];
+	alignas(32) std::uint64_t s2[LaneCount];
+	alignas(32) std::uint64_t s3[LaneCount];
+
+	explicit LaneEngine(DefaultEngine & source_)
+	{
+		for (std::size_t lane = 0; lane < LaneCount; ++lane)
+		{
+			std::uint64_t seed = source_();
+			s0[lane] = splitMix64(seed);
+			s1[lane] = splitMix64(seed);
+			s2[lane] = splitMix64(seed);
+			s3[lane] = splitMix64(seed);
+		}
+	}
+};
+
+//////////////////////////////////////////////////////////////////////////////
+inline std::uint64_t rotateLeft(std::uint64_t const value_, int const shift_)
+{
+	return (value_ << shift_) | (value_ >> (64 - shift_));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+inline void nextBits(LaneEngine & engine_, std::uint32_t (&bits_)[LaneCount])
+{
+	for (std::size_t lane = 0; lane < LaneCount; ++lane)
+	{
+		std::uint64_t const result = rotateLeft(engine_.s0[lane] + engine_.s3[lane], 23) + engine_.s0[lane];
+		std::uint64_t const t = engine_.s1[lane] << 17;
+
+		engine_.s2[lane] ^= engine_.s0[lane];
+		engine_.s3[lane] ^= engine_.s1[lane];
+		engine_.s1[lane] ^= engine_.s2[lane];
+		engine_.s0[lane] ^= engine_.s3[lane];
+		engine_.s2[lane] ^= t;
+		engine_.s3[lane] = rotateLeft(engine_.s3[lane], 45);
+
+		// Upper bits are the strongest ones:
+		bits_[lane] = static_cast<std::uint32_t>(result >> 32);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+inline void nextUnits(LaneEngine & engine_, float (&units_)[LaneCount])
+{
+	std::uint32_t bits[LaneCount];
+	nextBits(engine_, bits);
+
+	// Top 24 bits give every float in [0, 1) with step 2^-24 (signed conversion vectorizes better):
+	for (std::size_t lane = 0; lane < LaneCount; ++lane)
+		units_[lane] = static_cast<float>(static_cast<std::int32_t>(bits[lane] >> 8)) * (1.f / 16'777'216.f);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+template <typename TValueType>
+inline void storeBlock(TValueType const (&block_)[LaneCount], TValueType * output_, std::size_t const count_)
+{
+	for (std::size_t lane = 0; lane < count_; ++lane)
+		output_[lane] = block_[lane];
+}
+
+//////////////////////////////////////////////////////////////////////////////
+inline void storeBlock(float const (&xs_)[LaneCount], float const (&ys_)[LaneCount], Vector2f * output_, std::size_t const count_)
+{
+	for (std::size_t lane = 0; lane < count_; ++lane)
+		output_[lane] = Vector2f{ xs_[lane], ys_[lane] };
+}
+
+// Kernels (compiled for the baseline instruction set and, through wrappers below, for AVX2):
+
+//////////////////////////////////////////////////////////////////////////////
+inline void fillIntsKernel(LaneEngine & engine_, DefaultEngine & fallback_, std::int32_t * values_, std::size_t const count_, std::int32_t const min_, std::uint32_t const range_)
+{
+	// Lemire's multiply-shift in every lane; range_ of zero stands for the full 32-bit range.
+	std::uint32_t const threshold = range_ != 0 ? (0u - range_) % range_ : 0;
+
+	for (std::size_t i = 0; i < count_; i += LaneCount)
+	{
+		std::uint32_t bits[LaneCount];
+		nextBits(engine_, bits);
+
+		std::int32_t block[LaneCount];
+		bool rejected = false;
+		for (std::size_t lane = 0; lane < LaneCount; ++lane)
+		{
+			std::uint64_t const product = std::uint64_t{ bits[lane] } * range_;
+			std::uint32_t const offset = range_ != 0 ? static_cast<std::uint32_t>(product >> 32) : bits[lane];
+
+			rejected |= static_cast<std::uint32_t>(product) < threshold;
+			block[lane] = static_cast<std::int32_t>(static_cast<std::uint32_t>(min_) + offset);
+		}
+
+		// Rare: lanes that would introduce bias draw again, one by one.
+		if (rejected)
+		{
+			for (std::size_t lane = 0; lane < LaneCount; ++lane)
+			{
+				if (static_cast<std::uint32_t>(std::uint64_t{ bits[lane] } * range_) < threshold)
+					block[lane] = static_cast<std::int32_t>(static_cast<std::uint32_t>(min_) + detail::bounded32(fallback_, range_));
+			}
+		}
+
+		storeBlock(block, values_ + i, std::min(LaneCount, count_ - i));
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+inline void fillFloatsKernel(LaneEngine & engine_, float * values_, std::size_t const count_, float const min_, float const span_, float const upper_)
+{
+	for (std::size_t i = 0; i < count_; i += LaneCount)
+	{
+		float units[LaneCount];
+		nextUnits(engine_, units);
+
+		float block[LaneCount];
+		for (std::size_t lane = 0; lane < LaneCount; ++lane)
+			block[lane] = std::min(min_ + span_ * units[lane], upper_);
+
+		storeBlock(block, values_ + i, std::min(LaneCount, count_ - i));
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+inline void fillInRectangleKernel(LaneEngine & engine_, Vector2f * points_, std::size_t const count_, Vector2f const min_, Vector2f const size_)
+{
+	for (std::size_t i = 0; i < count_; i += LaneCount)
+	{
+		float us[LaneCount], vs[LaneCount];
+		nextUnits(engine_, us);
+		nextUnits(engine_, vs);
+
+		float xs[LaneCount], ys[LaneCount];
+		for (std::size_t lane = 0; lane < LaneCount; ++lane)
+		{
+			xs[lane] = min_.x + size_.x * us[lane];
+			ys[lane] = min_.y + size_.y * vs[lane];
+		}
+
+		storeBlock(xs, ys, points_ + i, std::min(LaneCount, count_ - i));
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+inline void fillInAnnulusKernel(LaneEngine & engine_, Vector2f * points_, std::size_t const count_, Vector2f const center_, float const innerRadius_, float const outerRadius_)
+{
+	// Area grows with square of the radius, so squared radius is distributed uniformly:
+	float const innerSquared	= innerRadius_ * innerRadius_;
+	float const spanSquared		= outerRadius_ * outerRadius_ - innerSquared;
+
+	for (std::size_t i = 0; i < count_; i += LaneCount)
+	{
+		float us[LaneCount], vs[LaneCount];
+		nextUnits(engine_, us);
+		nextUnits(engine_, vs);
+
+		float xs[LaneCount], ys[LaneCount];
+		for (std::size_t lane = 0; lane < LaneCount; ++lane)
+		{
+			float const radius = fast_math::sqrt(innerSquared + spanSquared * us[lane]);
+
+			// Angle in [-Pi, Pi), where the polynomials are most accurate:
+			float sine, cosine;
+			fast_math::sinCos((vs[lane] - 0.5f) * TwoPi, sine, cosine);
+
+			xs[lane] = center_.x + radius * cosine;
+			ys[lane] = center_.y + radius * sine;
+		}
+
+		storeBlock(xs, ys, points_ + i, std::min(LaneCount, count_ - i));
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+inline void fillOnPolylineKernel(LaneEngine & engine_, Vector2f * points_, std::size_t const count_, Vector2f const * vertices_, float const * distances_, std::size_t const segmentCount_)
+{
+	float const totalLength = distances_[segmentCount_];
+
+	for (std::size_t i = 0; i < count_; i += LaneCount)
+	{
+		float units[LaneCount];
+		nextUnits(engine_, units);
+
+		std::size_t const blockSize = std::min(LaneCount, count_ - i);
+		for (std::size_t lane = 0; lane < blockSize; ++lane)
+		{
+			float const distance = units[lane] * totalLength;
+
+			// Segment containing the distance (distances_ holds cumulative lengths, starting with zero):
+			std::size_t const segment = std::min<std::size_t>(
+					static_cast<std::size_t>(std::upper_bound(distances_ + 1, distances_ + segmentCount_ + 1, distance) - (distances_ + 1)),
+					segmentCount_ - 1
+				);
+
+			float const segmentLength	= distances_[segment + 1] - distances_[segment];
+			float const fraction		= segmentLength > 0.f ? (distance - distances_[segment]) / segmentLength : 0.f;
+
+			Vector2f const & from	= vertices_[segment];
+			Vector2f const & to		= vertices_[segment + 1];
+			points_[i + lane] = Vector2f{ from.x + (to.x - from.x) * fraction, from.y + (to.y - from.y) * fraction };
+		}
+	}
+}
+
+#if SFMLUI_ARCH_X86
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TARGET_AVX2 void fillIntsAvx2(LaneEngine & engine_, DefaultEngine & fallback_, std::int32_t * values_, std::size_t const count_, std::int32_t const min_, std::uint32_t const range_)
+{
+	fillIntsKernel(engine_, fallback_, values_, count_, min_, range_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TARGET_AVX2 void fillFloatsAvx2(LaneEngine & engine_, float * values_, std::size_t const count_, float const min_, float const span_, float const upper_)
+{
+	fillFloatsKernel(engine_, values_, count_, min_, span_, upper_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TARGET_AVX2 void fillInRectangleAvx2(LaneEngine & engine_, Vector2f * points_, std::size_t const count_, Vector2f const min_, Vector2f const size_)
+{
+	fillInRectangleKernel(engine_, points_, count_, min_, size_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TARGET_AVX2 void fillInAnnulusAvx2(LaneEngine & engine_, Vector2f * points_, std::size_t const count_, Vector2f const center_, float const innerRadius_, float const outerRadius_)
+{
+	fillInAnnulusKernel(engine_, points_, count_, center_, innerRadius_, outerRadius_);
+}
+
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+bool useAvx2()
+{
+	return sfui::cpu::getInstructionSet() == InstructionSet::Avx2;
+}
+
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void fill(std::span<std::int32_t> values_, Uniform<std::int32_t> const & distribution_)
+{
+	DefaultEngine& source = threadEngine();
+	LaneEngine engine{ source };
+
+	std::int32_t const min = distribution_.getMin();
+	std::uint32_t const range = static_cast<std::uint32_t>(distribution_.getMax()) - static_cast<std::uint32_t>(min) + 1;
+
+#if SFMLUI_ARCH_X86
+	if (useAvx2())
+		return fillIntsAvx2(engine, source, values_.data(), values_.size(), min, range);
+#endif
+	fillIntsKernel(engine, source, values_.data(), values_.size(), min, range);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void fill(std::span<float> values_, Uniform<float> const & distribution_)
+{
+	LaneEngine engine{ threadEngine() };
+
+	float const min		= distribution_.getMin();
+	float const max		= distribution_.getMax();
+	float const span	= max - min;
+
+	// Rounding can reach the upper bound for very wide ranges, keep the range half-open:
+	float const upper = min < max ? std::nextafter(max, min) : max;
+
+#if SFMLUI_ARCH_X86
+	if (useAvx2())
+		return fillFloatsAvx2(engine, values_.data(), values_.size(), min, span, upper);
+#endif
+	fillFloatsKernel(engine, values_.data(), values_.size(), min, span, upper);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void fillInRectangle(std::span<Vector2f> points_, Vector2f const & min_, Vector2f const & max_)
+{
+	LaneEngine engine{ threadEngine() };
+
+	Vector2f const size = max_ - min_;
+
+#if SFMLUI_ARCH_X86
+	if (useAvx2())
+		return fillInRectangleAvx2(engine, points_.data(), points_.size(), min_, size);
+#endif
+	fillInRectangleKernel(engine, points_.data(), points_.size(), min_, size);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void fillInDisc(std::span<Vector2f> points_, Vector2f const & center_, float const radius_)
+{
+	fillInAnnulus(points_, center_, 0.f, radius_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void fillInAnnulus(std::span<Vector2f> points_, Vector2f const & center_, float const innerRadius_, float const outerRadius_)
+{
+	LaneEngine engine{ threadEngine() };
+
+#if SFMLUI_ARCH_X86
+	if (useAvx2())
+		return fillInAnnulusAvx2(engine, points_.data(), points_.size(), center_, innerRadius_, outerRadius_);
+#endif
+	fillInAnnulusKernel(engine, points_.data(), points_.size(), center_, innerRadius_, outerRadius_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void fillOnPolyline(std::span<Vector2f> points_, std::span<Vector2f const> vertices_)
+{
+	if (vertices_.empty())
+		throw std::invalid_argument{ "Polyline must have at least one vertex." };
+
+	if (vertices_.size() == 1)
+	{
+		std::fill(points_.begin(), points_.end(), vertices_.front());
+		return;
+	}
+
+	// Cumulative lengths, so every sample can binary search its segment:
+	std::size_t const segmentCount = vertices_.size() - 1;
+	std::vector<float> distances(segmentCount + 1);
+	distances[0] = 0.f;
+	for (std::size_t i = 0; i < segmentCount; ++i)
+		distances[i + 1] = distances[i] + (vertices_[i + 1] - vertices_[i]).length();
+
+	LaneEngine engine{ threadEngine() };
+	fillOnPolylineKernel(engine, points_.data(), points_.size(), vertices_.data(), distances.data(), segmentCount);
+}
+
+}
@@ -0,0 +1,498 @@
+#include "SFMLUIPCH.hpp"
+
+#include <SFML-UI/Core/Math/Vector2Batch.hpp>
+#include <SFML-UI/Core/Cpu.hpp>
+
+#if SFMLUI_ARCH_X86
+	#include <immintrin.h>
+#endif
+
+// Kernels read and write vector arrays as interleaved float arrays (x0, y0, x1, y1, ...).
+static_assert(sizeof(math::Vector2f) == 2 * sizeof(float) && std::is_standard_layout_v<math::Vector2f>, "math::Vector2f must consist of two packed floats.");
+
+namespace math
+{
+
+namespace batch
+{
+
+namespace
+{
+
+using sfui::cpu::InstructionSet;
+
+//////////////////////////////////////////////////////////////////////////////
+inline float const* asFloats(Vector2f const * vectors_)
+{
+	return reinterpret_cast<float const*>(vectors_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+inline float* asFloats(Vector2f * vectors_)
+{
+	return reinterpret_cast<float*>(vectors_);
+}
+
+// Scalar kernels (also process tails of SIMD kernels):
+
+//////////////////////////////////////////////////////////////////////////////
+void addScalar(Vector2f const * lhs_, Vector2f const * rhs_, Vector2f * result_, std::size_t const count_)
+{
+	for (std::size_t i = 0; i < count_; ++i)
+		result_[i] = lhs_[i] + rhs_[i];
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void scaleScalar(Vector2f const * vectors_, float const factor_, Vector2f * result_, std::size_t const count_)
+{
+	for (std::size_t i = 0; i < count_; ++i)
+		result_[i] = vectors_[i] * factor_;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void transformScalar(Affine2f const & matrix_, Vector2f const * points_, Vector2f * result_, std::size_t const count_)
+{
+	for (std::size_t i = 0; i < count_; ++i)
+		result_[i] = matrix_.transformPoint(points_[i]);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void normalizeScalar(Vector2f const * vectors_, Vector2f * result_, std::size_t const count_)
+{
+	for (std::size_t i = 0; i < count_; ++i)
+		result_[i] = vectors_[i].normalize();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void lengthScalar(Vector2f const * vectors_, float * result_, std::size_t const count_)
+{
+	for (std::size_t i = 0; i < count_; ++i)
+		result_[i] = vectors_[i].length();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void boundsScalar(Vector2f const * vectors_, std::size_t const count_, Vector2f & lower_, Vector2f & upper_)
+{
+	for (std::size_t i = 0; i < count_; ++i)
+	{
+		lower_ = Vector2f::lowerBounds(lower_, vectors_[i]);
+		upper_ = Vector2f::upperBounds(upper_, vectors_[i]);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void boundsScalar(float const * values_, std::size_t const count_, float & lower_, float & upper_)
+{
+	for (std::size_t i = 0; i < count_; ++i)
+	{
+		lower_ = std::min(lower_, values_[i]);
+		upper_ = std::max(upper_, values_[i]);
+	}
+}
+
+#if SFMLUI_ARCH_X86
+
+// SSE2 kernels (2 vectors per register):
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TARGET_SSE2 void addSse2(Vector2f const * lhs_, Vector2f const * rhs_, Vector2f * result_, std::size_t const count_)
+{
+	std::size_t i = 0;
+	for (; i + 2 <= count_; i += 2)
+		_mm_storeu_ps(asFloats(result_ + i), _mm_add_ps(_mm_loadu_ps(asFloats(lhs_ + i)), _mm_loadu_ps(asFloats(rhs_ + i))));
+
+	addScalar(lhs_ + i, rhs_ + i, result_ + i, count_ - i);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TARGET_SSE2 void scaleSse2(Vector2f const * vectors_, float const factor_, Vector2f * result_, std::size_t const count_)
+{
+	__m128 const factor = _mm_set1_ps(factor_);
+
+	std::size_t i = 0;
+	for (; i + 2 <= count_; i += 2)
+		_mm_storeu_ps(asFloats(result_ + i), _mm_mul_ps(_mm_loadu_ps(asFloats(vectors_ + i)), factor));
+
+	scaleScalar(vectors_ + i, factor_, result_ + i, count_ - i);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TARGET_SSE2 void transformSse2(Affine2f const & matrix_, Vector2f const * points_, Vector2f * result_, std::size_t const count_)
+{
+	// Columns of the matrix, repeated for both vectors in the register:
+	__m128 const column0 = _mm_setr_ps(matrix_.m00, matrix_.m10, matrix_.m00, matrix_.m10);
+	__m128 const column1 = _mm_setr_ps(matrix_.m01, matrix_.m11, matrix_.m01, matrix_.m11);
+	__m128 const column2 = _mm_setr_ps(matrix_.m02, matrix_.m12, matrix_.m02, matrix_.m12);
+
+	std::size_t i = 0;
+	for (; i + 2 <= count_; i += 2)
+	{
+		__m128 const points	= _mm_loadu_ps(asFloats(points_ + i));
+		__m128 const xs		= _mm_shuffle_ps(points, points, _MM_SHUFFLE(2, 2, 0, 0));
+		__m128 const ys		= _mm_shuffle_ps(points, points, _MM_SHUFFLE(3, 3, 1, 1));
+
+		// Same order of operations as Affine2::transformPoint:
+		_mm_storeu_ps(asFloats(result_ + i), _mm_add_ps(_mm_add_ps(_mm_mul_ps(column0, xs), _mm_mul_ps(column1, ys)), column2));
+	}
+
+	transformScalar(matrix_, points_ + i, result_ + i, count_ - i);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TARGET_SSE2 inline __m128 lengthsSse2(Vector2f const * vectors_, __m128 & xs_, __m128 & ys_)
+{
+	// (x0, y0, x1, y1), (x2, y2, x3, y3) -> (x0, x1, x2, x3), (y0, y1, y2, y3)
+	__m128 const low	= _mm_loadu_ps(asFloats(vectors_));
+	__m128 const high	= _mm_loadu_ps(asFloats(vectors_ + 2));
+	xs_ = _mm_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0));
+	ys_ = _mm_shuffle_ps(low, high, _MM_SHUFFLE(3, 1, 3, 1));
+
+	return _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(xs_, xs_), _mm_mul_ps(ys_, ys_)));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TARGET_SSE2 void normalizeSse2(Vector2f const * vectors_, Vector2f * result_, std::size_t const count_)
+{
+	std::size_t i = 0;
+	for (; i + 4 <= count_; i += 4)
+	{
+		__m128 xs, ys;
+		__m128 const lengths = lengthsSse2(vectors_ + i, xs, ys);
+
+		// Zero vectors stay unchanged:
+		__m128 const isZero = _mm_cmpeq_ps(lengths, _mm_setzero_ps());
+		__m128 const divisor = _mm_or_ps(_mm_andnot_ps(isZero, lengths), _mm_and_ps(isZero, _mm_set1_ps(1.f)));
+		xs = _mm_div_ps(xs, divisor);
+		ys = _mm_div_ps(ys, divisor);
+
+		_mm_storeu_ps(asFloats(result_ + i),		_mm_unpacklo_ps(xs, ys));
+		_mm_storeu_ps(asFloats(result_ + i + 2),	_mm_unpackhi_ps(xs, ys));
+	}
+
+	normalizeScalar(vectors_ + i, result_ + i, count_ - i);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TARGET_SSE2 void lengthSse2(Vector2f const * vectors_, float * result_, std::size_t const count_)
+{
+	std::size_t i = 0;
+	for (; i + 4 <= count_; i += 4)
+	{
+		__m128 xs, ys;
+		_mm_storeu_ps(result_ + i, lengthsSse2(vectors_ + i, xs, ys));
+	}
+
+	lengthScalar(vectors_ + i, result_ + i, count_ - i);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TARGET_SSE2 void boundsSse2(Vector2f const * vectors_, std::size_t const count_, Vector2f & lower_, Vector2f & upper_)
+{
+	__m128 lower = _mm_setr_ps(lower_.x, lower_.y, lower_.x, lower_.y);
+	__m128 upper = _mm_setr_ps(upper_.x, upper_.y, upper_.x, upper_.y);
+
+	std::size_t i = 0;
+	for (; i + 2 <= count_; i += 2)
+	{
+		__m128 const vectors = _mm_loadu_ps(asFloats(vectors_ + i));
+		lower = _mm_min_ps(lower, vectors);
+		upper = _mm_max_ps(upper, vectors);
+	}
+
+	// Merge both halves:
+	lower = _mm_min_ps(lower, _mm_movehl_ps(lower, lower));
+	upper = _mm_max_ps(upper, _mm_movehl_ps(upper, upper));
+
+	alignas(16) float values[4];
+	_mm_store_ps(values, _mm_unpacklo_ps(lower, upper));
+	lower_ = Vector2f{ values[0], values[2] };
+	upper_ = Vector2f{ values[1], values[3] };
+
+	boundsScalar(vectors_ + i, count_ - i, lower_, upper_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TARGET_SSE2 void boundsSse2(float const * values_, std::size_t const count_, float & lower_, float & upper_)
+{
+	__m128 lower = _mm_set1_ps(lower_);
+	__m128 upper = _mm_set1_ps(upper_);
+
+	std::size_t i = 0;
+	for (; i + 4 <= count_; i += 4)
+	{
+		__m128 const values = _mm_loadu_ps(values_ + i);
+		lower = _mm_min_ps(lower, values);
+		upper = _mm_max_ps(upper, values);
+	}
+
+	alignas(16) float lowers[4];
+	alignas(16) float uppers[4];
+	_mm_store_ps(lowers, lower);
+	_mm_store_ps(uppers, upper);
+
+	boundsScalar(lowers, 4, lower_, upper_);
+	boundsScalar(uppers, 4, lower_, upper_);
+	boundsScalar(values_ + i, count_ - i, lower_, upper_);
+}
+
+// AVX2 kernels (4 vectors per register):
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TARGET_AVX2 void addAvx2(Vector2f const * lhs_, Vector2f const * rhs_, Vector2f * result_, std::size_t const count_)
+{
+	std::size_t i = 0;
+	for (; i + 4 <= count_; i += 4)
+		_mm256_storeu_ps(asFloats(result_ + i), _mm256_add_ps(_mm256_loadu_ps(asFloats(lhs_ + i)), _mm256_loadu_ps(asFloats(rhs_ + i))));
+
+	addScalar(lhs_ + i, rhs_ + i, result_ + i, count_ - i);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TARGET_AVX2 void scaleAvx2(Vector2f const * vectors_, float const factor_, Vector2f * result_, std::size_t const count_)
+{
+	__m256 const factor = _mm256_set1_ps(factor_);
+
+	std::size_t i = 0;
+	for (; i + 4 <= count_; i += 4)
+		_mm256_storeu_ps(asFloats(result_ + i), _mm256_mul_ps(_mm256_loadu_ps(asFloats(vectors_ + i)), factor));
+
+	scaleScalar(vectors_ + i, factor_, result_ + i, count_ - i);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TARGET_AVX2 void transformAvx2(Affine2f const & matrix_, Vector2f const * points_, Vector2f * result_, std::size_t const count_)
+{
+	// Columns of the matrix, repeated for every vector in the register:
+	__m256 const column0 = _mm256_setr_ps(matrix_.m00, matrix_.m10, matrix_.m00, matrix_.m10, matrix_.m00, matrix_.m10, matrix_.m00, matrix_.m10);
+	__m256 const column1 = _mm256_setr_ps(matrix_.m01, matrix_.m11, matrix_.m01, matrix_.m11, matrix_.m01, matrix_.m11, matrix_.m01, matrix_.m11);
+	__m256 const column2 = _mm256_setr_ps(matrix_.m02, matrix_.m12, matrix_.m02, matrix_.m12, matrix_.m02, matrix_.m12, matrix_.m02, matrix_.m12);
+
+	std::size_t i = 0;
+	for (; i + 4 <= count_; i += 4)
+	{
+		__m256 const points	= _mm256_loadu_ps(asFloats(points_ + i));
+		__m256 const xs		= _mm256_shuffle_ps(points, points, _MM_SHUFFLE(2, 2, 0, 0));
+		__m256 const ys		= _mm256_shuffle_ps(points, points, _MM_SHUFFLE(3, 3, 1, 1));
+
+		// Same order of operations as Affine2::transformPoint:
+		_mm256_storeu_ps(asFloats(result_ + i), _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(column0, xs), _mm256_mul_ps(column1, ys)), column2));
+	}
+
+	transformScalar(matrix_, points_ + i, result_ + i, count_ - i);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TARGET_AVX2 inline __m256 lengthsAvx2(Vector2f const * vectors_, __m256 & xs_, __m256 & ys_)
+{
+	// Shuffles work per 128-bit lane, components end up in (0, 1, 4, 5, 2, 3, 6, 7) order.
+	// It is fine here as long as the results are interleaved back the same way.
+	__m256 const low	= _mm256_loadu_ps(asFloats(vectors_));
+	__m256 const high	= _mm256_loadu_ps(asFloats(vectors_ + 4));
+	xs_ = _mm256_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0));
+	ys_ = _mm256_shuffle_ps(low, high, _MM_SHUFFLE(3, 1, 3, 1));
+
+	return _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(xs_, xs_), _mm256_mul_ps(ys_, ys_)));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TARGET_AVX2 void normalizeAvx2(Vector2f const * vectors_, Vector2f * result_, std::size_t const count_)
+{
+	std::size_t i = 0;
+	for (; i + 8 <= count_; i += 8)
+	{
+		__m256 xs, ys;
+		__m256 const lengths = lengthsAvx2(vectors_ + i, xs, ys);
+
+		// Zero vectors stay unchanged:
+		__m256 const isZero = _mm256_cmp_ps(lengths, _mm256_setzero_ps(), _CMP_EQ_OQ);
+		__m256 const divisor = _mm256_blendv_ps(lengths, _mm256_set1_ps(1.f), isZero);
+		xs = _mm256_div_ps(xs, divisor);
+		ys = _mm256_div_ps(ys, divisor);
+
+		// Unpacking reverses the per-lane shuffle from lengthsAvx2:
+		_mm256_storeu_ps(asFloats(result_ + i),		_mm256_unpacklo_ps(xs, ys));
+		_mm256_storeu_ps(asFloats(result_ + i + 4),	_mm256_unpackhi_ps(xs, ys));
+	}
+
+	normalizeScalar(vectors_ + i, result_ + i, count_ - i);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TARGET_AVX2 void lengthAvx2(Vector2f const * vectors_, float * result_, std::size_t const count_)
+{
+	__m256i const order = _mm256_setr_epi32(0, 1, 4, 5, 2, 3, 6, 7);
+
+	std::size_t i = 0;
+	for (; i + 8 <= count_; i += 8)
+	{
+		__m256 xs, ys;
+		_mm256_storeu_ps(result_ + i, _mm256_permutevar8x32_ps(lengthsAvx2(vectors_ + i, xs, ys), order));
+	}
+
+	lengthScalar(vectors_ + i, result_ + i, count_ - i);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TARGET_AVX2 void boundsAvx2(Vector2f const * vectors_, std::size_t const count_, Vector2f & lower_, Vector2f & upper_)
+{
+	__m256 lower = _mm256_setr_ps(lower_.x, lower_.y, lower_.x, lower_.y, lower_.x, lower_.y, lower_.x, lower_.y);
+	__m256 upper = _mm256_setr_ps(upper_.x, upper_.y, upper_.x, upper_.y, upper_.x, upper_.y, upper_.x, upper_.y);
+
+	std::size_t i = 0;
+	for (; i + 4 <= count_; i += 4)
+	{
+		__m256 const vectors = _mm256_loadu_ps(asFloats(vectors_ + i));
+		lower = _mm256_min_ps(lower, vectors);
+		upper = _mm256_max_ps(upper, vectors);
+	}
+
+	// Merge lanes, then halves:
+	__m128 lower4 = _mm_min_ps(_mm256_castps256_ps128(lower), _mm256_extractf128_ps(lower, 1));
+	__m128 upper4 = _mm_max_ps(_mm256_castps256_ps128(upper), _mm256_extractf128_ps(upper, 1));
+	lower4 = _mm_min_ps(lower4, _mm_movehl_ps(lower4, lower4));
+	upper4 = _mm_max_ps(upper4, _mm_movehl_ps(upper4, upper4));
+
+	alignas(16) float values[4];
+	_mm_store_ps(values, _mm_unpacklo_ps(lower4, upper4));
+	lower_ = Vector2f{ values[0], values[2] };
+	upper_ = Vector2f{ values[1], values[3] };
+
+	boundsScalar(vectors_ + i, count_ - i, lower_, upper_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TARGET_AVX2 void boundsAvx2(float const * values_, std::size_t const count_, float & lower_, float & upper_)
+{
+	__m256 lower = _mm256_set1_ps(lower_);
+	__m256 upper = _mm256_set1_ps(upper_);
+
+	std::size_t i = 0;
+	for (; i + 8 <= count_; i += 8)
+	{
+		__m256 const values = _mm256_loadu_ps(values_ + i);
+		lower = _mm256_min_ps(lower, values);
+		upper = _mm256_max_ps(upper, values);
+	}
+
+	alignas(32) float lowers[8];
+	alignas(32) float uppers[8];
+	_mm256_store_ps(lowers, lower);
+	_mm256_store_ps(uppers, upper);
+
+	boundsScalar(lowers, 8, lower_, upper_);
+	boundsScalar(uppers, 8, lower_, upper_);
+	boundsScalar(values_ + i, count_ - i, lower_, upper_);
+}
+
+#endif
+
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void add(Vector2f const * lhs_, Vector2f const * rhs_, Vector2f * result_, std::size_t const count_)
+{
+	switch (sfui::cpu::getInstructionSet())
+	{
+#if SFMLUI_ARCH_X86
+	case InstructionSet::Avx2:	addAvx2(lhs_, rhs_, result_, count_); break;
+	case InstructionSet::Sse2:	addSse2(lhs_, rhs_, result_, count_); break;
+#endif
+	default:					addScalar(lhs_, rhs_, result_, count_); break;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void scale(Vector2f const * vectors_, float const factor_, Vector2f * result_, std::size_t const count_)
+{
+	switch (sfui::cpu::getInstructionSet())
+	{
+#if SFMLUI_ARCH_X86
+	case InstructionSet::Avx2:	scaleAvx2(vectors_, factor_, result_, count_); break;
+	case InstructionSet::Sse2:	scaleSse2(vectors_, factor_, result_, count_); break;
+#endif
+	default:					scaleScalar(vectors_, factor_, result_, count_); break;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void transform(Affine2f const & matrix_, Vector2f const * points_, Vector2f * result_, std::size_t const count_)
+{
+	switch (sfui::cpu::getInstructionSet())
+	{
+#if SFMLUI_ARCH_X86
+	case InstructionSet::Avx2:	transformAvx2(matrix_, points_, result_, count_); break;
+	case InstructionSet::Sse2:	transformSse2(matrix_, points_, result_, count_); break;
+#endif
+	default:					transformScalar(matrix_, points_, result_, count_); break;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void normalize(Vector2f const * vectors_, Vector2f * result_, std::size_t const count_)
+{
+	switch (sfui::cpu::getInstructionSet())
+	{
+#if SFMLUI_ARCH_X86
+	case InstructionSet::Avx2:	normalizeAvx2(vectors_, result_, count_); break;
+	case InstructionSet::Sse2:	normalizeSse2(vectors_, result_, count_); break;
+#endif
+	default:					normalizeScalar(vectors_, result_, count_); break;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void length(Vector2f const * vectors_, float * result_, std::size_t const count_)
+{
+	switch (sfui::cpu::getInstructionSet())
+	{
+#if SFMLUI_ARCH_X86
+	case InstructionSet::Avx2:	lengthAvx2(vectors_, result_, count_); break;
+	case InstructionSet::Sse2:	lengthSse2(vectors_, result_, count_); break;
+#endif
+	default:					lengthScalar(vectors_, result_, count_); break;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+bool bounds(Vector2f const * vectors_, std::size_t const count_, Vector2f & lower_, Vector2f & upper_)
+{
+	if (count_ == 0)
+		return false;
+
+	lower_ = vectors_[0];
+	upper_ = vectors_[0];
+
+	switch (sfui::cpu::getInstructionSet())
+	{
+#if SFMLUI_ARCH_X86
+	case InstructionSet::Avx2:	boundsAvx2(vectors_ + 1, count_ - 1, lower_, upper_); break;
+	case InstructionSet::Sse2:	boundsSse2(vectors_ + 1, count_ - 1, lower_, upper_); break;
+#endif
+	default:					boundsScalar(vectors_ + 1, count_ - 1, lower_, upper_); break;
+	}
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+bool bounds(float const * values_, std::size_t const count_, float & lower_, float & upper_)
+{
+	if (count_ == 0)
+		return false;
+
+	lower_ = values_[0];
+	upper_ = values_[0];
+
+	switch (sfui::cpu::getInstructionSet())
+	{
+#if SFMLUI_ARCH_X86
+	case InstructionSet::Avx2:	boundsAvx2(values_ + 1, count_ - 1, lower_, upper_); break;
+	case InstructionSet::Sse2:	boundsSse2(values_ + 1, count_ - 1, lower_, upper_); break;
+#endif
+	default:					boundsScalar(values_ + 1, count_ - 1, lower_, upper_); break;
+	}
+	return true;
+}
+
+}
+
+}
@@ -0,0 +1,118 @@
+#include "SFMLUIPCH.hpp"
+
+#include <SFML-UI/Core/PrefixSumIndex.hpp>
+
+#include <bit>
+
+namespace sfui
+{
+
+namespace
+{
+
+//////////////////////////////////////////////////////////////////////////////
+constexpr std::size_t lowestBit(std::size_t const value_)
+{
+	return value_ & (0 - value_);
+}
+
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void PrefixSumIndex::assign(std::size_t const count_, double const extent_)
+{
+	m_extents.assign(count_, extent_);
+	this->assign(std::span<double const>{ m_extents });
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void PrefixSumIndex::assign(std::span<double const> const extents_)
+{
+	if (extents_.data() != m_extents.data())
+		m_extents.assign(extents_.begin(), extents_.end());
+
+	// Linear construction: every node pushes its sum to the parent that covers it.
+	m_tree = m_extents;
+	for (std::size_t i = 1; i <= m_tree.size(); ++i)
+	{
+		std::size_t const parent = i + lowestBit(i);
+		if (parent <= m_tree.size())
+			m_tree[parent - 1] += m_tree[i - 1];
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void PrefixSumIndex::resize(std::size_t const count_, double const extent_)
+{
+	// Node i only covers items up to i, so truncation keeps the rest of the tree valid.
+	if (count_ <= m_extents.size())
+	{
+		m_extents.resize(count_);
+		m_tree.resize(count_);
+		return;
+	}
+
+	m_extents.reserve(count_);
+	m_tree.reserve(count_);
+	while (m_extents.size() < count_)
+		this->pushBack(extent_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void PrefixSumIndex::pushBack(double const extent_)
+{
+	std::size_t const i = m_extents.size() + 1;
+
+	// New node covers (i - lowbit(i), i], i.e. the new item and items (i - lowbit(i), i - 1]:
+	m_tree.push_back(extent_ + this->getOffset(i - 1) - this->getOffset(i - lowestBit(i)));
+	m_extents.push_back(extent_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void PrefixSumIndex::set(std::size_t const index_, double const extent_)
+{
+	if (index_ >= m_extents.size())
+		throw std::out_of_range("Prefix sum index out of range.");
+
+	double const delta = extent_ - m_extents[index_];
+	if (delta == 0)
+		return;
+
+	m_extents[index_] = extent_;
+	for (std::size_t i = index_ + 1; i <= m_tree.size(); i += lowestBit(i))
+		m_tree[i - 1] += delta;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+double PrefixSumIndex::getOffset(std::size_t const index_) const
+{
+	double sum = 0;
+	for (std::size_t i = std::min(index_, m_tree.size()); i > 0; i -= lowestBit(i))
+		sum += m_tree[i - 1];
+	return sum;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::size_t PrefixSumIndex::findIndex(double const offset_) const
+{
+	if (m_tree.empty())
+		return 0;
+
+	// Binary lifting: descend from the highest power of two, keeping the sum of skipped items not greater than the offset.
+	std::size_t position	= 0;
+	double remaining		= offset_;
+	for (std::size_t step = std::bit_floor(m_tree.size()); step > 0; step >>= 1)
+	{
+		std::size_t const next = position + step;
+		if (next <= m_tree.size() && m_tree[next - 1] <= remaining)
+		{
+			position	= next;
+			remaining	-= m_tree[next - 1];
+		}
+	}
+
+	// "position" items fit before the offset, so the item covering it is the next one:
+	return std::min(position, m_tree.size() - 1);
+}
+
+}
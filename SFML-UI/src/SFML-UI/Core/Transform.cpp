@@ -1,7 +1,7 @@
 #include "SFMLUIPCH.hpp"
 
 #include <SFML-UI/Core/Transform.hpp>
-#include <SFML-UI/Core/MathInc.hpp>
+#include <SFML-UI/Core/MathSFMLInc.hpp>
 
 namespace sfui
 {
@@ -9,6 +9,73 @@ namespace sfui
 namespace transform_algorithm
 {
 
+namespace
+{
+
+///////////////////////////////////////////////////////////////////////////
+template <typename TMathPolicy>
+Decomposed decomposeWith(math::Affine2f const & matrix_)
+{
+	// Columns of the 2x2 linear part: images of the x and y axes.
+	float const xAxisX = matrix_.m00, xAxisY = matrix_.m10;
+	float const yAxisX = matrix_.m01, yAxisY = matrix_.m11;
+
+	float const determinant = xAxisX * yAxisY - yAxisX * xAxisY;
+	float const scaleX = TMathPolicy::hypot(xAxisX, xAxisY);
+
+	Decomposed result;
+	result.position = sf::Vector2f{ matrix_.m02, matrix_.m12 };
+
+	float radians;
+	if (scaleX > 0.f)
+	{
+		radians = TMathPolicy::atan2(xAxisY, xAxisX);
+		result.scale = sf::Vector2f{ scaleX, determinant / scaleX };
+	}
+	else
+	{
+		// Collapsed x-axis, rotation can only be read from the y-axis:
+		radians = TMathPolicy::atan2(-yAxisX, yAxisY);
+		result.scale = sf::Vector2f{ 0.f, TMathPolicy::hypot(yAxisX, yAxisY) };
+	}
+
+	// Wrap to [0, 360) like sf::Transformable::setRotation. Tiny negative angles round to exactly 360 when shifted:
+	float degrees = math::convertToDegrees(radians);
+	if (degrees < 0.f)
+		degrees += 360.f;
+	if (degrees >= 360.f)
+		degrees = 0.f;
+	result.rotation = degrees;
+
+	return result;
+}
+
+}
+
+///////////////////////////////////////////////////////////////////////////
+Decomposed decompose(sf::Transform const & transform_)
+{
+	return decomposeWith<math::PreciseMath>(math::fromSFMLTransform(transform_));
+}
+
+///////////////////////////////////////////////////////////////////////////
+Decomposed decompose(math::Affine2f const & matrix_)
+{
+	return decomposeWith<math::PreciseMath>(matrix_);
+}
+
+///////////////////////////////////////////////////////////////////////////
+Decomposed decompose(sf::Transform const & transform_, math::FastMath)
+{
+	return decomposeWith<math::FastMath>(math::fromSFMLTransform(transform_));
+}
+
+///////////////////////////////////////////////////////////////////////////
+Decomposed decompose(math::Affine2f const & matrix_, math::FastMath)
+{
+	return decomposeWith<math::FastMath>(matrix_);
+}
+
 ///////////////////////////////////////////////////////////////////////////
 sf::Vector2f extractPosition(sf::Transform const & transform_)
 {
@@ -19,21 +86,13 @@ sf::Vector2f extractPosition(sf::Transform const & transform_)
 ///////////////////////////////////////////////////////////////////////////
 sf::Vector2f extractScale(sf::Transform const & transform_)
 {
-	auto const matrix = transform_.getMatrix();
-
-	float const cosAngle = std::cos( math::convertToRadians( extractRotation(transform_) ) );
-
-	return sf::Vector2f{
-			matrix[0] / cosAngle,
-			matrix[5] / cosAngle
-		};
+	return decompose(transform_).scale;
 }
 
 ///////////////////////////////////////////////////////////////////////////
 float extractRotation(sf::Transform const & transform_)
 {
-	auto const matrix = transform_.getMatrix();
-	return math::convertToDegrees( std::atan2( matrix[1], matrix[5]) );
+	return decompose(transform_).rotation;
 }
 
 }
@@ -0,0 +1,535 @@
+#include "SFMLUIPCH.hpp"
+
+#include <SFML-UI/Core/Transform.hpp>
+#include <SFML-UI/Core/Cpu.hpp>
+#include <SFML-UI/Core/MathInc.hpp>
+
+#if SFMLUI_ARCH_X86
+	#include <immintrin.h>
+#endif
+
+// Batch kernels read and write sf::Vector2f arrays as interleaved float arrays (x0, y0, x1, y1, ...).
+static_assert(sizeof(sf::Vector2f) == 2 * sizeof(float), "sf::Vector2f must consist of two packed floats.");
+
+namespace sfui
+{
+
+namespace transform_algorithm
+{
+
+namespace
+{
+
+// Polynomial coefficients shared with the scalar fast math functions:
+using namespace math::fast_math::coefficients;
+
+constexpr float DegreesPerRadian	= 180.f / Pi;
+constexpr float RadiansPerDegree	= Pi / 180.f;
+
+//////////////////////////////////////////////////////////////////////////////
+void decomposeScalar(sf::Transform const * transforms_, std::size_t const count_, sf::Vector2f * positions_, float * rotations_, sf::Vector2f * scales_)
+{
+	for (std::size_t i = 0; i < count_; ++i)
+	{
+		auto const decomposed = decompose(transforms_[i]);
+		positions_[i]	= decomposed.position;
+		rotations_[i]	= decomposed.rotation;
+		scales_[i]		= decomposed.scale;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+sf::Transform composeOne(sf::Vector2f const position_, float const rotation_, sf::Vector2f const scale_, sf::Vector2f const origin_)
+{
+	// Same formula as sf::Transformable::getTransform:
+	float const angle	= -rotation_ * RadiansPerDegree;
+	float const cosine	= std::cos(angle);
+	float const sine	= std::sin(angle);
+
+	float const sxc		= scale_.x * cosine;
+	float const syc		= scale_.y * cosine;
+	float const sxs		= scale_.x * sine;
+	float const sys		= scale_.y * sine;
+	float const tx		= -origin_.x * sxc - origin_.y * sys + position_.x;
+	float const ty		= origin_.x * sxs - origin_.y * syc + position_.y;
+
+	return sf::Transform{
+			sxc,	sys,	tx,
+			-sxs,	syc,	ty,
+			0.f,	0.f,	1.f
+		};
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void composeScalar(sf::Vector2f const * positions_, float const * rotations_, sf::Vector2f const * scales_, sf::Vector2f const * origins_, std::size_t const count_, sf::Transform * transforms_)
+{
+	for (std::size_t i = 0; i < count_; ++i)
+		transforms_[i] = composeOne(positions_[i], rotations_[i], scales_[i], origins_ ? origins_[i] : sf::Vector2f{});
+}
+
+/// <summary>
+/// Runs the kernel processing blocks of TWidth elements over whole arrays. The incomplete tail block is padded, so every element goes through the same kernel.
+/// </summary>
+template <std::size_t TWidth, typename TKernel>
+void decomposeBlocks(sf::Transform const * transforms_, std::size_t const count_, sf::Vector2f * positions_, float * rotations_, sf::Vector2f * scales_, TKernel kernel_)
+{
+	std::size_t i = 0;
+	for (; i + TWidth <= count_; i += TWidth)
+		kernel_(transforms_ + i, positions_ + i, rotations_ + i, scales_ + i);
+
+	if (i < count_)
+	{
+		std::size_t const rest = count_ - i;
+
+		sf::Transform	transforms[TWidth];
+		sf::Vector2f	positions[TWidth];
+		float			rotations[TWidth];
+		sf::Vector2f	scales[TWidth];
+
+		std::copy(transforms_ + i, transforms_ + count_, transforms);
+		kernel_(transforms, positions, rotations, scales);
+
+		std::copy(positions, positions + rest, positions_ + i);
+		std::copy(rotations, rotations + rest, rotations_ + i);
+		std::copy(scales, scales + rest, scales_ + i);
+	}
+}
+
+/// <summary>
+/// Coefficients of TWidth composed transforms, stored as structure of arrays.
+/// </summary>
+template <std::size_t TWidth>
+struct ComposedBlock
+{
+	alignas(32) float a00[TWidth];
+	alignas(32) float a01[TWidth];
+	alignas(32) float a02[TWidth];
+	alignas(32) float a10[TWidth];
+	alignas(32) float a11[TWidth];
+	alignas(32) float a12[TWidth];
+
+	/// <summary>
+	/// Writes first count_ transforms.
+	/// </summary>
+	void store(sf::Transform * transforms_, std::size_t const count_) const
+	{
+		for (std::size_t i = 0; i < count_; ++i)
+		{
+			transforms_[i] = sf::Transform{
+					a00[i], a01[i], a02[i],
+					a10[i], a11[i], a12[i],
+					0.f,	0.f,	1.f
+				};
+		}
+	}
+};
+
+/// <summary>
+/// Runs the kernel processing blocks of TWidth elements over whole arrays. The incomplete tail block is padded, so every element goes through the same kernel.
+/// </summary>
+template <std::size_t TWidth, typename TKernel>
+void composeBlocks(sf::Vector2f const * positions_, float const * rotations_, sf::Vector2f const * scales_, sf::Vector2f const * origins_, std::size_t const count_, sf::Transform * transforms_, TKernel kernel_)
+{
+	sf::Vector2f const zeroOrigins[TWidth] = {};
+	ComposedBlock<TWidth> block;
+
+	std::size_t i = 0;
+	for (; i + TWidth <= count_; i += TWidth)
+	{
+		kernel_(positions_ + i, rotations_ + i, scales_ + i, origins_ ? origins_ + i : zeroOrigins, block);
+		block.store(transforms_ + i, TWidth);
+	}
+
+	if (i < count_)
+	{
+		std::size_t const rest = count_ - i;
+
+		sf::Vector2f	positions[TWidth]	= {};
+		float			rotations[TWidth]	= {};
+		sf::Vector2f	scales[TWidth]		= {};
+		sf::Vector2f	origins[TWidth]		= {};
+
+		std::copy(positions_ + i, positions_ + count_, positions);
+		std::copy(rotations_ + i, rotations_ + count_, rotations);
+		std::copy(scales_ + i, scales_ + count_, scales);
+		if (origins_)
+			std::copy(origins_ + i, origins_ + count_, origins);
+
+		kernel_(positions, rotations, scales, origins, block);
+		block.store(transforms_ + i, rest);
+	}
+}
+
+#if SFMLUI_ARCH_X86
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TARGET_SSE2 inline __m128 selectSse2(__m128 const mask_, __m128 const ifTrue_, __m128 const ifFalse_)
+{
+	return _mm_or_ps(_mm_and_ps(mask_, ifTrue_), _mm_andnot_ps(mask_, ifFalse_));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TARGET_SSE2 inline __m128 atan2Sse2(__m128 const y_, __m128 const x_)
+{
+	__m128 const signMask	= _mm_set1_ps(-0.f);
+	__m128 const absY		= _mm_andnot_ps(signMask, y_);
+	__m128 const absX		= _mm_andnot_ps(signMask, x_);
+
+	__m128 const greater	= _mm_max_ps(absX, absY);
+	__m128 const lesser		= _mm_min_ps(absX, absY);
+	__m128 const a			= _mm_div_ps(lesser, _mm_max_ps(greater, _mm_set1_ps(std::numeric_limits<float>::min())));
+	__m128 const s			= _mm_mul_ps(a, a);
+
+	__m128 r = _mm_set1_ps(Atan5);
+	r = _mm_add_ps(_mm_mul_ps(r, s), _mm_set1_ps(Atan4));
+	r = _mm_add_ps(_mm_mul_ps(r, s), _mm_set1_ps(Atan3));
+	r = _mm_add_ps(_mm_mul_ps(r, s), _mm_set1_ps(Atan2));
+	r = _mm_add_ps(_mm_mul_ps(r, s), _mm_set1_ps(Atan1));
+	r = _mm_add_ps(_mm_mul_ps(r, s), _mm_set1_ps(Atan0));
+	r = _mm_mul_ps(r, a);
+
+	r = selectSse2(_mm_cmpgt_ps(absY, absX), _mm_sub_ps(_mm_set1_ps(HalfPi), r), r);
+	// Select on the sign bit of x (not x < 0), so negative zero gives Pi like the scalar path:
+	r = selectSse2(_mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(x_), 31)), _mm_sub_ps(_mm_set1_ps(Pi), r), r);
+
+	// Result has the sign of y:
+	return _mm_or_ps(r, _mm_and_ps(y_, signMask));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TARGET_SSE2 inline void sinCosSse2(__m128 const x_, __m128 & sine_, __m128 & cosine_)
+{
+	__m128i const quadrant	= _mm_cvtps_epi32(_mm_mul_ps(x_, _mm_set1_ps(1.f / HalfPi)));
+	__m128 const quadrantF	= _mm_cvtepi32_ps(quadrant);
+
+	__m128 r = _mm_sub_ps(x_, _mm_mul_ps(quadrantF, _mm_set1_ps(HalfPi1)));
+	r = _mm_sub_ps(r, _mm_mul_ps(quadrantF, _mm_set1_ps(HalfPi2)));
+	r = _mm_sub_ps(r, _mm_mul_ps(quadrantF, _mm_set1_ps(HalfPi3)));
+	__m128 const r2 = _mm_mul_ps(r, r);
+
+	__m128 sinR = _mm_set1_ps(Sin3);
+	sinR = _mm_add_ps(_mm_mul_ps(sinR, r2), _mm_set1_ps(Sin2));
+	sinR = _mm_add_ps(_mm_mul_ps(sinR, r2), _mm_set1_ps(Sin1));
+	sinR = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(sinR, r2), r), r);
+
+	__m128 cosR = _mm_set1_ps(Cos3);
+	cosR = _mm_add_ps(_mm_mul_ps(cosR, r2), _mm_set1_ps(Cos2));
+	cosR = _mm_add_ps(_mm_mul_ps(cosR, r2), _mm_set1_ps(Cos1));
+	cosR = _mm_mul_ps(_mm_mul_ps(cosR, r2), r2);
+	cosR = _mm_add_ps(_mm_sub_ps(_mm_set1_ps(1.f), _mm_mul_ps(r2, _mm_set1_ps(0.5f))), cosR);
+
+	// Odd quadrants swap sine and cosine, quadrants 2 and 3 negate sine, 1 and 2 negate cosine:
+	__m128i const one		= _mm_set1_epi32(1);
+	__m128i const two		= _mm_set1_epi32(2);
+	__m128 const swap		= _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, one), one));
+	__m128 const sinSign	= _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrant, two), 30));
+	__m128 const cosSign	= _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, one), two), 30));
+
+	sine_	= _mm_xor_ps(selectSse2(swap, cosR, sinR), sinSign);
+	cosine_	= _mm_xor_ps(selectSse2(swap, sinR, cosR), cosSign);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TARGET_SSE2 inline void deinterleaveSse2(float const * values_, __m128 & x_, __m128 & y_)
+{
+	// (x0, y0, x1, y1), (x2, y2, x3, y3) -> (x0, x1, x2, x3), (y0, y1, y2, y3)
+	__m128 const low	= _mm_loadu_ps(values_);
+	__m128 const high	= _mm_loadu_ps(values_ + 4);
+	x_ = _mm_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0));
+	y_ = _mm_shuffle_ps(low, high, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TARGET_SSE2 void decomposeSse2Block(sf::Transform const * transforms_, sf::Vector2f * positions_, float * rotations_, sf::Vector2f * scales_)
+{
+	float const* const m0 = transforms_[0].getMatrix();
+	float const* const m1 = transforms_[1].getMatrix();
+	float const* const m2 = transforms_[2].getMatrix();
+	float const* const m3 = transforms_[3].getMatrix();
+
+	// Transpose columns of the 4x4 matrices, so every register holds one coefficient of 4 transforms:
+	__m128 xAxisX = _mm_loadu_ps(m0), xAxisY = _mm_loadu_ps(m1), unused0 = _mm_loadu_ps(m2), unused1 = _mm_loadu_ps(m3);
+	_MM_TRANSPOSE4_PS(xAxisX, xAxisY, unused0, unused1);
+
+	__m128 yAxisX = _mm_loadu_ps(m0 + 4), yAxisY = _mm_loadu_ps(m1 + 4), unused2 = _mm_loadu_ps(m2 + 4), unused3 = _mm_loadu_ps(m3 + 4);
+	_MM_TRANSPOSE4_PS(yAxisX, yAxisY, unused2, unused3);
+
+	__m128 posX = _mm_loadu_ps(m0 + 12), posY = _mm_loadu_ps(m1 + 12), unused4 = _mm_loadu_ps(m2 + 12), unused5 = _mm_loadu_ps(m3 + 12);
+	_MM_TRANSPOSE4_PS(posX, posY, unused4, unused5);
+
+	__m128 const determinant	= _mm_sub_ps(_mm_mul_ps(xAxisX, yAxisY), _mm_mul_ps(yAxisX, xAxisY));
+	__m128 const scaleX			= _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(xAxisX, xAxisX), _mm_mul_ps(xAxisY, xAxisY)));
+	__m128 const hasXAxis		= _mm_cmpgt_ps(scaleX, _mm_setzero_ps());
+
+	// Collapsed x-axis: rotation and scale are read from the y-axis.
+	__m128 const scaleY = selectSse2(hasXAxis,
+			_mm_div_ps(determinant, _mm_max_ps(scaleX, _mm_set1_ps(std::numeric_limits<float>::min()))),
+			_mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(yAxisX, yAxisX), _mm_mul_ps(yAxisY, yAxisY)))
+		);
+	__m128 const angleY = selectSse2(hasXAxis, xAxisY, _mm_xor_ps(yAxisX, _mm_set1_ps(-0.f)));
+	__m128 const angleX = selectSse2(hasXAxis, xAxisX, yAxisY);
+
+	__m128 degrees = _mm_mul_ps(atan2Sse2(angleY, angleX), _mm_set1_ps(DegreesPerRadian));
+	degrees = _mm_add_ps(degrees, _mm_and_ps(_mm_cmplt_ps(degrees, _mm_setzero_ps()), _mm_set1_ps(360.f)));
+	degrees = _mm_andnot_ps(_mm_cmpge_ps(degrees, _mm_set1_ps(360.f)), degrees); // Tiny negative angles round to 360, wrap them to 0.
+
+	float* const positions	= reinterpret_cast<float*>(positions_);
+	float* const scales		= reinterpret_cast<float*>(scales_);
+
+	_mm_storeu_ps(positions,		_mm_unpacklo_ps(posX, posY));
+	_mm_storeu_ps(positions + 4,	_mm_unpackhi_ps(posX, posY));
+	_mm_storeu_ps(scales,			_mm_unpacklo_ps(scaleX, scaleY));
+	_mm_storeu_ps(scales + 4,		_mm_unpackhi_ps(scaleX, scaleY));
+	_mm_storeu_ps(rotations_,		degrees);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TARGET_SSE2 void composeSse2Block(sf::Vector2f const * positions_, float const * rotations_, sf::Vector2f const * scales_, sf::Vector2f const * origins_, ComposedBlock<4> & block_)
+{
+	float const* const positions	= reinterpret_cast<float const*>(positions_);
+	float const* const scales		= reinterpret_cast<float const*>(scales_);
+	float const* const origins		= reinterpret_cast<float const*>(origins_);
+
+	__m128 posX, posY, scaleX, scaleY, originX, originY;
+	deinterleaveSse2(positions, posX, posY);
+	deinterleaveSse2(scales, scaleX, scaleY);
+	deinterleaveSse2(origins, originX, originY);
+
+	__m128 sine, cosine;
+	sinCosSse2(_mm_mul_ps(_mm_loadu_ps(rotations_), _mm_set1_ps(-RadiansPerDegree)), sine, cosine);
+
+	__m128 const sxc = _mm_mul_ps(scaleX, cosine);
+	__m128 const syc = _mm_mul_ps(scaleY, cosine);
+	__m128 const sxs = _mm_mul_ps(scaleX, sine);
+	__m128 const sys = _mm_mul_ps(scaleY, sine);
+
+	__m128 const tx = _mm_add_ps(_mm_sub_ps(_mm_setzero_ps(), _mm_add_ps(_mm_mul_ps(originX, sxc), _mm_mul_ps(originY, sys))), posX);
+	__m128 const ty = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(originX, sxs), _mm_mul_ps(originY, syc)), posY);
+
+	_mm_store_ps(block_.a00, sxc);
+	_mm_store_ps(block_.a01, sys);
+	_mm_store_ps(block_.a02, tx);
+	_mm_store_ps(block_.a10, _mm_xor_ps(sxs, _mm_set1_ps(-0.f)));
+	_mm_store_ps(block_.a11, syc);
+	_mm_store_ps(block_.a12, ty);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TARGET_AVX2 inline __m256 atan2Avx2(__m256 const y_, __m256 const x_)
+{
+	__m256 const signMask	= _mm256_set1_ps(-0.f);
+	__m256 const absY		= _mm256_andnot_ps(signMask, y_);
+	__m256 const absX		= _mm256_andnot_ps(signMask, x_);
+
+	__m256 const greater	= _mm256_max_ps(absX, absY);
+	__m256 const lesser		= _mm256_min_ps(absX, absY);
+	__m256 const a			= _mm256_div_ps(lesser, _mm256_max_ps(greater, _mm256_set1_ps(std::numeric_limits<float>::min())));
+	__m256 const s			= _mm256_mul_ps(a, a);
+
+	__m256 r = _mm256_set1_ps(Atan5);
+	r = _mm256_add_ps(_mm256_mul_ps(r, s), _mm256_set1_ps(Atan4));
+	r = _mm256_add_ps(_mm256_mul_ps(r, s), _mm256_set1_ps(Atan3));
+	r = _mm256_add_ps(_mm256_mul_ps(r, s), _mm256_set1_ps(Atan2));
+	r = _mm256_add_ps(_mm256_mul_ps(r, s), _mm256_set1_ps(Atan1));
+	r = _mm256_add_ps(_mm256_mul_ps(r, s), _mm256_set1_ps(Atan0));
+	r = _mm256_mul_ps(r, a);
+
+	r = _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps(HalfPi), r), _mm256_cmp_ps(absY, absX, _CMP_GT_OQ));
+	r = _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps(Pi), r), x_); // Blends on the sign bit of x, negative zero included.
+
+	// Result has the sign of y:
+	return _mm256_or_ps(r, _mm256_and_ps(y_, signMask));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TARGET_AVX2 inline void sinCosAvx2(__m256 const x_, __m256 & sine_, __m256 & cosine_)
+{
+	__m256i const quadrant	= _mm256_cvtps_epi32(_mm256_mul_ps(x_, _mm256_set1_ps(1.f / HalfPi)));
+	__m256 const quadrantF	= _mm256_cvtepi32_ps(quadrant);
+
+	__m256 r = _mm256_sub_ps(x_, _mm256_mul_ps(quadrantF, _mm256_set1_ps(HalfPi1)));
+	r = _mm256_sub_ps(r, _mm256_mul_ps(quadrantF, _mm256_set1_ps(HalfPi2)));
+	r = _mm256_sub_ps(r, _mm256_mul_ps(quadrantF, _mm256_set1_ps(HalfPi3)));
+	__m256 const r2 = _mm256_mul_ps(r, r);
+
+	__m256 sinR = _mm256_set1_ps(Sin3);
+	sinR = _mm256_add_ps(_mm256_mul_ps(sinR, r2), _mm256_set1_ps(Sin2));
+	sinR = _mm256_add_ps(_mm256_mul_ps(sinR, r2), _mm256_set1_ps(Sin1));
+	sinR = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(sinR, r2), r), r);
+
+	__m256 cosR = _mm256_set1_ps(Cos3);
+	cosR = _mm256_add_ps(_mm256_mul_ps(cosR, r2), _mm256_set1_ps(Cos2));
+	cosR = _mm256_add_ps(_mm256_mul_ps(cosR, r2), _mm256_set1_ps(Cos1));
+	cosR = _mm256_mul_ps(_mm256_mul_ps(cosR, r2), r2);
+	cosR = _mm256_add_ps(_mm256_sub_ps(_mm256_set1_ps(1.f), _mm256_mul_ps(r2, _mm256_set1_ps(0.5f))), cosR);
+
+	// Odd quadrants swap sine and cosine, quadrants 2 and 3 negate sine, 1 and 2 negate cosine:
+	__m256i const one		= _mm256_set1_epi32(1);
+	__m256i const two		= _mm256_set1_epi32(2);
+	__m256 const swap		= _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(quadrant, one), one));
+	__m256 const sinSign	= _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(quadrant, two), 30));
+	__m256 const cosSign	= _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(quadrant, one), two), 30));
+
+	sine_	= _mm256_xor_ps(_mm256_blendv_ps(sinR, cosR, swap), sinSign);
+	cosine_	= _mm256_xor_ps(_mm256_blendv_ps(cosR, sinR, swap), cosSign);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TARGET_AVX2 inline __m256 combineHalves(__m128 const low_, __m128 const high_)
+{
+	return _mm256_insertf128_ps(_mm256_castps128_ps256(low_), high_, 1);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TARGET_AVX2 inline void deinterleaveAvx2(float const * values_, __m256 & x_, __m256 & y_)
+{
+	// Shuffles work per 128-bit lane, which yields (x0, x1, x4, x5, x2, x3, x6, x7) - permute it back.
+	__m256 const low	= _mm256_loadu_ps(values_);
+	__m256 const high	= _mm256_loadu_ps(values_ + 8);
+
+	__m256i const permutation = _mm256_setr_epi32(0, 1, 4, 5, 2, 3, 6, 7);
+	x_ = _mm256_permutevar8x32_ps(_mm256_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0)), permutation);
+	y_ = _mm256_permutevar8x32_ps(_mm256_shuffle_ps(low, high, _MM_SHUFFLE(3, 1, 3, 1)), permutation);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TARGET_AVX2 void decomposeAvx2Block(sf::Transform const * transforms_, sf::Vector2f * positions_, float * rotations_, sf::Vector2f * scales_)
+{
+	// Transpose columns of the 4x4 matrices in two halves, so every register holds one coefficient of 8 transforms:
+	__m128 xAxisX[2], xAxisY[2], yAxisX[2], yAxisY[2], posX[2], posY[2];
+	for (std::size_t half = 0; half < 2; ++half)
+	{
+		float const* const m0 = transforms_[half * 4 + 0].getMatrix();
+		float const* const m1 = transforms_[half * 4 + 1].getMatrix();
+		float const* const m2 = transforms_[half * 4 + 2].getMatrix();
+		float const* const m3 = transforms_[half * 4 + 3].getMatrix();
+
+		__m128 r0 = _mm_loadu_ps(m0), r1 = _mm_loadu_ps(m1), r2 = _mm_loadu_ps(m2), r3 = _mm_loadu_ps(m3);
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+		xAxisX[half] = r0; xAxisY[half] = r1;
+
+		r0 = _mm_loadu_ps(m0 + 4); r1 = _mm_loadu_ps(m1 + 4); r2 = _mm_loadu_ps(m2 + 4); r3 = _mm_loadu_ps(m3 + 4);
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+		yAxisX[half] = r0; yAxisY[half] = r1;
+
+		r0 = _mm_loadu_ps(m0 + 12); r1 = _mm_loadu_ps(m1 + 12); r2 = _mm_loadu_ps(m2 + 12); r3 = _mm_loadu_ps(m3 + 12);
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+		posX[half] = r0; posY[half] = r1;
+	}
+
+	__m256 const xx = combineHalves(xAxisX[0], xAxisX[1]);
+	__m256 const xy = combineHalves(xAxisY[0], xAxisY[1]);
+	__m256 const yx = combineHalves(yAxisX[0], yAxisX[1]);
+	__m256 const yy = combineHalves(yAxisY[0], yAxisY[1]);
+
+	__m256 const determinant	= _mm256_sub_ps(_mm256_mul_ps(xx, yy), _mm256_mul_ps(yx, xy));
+	__m256 const scaleX			= _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(xx, xx), _mm256_mul_ps(xy, xy)));
+	__m256 const hasXAxis		= _mm256_cmp_ps(scaleX, _mm256_setzero_ps(), _CMP_GT_OQ);
+
+	// Collapsed x-axis: rotation and scale are read from the y-axis.
+	__m256 const scaleY = _mm256_blendv_ps(
+			_mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(yx, yx), _mm256_mul_ps(yy, yy))),
+			_mm256_div_ps(determinant, _mm256_max_ps(scaleX, _mm256_set1_ps(std::numeric_limits<float>::min()))),
+			hasXAxis
+		);
+	__m256 const angleY = _mm256_blendv_ps(_mm256_xor_ps(yx, _mm256_set1_ps(-0.f)), xy, hasXAxis);
+	__m256 const angleX = _mm256_blendv_ps(yy, xx, hasXAxis);
+
+	__m256 degrees = _mm256_mul_ps(atan2Avx2(angleY, angleX), _mm256_set1_ps(DegreesPerRadian));
+	degrees = _mm256_add_ps(degrees, _mm256_and_ps(_mm256_cmp_ps(degrees, _mm256_setzero_ps(), _CMP_LT_OQ), _mm256_set1_ps(360.f)));
+	degrees = _mm256_andnot_ps(_mm256_cmp_ps(degrees, _mm256_set1_ps(360.f), _CMP_GE_OQ), degrees); // Tiny negative angles round to 360, wrap them to 0.
+
+	float* const positions	= reinterpret_cast<float*>(positions_);
+	float* const scales		= reinterpret_cast<float*>(scales_);
+
+	for (std::size_t half = 0; half < 2; ++half)
+	{
+		_mm_storeu_ps(positions + half * 8,		_mm_unpacklo_ps(posX[half], posY[half]));
+		_mm_storeu_ps(positions + half * 8 + 4,	_mm_unpackhi_ps(posX[half], posY[half]));
+	}
+
+	// Interleave scales in 128-bit lanes: (x0 y0 x1 y1 | x4 y4 x5 y5) and (x2 y2 x3 y3 | x6 y6 x7 y7)
+	__m256 const scalesLow	= _mm256_unpacklo_ps(scaleX, scaleY);
+	__m256 const scalesHigh	= _mm256_unpackhi_ps(scaleX, scaleY);
+	_mm256_storeu_ps(scales,		_mm256_permute2f128_ps(scalesLow, scalesHigh, 0x20));
+	_mm256_storeu_ps(scales + 8,	_mm256_permute2f128_ps(scalesLow, scalesHigh, 0x31));
+
+	_mm256_storeu_ps(rotations_, degrees);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TARGET_AVX2 void composeAvx2Block(sf::Vector2f const * positions_, float const * rotations_, sf::Vector2f const * scales_, sf::Vector2f const * origins_, ComposedBlock<8> & block_)
+{
+	float const* const positions	= reinterpret_cast<float const*>(positions_);
+	float const* const scales		= reinterpret_cast<float const*>(scales_);
+	float const* const origins		= reinterpret_cast<float const*>(origins_);
+
+	__m256 posX, posY, scaleX, scaleY, originX, originY;
+	deinterleaveAvx2(positions, posX, posY);
+	deinterleaveAvx2(scales, scaleX, scaleY);
+	deinterleaveAvx2(origins, originX, originY);
+
+	__m256 sine, cosine;
+	sinCosAvx2(_mm256_mul_ps(_mm256_loadu_ps(rotations_), _mm256_set1_ps(-RadiansPerDegree)), sine, cosine);
+
+	__m256 const sxc = _mm256_mul_ps(scaleX, cosine);
+	__m256 const syc = _mm256_mul_ps(scaleY, cosine);
+	__m256 const sxs = _mm256_mul_ps(scaleX, sine);
+	__m256 const sys = _mm256_mul_ps(scaleY, sine);
+
+	__m256 const tx = _mm256_add_ps(_mm256_sub_ps(_mm256_setzero_ps(), _mm256_add_ps(_mm256_mul_ps(originX, sxc), _mm256_mul_ps(originY, sys))), posX);
+	__m256 const ty = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(originX, sxs), _mm256_mul_ps(originY, syc)), posY);
+
+	_mm256_store_ps(block_.a00, sxc);
+	_mm256_store_ps(block_.a01, sys);
+	_mm256_store_ps(block_.a02, tx);
+	_mm256_store_ps(block_.a10, _mm256_xor_ps(sxs, _mm256_set1_ps(-0.f)));
+	_mm256_store_ps(block_.a11, syc);
+	_mm256_store_ps(block_.a12, ty);
+}
+
+#endif
+
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void decompose(sf::Transform const * transforms_, std::size_t const count_, sf::Vector2f * positions_, float * rotations_, sf::Vector2f * scales_)
+{
+	switch (cpu::getInstructionSet())
+	{
+#if SFMLUI_ARCH_X86
+	case cpu::InstructionSet::Avx2:
+		decomposeBlocks<8>(transforms_, count_, positions_, rotations_, scales_, decomposeAvx2Block);
+		break;
+	case cpu::InstructionSet::Sse2:
+		decomposeBlocks<4>(transforms_, count_, positions_, rotations_, scales_, decomposeSse2Block);
+		break;
+#endif
+	default:
+		decomposeScalar(transforms_, count_, positions_, rotations_, scales_);
+		break;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void compose(sf::Vector2f const * positions_, float const * rotations_, sf::Vector2f const * scales_, sf::Vector2f const * origins_, std::size_t const count_, sf::Transform * transforms_)
+{
+	switch (cpu::getInstructionSet())
+	{
+#if SFMLUI_ARCH_X86
+	case cpu::InstructionSet::Avx2:
+		composeBlocks<8>(positions_, rotations_, scales_, origins_, count_, transforms_, composeAvx2Block);
+		break;
+	case cpu::InstructionSet::Sse2:
+		composeBlocks<4>(positions_, rotations_, scales_, origins_, count_, transforms_, composeSse2Block);
+		break;
+#endif
+	default:
+		composeScalar(positions_, rotations_, scales_, origins_, count_, transforms_);
+		break;
+	}
+}
+
+}
+
+}
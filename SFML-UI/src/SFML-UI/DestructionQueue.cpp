@@ -0,0 +1,87 @@
+#include "SFMLUIPCH.hpp"
+
+#include <SFML-UI/DestructionQueue.hpp>
+#include <SFML-UI/Element.hpp>
+
+namespace sfui
+{
+
+namespace
+{
+
+constexpr std::size_t ElementsPerClockCheck = 32;
+
+}
+
+//////////////////////////////////////////////////////////////////////////////
+DestructionQueue::DestructionQueue()
+	:
+	m_maxElementsPerSlice{ 2048 },
+	m_maxSliceDuration{ 1000 },
+	m_releasedCount{ 0 }
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+DestructionQueue::~DestructionQueue()
+{
+	this->flush();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void DestructionQueue::enqueue(ElementPtrType element_)
+{
+	if (element_)
+		m_pending.push_back(std::move(element_));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void DestructionQueue::setSliceLimits(std::size_t const maxElements_, DurationType const maxDuration_)
+{
+	m_maxElementsPerSlice	= maxElements_;
+	m_maxSliceDuration		= maxDuration_;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::size_t DestructionQueue::process(std::size_t const maxElements_)
+{
+	std::size_t released = 0;
+	while (released < maxElements_ && !m_pending.empty())
+	{
+		auto element = std::move(m_pending.back());
+		m_pending.pop_back();
+
+		// Children go to the queue first, so the destructor has no subtree to destroy (unless the element survives anyway):
+		if (element.use_count() == 1)
+			element->releaseChildrenTo(m_pending);
+
+		element.reset();
+		++released;
+	}
+
+	m_releasedCount += released;
+	return released;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void DestructionQueue::flush()
+{
+	this->process(std::numeric_limits<std::size_t>::max());
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void DestructionQueue::update(double const, TimePoint const &)
+{
+	auto const sliceStart = ClockType::now();
+
+	std::size_t released = 0;
+	while (released < m_maxElementsPerSlice && !m_pending.empty())
+	{
+		released += this->process(std::min(ElementsPerClockCheck, m_maxElementsPerSlice - released));
+
+		if (ClockType::now() - sliceStart >= m_maxSliceDuration)
+			break;
+	}
+}
+
+}
@@ -1,21 +1,101 @@
 #include "SFMLUIPCH.hpp"
 
 #include <SFML-UI/Element.hpp>
+#include <SFML-UI/DestructionQueue.hpp>
 #include <SFML-UI/Core/Transform.hpp>
+#include <SFML-UI/Core/MathSFMLInc.hpp>
 
 namespace sfui
 {
 
+namespace
+{
+
+/// <summary>
+/// Explicit stack of a tree traversal. Storage is reused between traversals, nested traversals
+/// (e.g. drawing another tree from drawSelf) take their own.
+/// </summary>
+template <typename TEntry>
+struct TraversalStack
+{
+	TraversalStack()
+	{
+		auto & pool = getPool();
+		if (!pool.empty())
+		{
+			entries = std::move(pool.back());
+			pool.pop_back();
+		}
+	}
+
+	~TraversalStack()
+	{
+		entries.clear();
+		getPool().push_back(std::move(entries));
+	}
+
+	static std::vector<std::vector<TEntry>>& getPool()
+	{
+		thread_local std::vector<std::vector<TEntry>> pool;
+		return pool;
+	}
+
+	std::vector<TEntry> entries;
+};
+
+/// <summary>
+/// Element on the path from the updated root to the current one.
+/// </summary>
+struct UpdateEntry
+{
+	Element*		element;
+	std::size_t		nextChild;		// Index of the next child to update.
+};
+
+/// <summary>
+/// Element on the path from the drawn root to the current one.
+/// </summary>
+struct DrawEntry
+{
+	Element const*	element;
+	sf::Transform	transform;		// The element's combined transform.
+	std::size_t		nextChild;		// Index of the next child to draw.
+};
+
+}
+
 //////////////////////////////////////////////////////////////////////////////
 Element::Element()
 	:
 	m_parent{ nullptr },
+	m_recycler{ nullptr },
+	m_destructionQueue{ nullptr },
 	m_zIndex{ 0 },
 	m_usesRelativeTransform{ true },
-	m_needsWorldTransformUpdate{ false }
+	m_drawsAfterChildren{ false },
+	m_worldRotation{ 0.f },
+	m_needsWorldTransformUpdate{ true },
+	m_needsWorldDecompositionUpdate{ true }
 {
 }
 
+//////////////////////////////////////////////////////////////////////////////
+Element::~Element()
+{
+	// Take the subtree apart, so every destructor runs on an element without children:
+	ElementPoolType pending;
+	this->releaseChildrenTo(pending);
+
+	while (!pending.empty())
+	{
+		auto element = std::move(pending.back());
+		pending.pop_back();
+
+		if (element.use_count() == 1)
+			element->releaseChildrenTo(pending);
+	}
+}
+
 //////////////////////////////////////////////////////////////////////////////
 bool Element::attach(ElementPtrType && element_, AttachTransform const transform_, AttachPolicy const policy_)
 {
@@ -40,7 +120,22 @@ bool Element::remove(Element const & element_)
 	auto const it = this->findChild(element_);
 	if (it != m_children.end())
 	{
+		auto removed = std::move(*it);
 		m_children.erase(it);
+
+		removed->m_parent = nullptr;
+		Element* const removedElement = removed.get();
+
+		// Park instead of destroying, if its type is recycled, or leave destruction to the queue:
+		if (m_recycler)
+			m_recycler->park(removed);
+
+		// Parked or still owned elsewhere - its world transform must not include the old parent anymore:
+		if (!removed || removed.use_count() > 1)
+			removedElement->invalidateWorldTransform();
+
+		if (removed && m_destructionQueue)
+			m_destructionQueue->enqueue(std::move(removed));
 		return true;
 	}
 	return false;
@@ -84,147 +179,265 @@ void Element::setZIndex(std::int32_t const newZIndex_)
 //////////////////////////////////////////////////////////////////////////////
 void Element::setTransform(sf::Transform const & newTransform_)
 {
-	namespace algo = transform_algorithm;
+	auto const decomposed = transform_algorithm::decompose(newTransform_);
+
+	this->setPosition(decomposed.position);
+	this->setRotation(decomposed.rotation);
+	this->setScale(decomposed.scale);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void Element::setProperty(std::string_view const name_, std::string value_)
+{
+	auto const it = m_properties.find(name_);
+	if (it != m_properties.end())
+		it->second = std::move(value_);
+	else
+		m_properties.emplace(std::string{ name_ }, std::move(value_));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::string const* Element::getProperty(std::string_view const name_) const
+{
+	auto const it = m_properties.find(name_);
+	return it != m_properties.end() ? &it->second : nullptr;
+}
 
-	this->setPosition(algo::extractPosition(newTransform_));
-	this->setRotation(algo::extractRotation(newTransform_));
-	this->setScale(algo::extractScale(newTransform_));
+//////////////////////////////////////////////////////////////////////////////
+bool Element::removeProperty(std::string_view const name_)
+{
+	auto const it = m_properties.find(name_);
+	if (it != m_properties.end())
+	{
+		m_properties.erase(it);
+		return true;
+	}
+	return false;
 }
 
 //////////////////////////////////////////////////////////////////////////////
 sf::Transform Element::getWorldTransform() const
 {
-	if (m_parent && m_usesRelativeTransform)
+	return math::toSFMLTransform(this->getWorldMatrix());
+}
+
+//////////////////////////////////////////////////////////////////////////////
+math::Affine2f const& Element::getWorldMatrix() const
+{
+	if (m_needsWorldTransformUpdate)
 	{
-		if (m_needsWorldTransformUpdate)
+		// Collect dirty ancestors up to the first clean one, then update them top-down (no recursion):
+		TraversalStack<Element const*> path;
+		for (Element const* element = this; element && element->m_needsWorldTransformUpdate; element = element->m_usesRelativeTransform ? element->m_parent : nullptr)
+			path.entries.push_back(element);
+
+		for (auto it = path.entries.rbegin(); it != path.entries.rend(); ++it)
 		{
-			m_needsWorldTransformUpdate = false;
-			m_worldTransform = m_parent->mapToWorldTransform(this->getTransform());
+			Element const* const element = *it;
+			if (element->m_parent && element->m_usesRelativeTransform)
+				element->m_worldMatrix = element->m_parent->m_worldMatrix * math::fromSFMLTransform(element->getTransform());
+			else
+				element->m_worldMatrix = math::fromSFMLTransform(element->getTransform());
+
+			element->m_needsWorldTransformUpdate = false;
 		}
-		return m_worldTransform;
 	}
-	else
-		return this->getTransform();
+	return m_worldMatrix;
 }
 
 //////////////////////////////////////////////////////////////////////////////
 void Element::update(double const deltaTime_, const TimePoint & frameTime_)
 {
-	for (const auto & actor : m_children)
-		actor->update(deltaTime_, frameTime_);
+	this->updateSelf(deltaTime_, frameTime_);
+	if (m_children.empty())
+		return;
+
+	// Only the path to the current element is kept, so the stack grows with depth, not width:
+	TraversalStack<UpdateEntry> stack;
+	stack.entries.push_back({ this, 0 });
+
+	while (!stack.entries.empty())
+	{
+		auto & top = stack.entries.back();
+
+		// Children are indexed at every step, so an element may change its own children in updateSelf:
+		auto const & children = top.element->m_children;
+		if (top.nextChild >= children.size())
+		{
+			stack.entries.pop_back();
+			continue;
+		}
+
+		Element* const child = children[top.nextChild++].get();
+		child->updateSelf(deltaTime_, frameTime_);
+
+		if (!child->m_children.empty())
+			stack.entries.push_back({ child, 0 });
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void Element::updateSelf(double const, const TimePoint &)
+{
 }
 
 //////////////////////////////////////////////////////////////////////////////
 void Element::setPosition(float x_, float y_)
 {
 	sf::Transformable::setPosition(x_, y_);
-	this->invalidateChildrenWorldTransform();
+	this->invalidateWorldTransform();
 }
 
 //////////////////////////////////////////////////////////////////////////////
 void Element::setPosition(const sf::Vector2f& position_)
 {
 	sf::Transformable::setPosition(position_);
-	this->invalidateChildrenWorldTransform();
+	this->invalidateWorldTransform();
 }
 
 //////////////////////////////////////////////////////////////////////////////
 void Element::setRotation(float angle_)
 {
 	sf::Transformable::setRotation(angle_);
-	this->invalidateChildrenWorldTransform();
+	this->invalidateWorldTransform();
 }
 
 //////////////////////////////////////////////////////////////////////////////
 void Element::setScale(float factorX_, float factorY_)
 {
 	sf::Transformable::setScale(factorX_, factorY_);
-	this->invalidateChildrenWorldTransform();
+	this->invalidateWorldTransform();
 }
 
 //////////////////////////////////////////////////////////////////////////////
 void Element::setScale(const sf::Vector2f& factors_)
 {
 	sf::Transformable::setScale(factors_);
-	this->invalidateChildrenWorldTransform();
+	this->invalidateWorldTransform();
 }
 
 //////////////////////////////////////////////////////////////////////////////
 void Element::setOrigin(float x_, float y_)
 {
 	sf::Transformable::setOrigin(x_, y_);
-	this->invalidateChildrenWorldTransform();
+	this->invalidateWorldTransform();
 }
 
 //////////////////////////////////////////////////////////////////////////////
 void Element::setOrigin(const sf::Vector2f& origin_)
 {
 	sf::Transformable::setOrigin(origin_);
-	this->invalidateChildrenWorldTransform();
+	this->invalidateWorldTransform();
 }
 
 //////////////////////////////////////////////////////////////////////////////
 void Element::move(float offsetX_, float offsetY_)
 {
 	sf::Transformable::move(offsetX_, offsetY_);
-	this->invalidateChildrenWorldTransform();
+	this->invalidateWorldTransform();
 }
 
 //////////////////////////////////////////////////////////////////////////////
 void Element::move(const sf::Vector2f& offset_)
 {
 	sf::Transformable::move(offset_);
-	this->invalidateChildrenWorldTransform();
+	this->invalidateWorldTransform();
 }
 
 //////////////////////////////////////////////////////////////////////////////
 void Element::rotate(float angle_)
 {
 	sf::Transformable::rotate(angle_);
-	this->invalidateChildrenWorldTransform();
+	this->invalidateWorldTransform();
 }
 
 //////////////////////////////////////////////////////////////////////////////
 void Element::scale(float factorX_, float factorY_)
 {
 	sf::Transformable::scale(factorX_, factorY_);
-	this->invalidateChildrenWorldTransform();
+	this->invalidateWorldTransform();
 }
 
 //////////////////////////////////////////////////////////////////////////////
 void Element::scale(const sf::Vector2f& factor_)
 {
 	sf::Transformable::scale(factor_);
-	this->invalidateChildrenWorldTransform();
+	this->invalidateWorldTransform();
 }
 
 //////////////////////////////////////////////////////////////////////////////
 sf::Vector2f Element::getWorldPosition() const
 {
-	namespace algo = transform_algorithm;
-	return algo::extractPosition(this->getWorldTransform());
+	this->updateWorldDecomposition();
+	return m_worldPosition;
 }
 
 //////////////////////////////////////////////////////////////////////////////
 float Element::getWorldRotation() const
 {
-	namespace algo = transform_algorithm;
-	return algo::extractRotation(this->getWorldTransform());
+	this->updateWorldDecomposition();
+	return m_worldRotation;
 }
 
 //////////////////////////////////////////////////////////////////////////////
 sf::Vector2f Element::getWorldScale() const
 {
-	namespace algo = transform_algorithm;
-	return algo::extractScale(this->getWorldTransform());
+	this->updateWorldDecomposition();
+	return m_worldScale;
 }
 
 //////////////////////////////////////////////////////////////////////////////
 void Element::draw(sf::RenderTarget & target_, sf::RenderStates states_) const
 {
 	states_.transform *= this->getTransform();
-	for (const auto & actor : m_children)
-		actor->draw(target_, states_);
+	this->drawSelf(target_, states_);
+
+	if (m_children.empty())
+	{
+		if (m_drawsAfterChildren)
+			this->drawAfterChildren(target_, states_);
+		return;
+	}
+
+	// Only the path to the current element is kept, so the stack grows with depth, not width:
+	TraversalStack<DrawEntry> stack;
+	stack.entries.push_back({ this, states_.transform, 0 });
+
+	while (!stack.entries.empty())
+	{
+		auto & top = stack.entries.back();
+
+		auto const & children = top.element->m_children;
+		if (top.nextChild >= children.size())
+		{
+			if (top.element->m_drawsAfterChildren)
+			{
+				states_.transform = top.transform;
+				top.element->drawAfterChildren(target_, states_);
+			}
+			stack.entries.pop_back();
+			continue;
+		}
+
+		Element const* const child = children[top.nextChild++].get();
+		states_.transform = top.transform * child->getTransform();
+		child->drawSelf(target_, states_);
+
+		if (!child->m_children.empty())
+			stack.entries.push_back({ child, states_.transform, 0 });
+		else if (child->m_drawsAfterChildren)
+			child->drawAfterChildren(target_, states_);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void Element::drawSelf(sf::RenderTarget &, sf::RenderStates) const
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void Element::drawAfterChildren(sf::RenderTarget &, sf::RenderStates) const
+{
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -254,10 +467,9 @@ void Element::setParent(Element * parent_, AttachTransform const transform_)
 	}
 	default: ;
 	}
-	m_needsWorldTransformUpdate = true;
-	this->invalidateChildrenWorldTransform();
-
 	m_parent = parent_;
+
+	this->invalidateWorldTransform();
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -300,6 +512,15 @@ Element::ElementPoolType::const_iterator Element::findPlaceForNewElement(const E
 		});
 }
 
+//////////////////////////////////////////////////////////////////////////////
+void Element::whenRecycled()
+{
+	this->setTransform(sf::Transform::Identity);
+	this->setOrigin(0.f, 0.f);
+	m_zIndex = 0;
+	m_properties.clear();
+}
+
 //////////////////////////////////////////////////////////////////////////////
 void Element::whenChildChangesZIndex(Element & element_)
 {
@@ -325,29 +546,87 @@ void Element::reinsertChildWithOrder(Element & element_)
 	if (it == m_children.end())
 		throw std::invalid_argument("Given element is not a child of this element.");
 
-	// Store rvalue reference to found element before iterators will be invalidated.
-	ElementPtrType&& rRef = std::move(*it);
+	// Take ownership of found element before iterators will be invalidated (a reference would point into the erased slot).
+	ElementPtrType element = std::move(*it);
 
 	// Erase empty child:
 	m_children.erase(it);
 
 	// Find the place where it should be reinserted:
-	auto const whereToInsert = this->findPlaceForNewElement(*rRef);
+	auto const whereToInsert = this->findPlaceForNewElement(*element);
 
 	// Insert it:
-	m_children.emplace( whereToInsert, std::forward<ElementPtrType>(rRef) );
+	m_children.emplace( whereToInsert, std::move(element) );
+}
 
-	// rRef is invalid here. 
+//////////////////////////////////////////////////////////////////////////////
+void Element::invalidateWorldTransform()
+{
+	m_needsWorldDecompositionUpdate = true;
+
+	// Dirty element always has dirty descendants - no need to visit them again.
+	if (m_needsWorldTransformUpdate)
+		return;
+
+	m_needsWorldTransformUpdate = true;
+	this->invalidateChildrenWorldTransform();
 }
 
 //////////////////////////////////////////////////////////////////////////////
 void Element::invalidateChildrenWorldTransform()
+{
+	if (m_children.empty())
+		return;
+
+	TraversalStack<Element*> stack;
+	for (auto & child : m_children)
+		stack.entries.push_back(child.get());
+
+	while (!stack.entries.empty())
+	{
+		Element* const element = stack.entries.back();
+		stack.entries.pop_back();
+
+		element->m_needsWorldDecompositionUpdate = true;
+
+		// Dirty element always has dirty descendants - no need to visit them again.
+		if (element->m_needsWorldTransformUpdate)
+			continue;
+
+		element->m_needsWorldTransformUpdate = true;
+		for (auto & child : element->m_children)
+			stack.entries.push_back(child.get());
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void Element::releaseChildrenTo(ElementPoolType & pending_)
 {
 	for (auto & child : m_children)
 	{
-		child->m_needsWorldTransformUpdate = true;
-		child->invalidateChildrenWorldTransform();
+		child->m_parent = nullptr;
+
+		// Child outliving its parent must not keep world transform that includes it:
+		if (child.use_count() > 1)
+			child->invalidateWorldTransform();
+
+		pending_.push_back(std::move(child));
 	}
+	m_children.clear();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void Element::updateWorldDecomposition() const
+{
+	if (!m_needsWorldDecompositionUpdate)
+		return;
+
+	auto const decomposed = transform_algorithm::decompose(this->getWorldMatrix());
+	m_worldPosition		= decomposed.position;
+	m_worldRotation		= decomposed.rotation;
+	m_worldScale		= decomposed.scale;
+
+	m_needsWorldDecompositionUpdate = false;
 }
 
 }
@@ -0,0 +1,105 @@
+#include "SFMLUIPCH.hpp"
+
+#include <SFML-UI/ElementRecycler.hpp>
+#include <SFML-UI/Element.hpp>
+#include <SFML-UI/ElementTraversal.hpp>
+#include <SFML-UI/Animation/AnimationEngine.hpp>
+
+namespace sfui
+{
+
+//////////////////////////////////////////////////////////////////////////////
+void ElementRecycler::enable(std::type_index const type_, std::size_t const capacity_)
+{
+	Pool & pool = m_pools[type_];
+	pool.capacity = capacity_;
+	if (pool.parked.size() > capacity_)
+		pool.parked.resize(capacity_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+ElementRecycler::ElementPtrType ElementRecycler::acquire(std::type_index const type_)
+{
+	auto const it = m_pools.find(type_);
+	if (it == m_pools.end())
+		return nullptr;
+
+	Pool & pool = it->second;
+	++pool.stats.spawnCount;
+	if (pool.parked.empty())
+		return nullptr;
+
+	auto element = std::move(pool.parked.back());
+	pool.parked.pop_back();
+	++pool.stats.reuseCount;
+	return element;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+bool ElementRecycler::park(ElementPtrType & element_)
+{
+	if (!element_)
+		return false;
+
+	auto const it = m_pools.find(std::type_index{ typeid(*element_) });
+	if (it == m_pools.end())
+		return false;
+
+	Pool & pool = it->second;
+	if (pool.parked.size() >= pool.capacity || element_.use_count() > 1)
+	{
+		++pool.stats.discardCount;
+		return false;
+	}
+
+	// Tweens would keep writing to the element after it is reused:
+	if (m_animationEngine && m_animationEngine->getTweenCount() > 0)
+	{
+		for (auto const & element : preorder(*element_))
+			m_animationEngine->cancel(element);
+	}
+
+	element_->whenRecycled();
+	pool.parked.push_back(std::move(element_));
+	++pool.stats.parkCount;
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void ElementRecycler::clear()
+{
+	for (auto & [type, pool] : m_pools)
+		pool.parked.clear();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+ElementRecycler::Stats ElementRecycler::getStats(std::type_index const type_) const
+{
+	auto const it = m_pools.find(type_);
+	return it != m_pools.end() ? it->second.stats : Stats{};
+}
+
+//////////////////////////////////////////////////////////////////////////////
+ElementRecycler::Stats ElementRecycler::getTotalStats() const
+{
+	Stats total;
+	for (auto const & [type, pool] : m_pools)
+	{
+		total.spawnCount	+= pool.stats.spawnCount;
+		total.reuseCount	+= pool.stats.reuseCount;
+		total.parkCount		+= pool.stats.parkCount;
+		total.discardCount	+= pool.stats.discardCount;
+	}
+	return total;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::size_t ElementRecycler::getParkedCount() const
+{
+	std::size_t count = 0;
+	for (auto const & [type, pool] : m_pools)
+		count += pool.parked.size();
+	return count;
+}
+
+}
@@ -0,0 +1,126 @@
+#include "SFMLUIPCH.hpp"
+
+#include <SFML-UI/Elements/AtlasSprite.hpp>
+#include <SFML-UI/Elements/TextBatch.hpp>
+
+namespace sfui
+{
+
+//////////////////////////////////////////////////////////////////////////////
+AtlasSprite::AtlasSprite(TextureAtlas & atlas_, TextureAtlas::RegionId const region_)
+	:
+	m_atlas{ &atlas_ },
+	m_region{ TextureAtlas::InvalidRegion },
+	m_color{ sf::Color::White },
+	m_needsUpdate{ true }
+{
+	this->setRegion(region_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void AtlasSprite::setRegion(TextureAtlas::RegionId const region_)
+{
+	m_region = region_;
+
+	auto const region = m_atlas->find(region_);
+	m_size = region ? sf::Vector2f{ static_cast<float>(region->rect.width), static_cast<float>(region->rect.height) } : sf::Vector2f{};
+	m_needsUpdate = true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void AtlasSprite::setSize(sf::Vector2f const & size_)
+{
+	m_size			= size_;
+	m_needsUpdate	= true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void AtlasSprite::setBorders(Borders const & borders_)
+{
+	m_borders		= borders_;
+	m_needsUpdate	= true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void AtlasSprite::setColor(sf::Color const color_)
+{
+	m_color			= color_;
+	m_needsUpdate	= true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void AtlasSprite::drawSelf(sf::RenderTarget & target_, sf::RenderStates states_) const
+{
+	auto const region = this->updateVertices();
+	if (region && !m_vertices.empty())
+	{
+		if (auto const batch = TextBatch::active())
+			batch->append(region->texture, nullptr, m_vertices, states_.transform, m_color);
+		else
+		{
+			states_.texture = region->texture;
+			target_.draw(m_vertices.data(), m_vertices.size(), sf::Triangles, states_);
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::optional<TextureAtlas::Region> AtlasSprite::updateVertices() const
+{
+	auto const region = m_atlas->find(m_region);
+	if (!region)
+	{
+		m_vertices.clear();
+		return std::nullopt;
+	}
+
+	// Regions move when the atlas is repacked:
+	if (!m_needsUpdate && m_builtRect == region->rect)
+		return region;
+
+	m_vertices.clear();
+
+	sf::IntRect const & rect = region->rect;
+	float const u[4] = {
+			static_cast<float>(rect.left),
+			static_cast<float>(rect.left) + m_borders.left,
+			static_cast<float>(rect.left + rect.width) - m_borders.right,
+			static_cast<float>(rect.left + rect.width)
+		};
+	float const v[4] = {
+			static_cast<float>(rect.top),
+			static_cast<float>(rect.top) + m_borders.top,
+			static_cast<float>(rect.top + rect.height) - m_borders.bottom,
+			static_cast<float>(rect.top + rect.height)
+		};
+	float const x[4] = { 0.f, m_borders.left, m_size.x - m_borders.right, m_size.x };
+	float const y[4] = { 0.f, m_borders.top, m_size.y - m_borders.bottom, m_size.y };
+
+	for (std::size_t row = 0; row < 3; ++row)
+	{
+		for (std::size_t column = 0; column < 3; ++column)
+		{
+			// Skip empty slices (every slice except the center one when borders are zero):
+			if (x[column] == x[column + 1] || y[row] == y[row + 1])
+				continue;
+
+			sf::Vertex const topLeft		{ sf::Vector2f{ x[column], y[row] },			m_color, sf::Vector2f{ u[column], v[row] } };
+			sf::Vertex const topRight		{ sf::Vector2f{ x[column + 1], y[row] },		m_color, sf::Vector2f{ u[column + 1], v[row] } };
+			sf::Vertex const bottomLeft		{ sf::Vector2f{ x[column], y[row + 1] },		m_color, sf::Vector2f{ u[column], v[row + 1] } };
+			sf::Vertex const bottomRight	{ sf::Vector2f{ x[column + 1], y[row + 1] },	m_color, sf::Vector2f{ u[column + 1], v[row + 1] } };
+
+			m_vertices.push_back(topLeft);
+			m_vertices.push_back(topRight);
+			m_vertices.push_back(bottomLeft);
+			m_vertices.push_back(bottomLeft);
+			m_vertices.push_back(topRight);
+			m_vertices.push_back(bottomRight);
+		}
+	}
+
+	m_builtRect		= rect;
+	m_needsUpdate	= false;
+	return region;
+}
+
+}
@@ -0,0 +1,402 @@
+#include "SFMLUIPCH.hpp"
+
+#include <SFML-UI/Elements/Chart.hpp>
+
+namespace sfui
+{
+
+namespace
+{
+
+constexpr std::size_t PyramidFactor	= std::size_t{ 1 } << Chart::PyramidFactorLog2;
+constexpr std::size_t PyramidMask	= PyramidFactor - 1;
+
+}
+
+//////////////////////////////////////////////////////////////////////////////
+Chart::Chart()
+	:
+	m_size{ 0.f, 0.f },
+	m_xMin{ 0 },
+	m_xSpan{ 1 },
+	m_yMin{ 0.f },
+	m_yMax{ 1.f },
+	m_summarizedColumnCount{ 0 },
+	m_needsRefresh{ true }
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::size_t Chart::addSeries(sf::Color const color_)
+{
+	m_series.emplace_back().color = color_;
+	m_needsRefresh = true;
+	return m_series.size() - 1;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void Chart::append(std::size_t const series_, double const x_, float const y_)
+{
+	this->append(series_, std::span<double const>{ &x_, 1 }, std::span<float const>{ &y_, 1 });
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void Chart::append(std::size_t const series_, std::span<double const> const xs_, std::span<float const> const ys_)
+{
+	Series & series = this->getSeries(series_);
+
+	if (xs_.size() != ys_.size())
+		throw std::invalid_argument("Chart requires the same number of x values and values.");
+	if (xs_.empty())
+		return;
+
+	// Validate everything first, so the series stays unchanged on failure:
+	if (!series.x.empty() && xs_.front() < series.x.back())
+		throw std::invalid_argument("Chart x values must be ascending.");
+	if (std::adjacent_find(xs_.begin(), xs_.end(), std::greater<double>{}) != xs_.end())
+		throw std::invalid_argument("Chart x values must be ascending.");
+
+	series.dirtyFrom = std::min(series.dirtyFrom, series.x.size());
+	series.x.insert(series.x.end(), xs_.begin(), xs_.end());
+
+	for (float const y : ys_)
+	{
+		series.y.push_back(y);
+		updatePyramid(series);
+	}
+
+	m_needsRefresh = true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void Chart::clearSeries(std::size_t const series_)
+{
+	Series & series = this->getSeries(series_);
+
+	series.x.clear();
+	series.y.clear();
+	series.minLevels.clear();
+	series.maxLevels.clear();
+	series.columns.clear();
+	series.dirtyFrom = 0;
+
+	m_needsRefresh = true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void Chart::setSize(sf::Vector2f const & size_)
+{
+	if (size_ != m_size)
+	{
+		m_size			= size_;
+		m_needsRefresh	= true;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void Chart::setXRange(double const min_, double const max_)
+{
+	if (!(max_ > min_))
+		throw std::invalid_argument("Chart x range must not be empty.");
+
+	m_xMin			= min_;
+	m_xSpan			= max_ - min_;
+	m_needsRefresh	= true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void Chart::setYRange(float const min_, float const max_)
+{
+	if (!(max_ > min_))
+		throw std::invalid_argument("Chart value range must not be empty.");
+
+	m_yMin			= min_;
+	m_yMax			= max_;
+	m_needsRefresh	= true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void Chart::pan(double const delta_)
+{
+	m_xMin			+= delta_;
+	m_needsRefresh	= true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void Chart::zoom(double const factor_, double const anchor_)
+{
+	if (!(factor_ > 0))
+		throw std::invalid_argument("Chart zoom factor must be positive.");
+
+	m_xMin			= anchor_ - (anchor_ - m_xMin) / factor_;
+	m_xSpan			/= factor_;
+	m_needsRefresh	= true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void Chart::fitX()
+{
+	double min = std::numeric_limits<double>::infinity();
+	double max = -std::numeric_limits<double>::infinity();
+	for (Series const & series : m_series)
+	{
+		if (!series.x.empty())
+		{
+			min = std::min(min, series.x.front());
+			max = std::max(max, series.x.back());
+		}
+	}
+
+	if (min > max)
+		return;
+	if (min == max)
+		this->setXRange(min - 0.5, max + 0.5);
+	else
+		this->setXRange(min, max);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void Chart::fitY()
+{
+	// Cached column summaries already know extremes of the visible points:
+	if (m_needsRefresh)
+		this->refresh();
+
+	float min = std::numeric_limits<float>::infinity();
+	float max = -std::numeric_limits<float>::infinity();
+	for (Series const & series : m_series)
+	{
+		for (ColumnSummary const & column : series.columns)
+		{
+			if (column.begin != column.end)
+			{
+				min = std::min(min, column.min);
+				max = std::max(max, column.max);
+			}
+		}
+	}
+
+	if (min > max)
+		return;
+	if (min == max)
+		this->setYRange(min - 0.5f, max + 0.5f);
+	else
+		this->setYRange(min, max);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void Chart::refresh()
+{
+	m_needsRefresh = false;
+	m_vertices.clear();
+
+	if (m_size.x <= 0.f || m_size.y <= 0.f)
+		return;
+
+	double const columnWidth		= m_xSpan / m_size.x;
+	double const columnOffset		= m_xMin / columnWidth;		// Pixel x of column c is c - columnOffset.
+	auto const firstColumn			= static_cast<std::int64_t>(std::floor(columnOffset));
+	auto const endColumn			= firstColumn + static_cast<std::int64_t>(std::ceil(m_size.x)) + 1;
+	float const yScale				= m_size.y / (m_yMax - m_yMin);
+
+	for (Series & series : m_series)
+	{
+		this->updateColumns(series, columnWidth, firstColumn, endColumn);
+		if (series.x.empty())
+			continue;
+
+		auto const pointAt = [&](std::size_t const index_) {
+			return sf::Vector2f{
+					static_cast<float>((series.x[index_] - m_xMin) / columnWidth),
+					m_size.y - (series.y[index_] - m_yMin) * yScale
+				};
+		};
+
+		bool hasPrevious = false;
+		sf::Vector2f previous;
+		auto const lineTo = [&](sf::Vector2f const & point_) {
+			if (hasPrevious)
+			{
+				m_vertices.emplace_back(previous, series.color);
+				m_vertices.emplace_back(point_, series.color);
+			}
+			previous	= point_;
+			hasPrevious	= true;
+		};
+
+		// Connect to the nearest point on the left:
+		if (std::size_t const begin = series.columns.front().begin; begin > 0)
+			lineTo(pointAt(begin - 1));
+
+		// First point, extremes (in the middle of the column) and last point of every column:
+		for (std::size_t i = 0; i < series.columns.size(); ++i)
+		{
+			ColumnSummary const & column = series.columns[i];
+			std::size_t const count = column.end - column.begin;
+			if (count == 0)
+				continue;
+
+			lineTo(pointAt(column.begin));
+			if (count > 2)
+			{
+				auto const centerX = static_cast<float>(static_cast<double>(firstColumn + static_cast<std::int64_t>(i)) - columnOffset + 0.5);
+				lineTo({ centerX, m_size.y - (column.min - m_yMin) * yScale });
+				lineTo({ centerX, m_size.y - (column.max - m_yMin) * yScale });
+			}
+			if (count > 1)
+				lineTo(pointAt(column.end - 1));
+		}
+
+		// Connect to the nearest point on the right:
+		if (std::size_t const end = series.columns.back().end; end < series.x.size())
+			lineTo(pointAt(end));
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void Chart::updateSelf(double const, TimePoint const &)
+{
+	if (m_needsRefresh)
+		this->refresh();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void Chart::drawSelf(sf::RenderTarget & target_, sf::RenderStates states_) const
+{
+	if (!m_vertices.empty())
+		target_.draw(m_vertices.data(), m_vertices.size(), sf::Lines, states_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void Chart::updatePyramid(Series & series_)
+{
+	// Every complete block of the previous level adds an entry to the next one:
+	std::size_t count = series_.y.size();
+	for (std::size_t level = 0; (count & PyramidMask) == 0; ++level)
+	{
+		if (level == series_.minLevels.size())
+		{
+			series_.minLevels.emplace_back();
+			series_.maxLevels.emplace_back();
+		}
+
+		float const* mins = level == 0 ? series_.y.data() : series_.minLevels[level - 1].data();
+		float const* maxs = level == 0 ? series_.y.data() : series_.maxLevels[level - 1].data();
+
+		float min = mins[count - PyramidFactor];
+		float max = maxs[count - PyramidFactor];
+		for (std::size_t i = count - PyramidFactor + 1; i < count; ++i)
+		{
+			min = std::min(min, mins[i]);
+			max = std::max(max, maxs[i]);
+		}
+
+		series_.minLevels[level].push_back(min);
+		series_.maxLevels[level].push_back(max);
+		count = series_.minLevels[level].size();
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::pair<float, float> Chart::findMinMax(Series const & series_, std::size_t begin_, std::size_t end_)
+{
+	float min = std::numeric_limits<float>::infinity();
+	float max = -std::numeric_limits<float>::infinity();
+
+	float const* mins = series_.y.data();
+	float const* maxs = series_.y.data();
+	auto const take = [&](std::size_t const from_, std::size_t const to_) {
+		for (std::size_t i = from_; i < to_; ++i)
+		{
+			min = std::min(min, mins[i]);
+			max = std::max(max, maxs[i]);
+		}
+	};
+
+	// Take unaligned edges at the current level and continue with complete blocks one level up:
+	for (std::size_t level = 0; begin_ < end_; ++level)
+	{
+		std::size_t const alignedBegin	= (begin_ + PyramidMask) & ~PyramidMask;
+		std::size_t const alignedEnd	= end_ & ~PyramidMask;
+		if (level == series_.minLevels.size() || alignedBegin >= alignedEnd)
+		{
+			take(begin_, end_);
+			break;
+		}
+
+		take(begin_, alignedBegin);
+		take(alignedEnd, end_);
+
+		begin_	= alignedBegin >> Chart::PyramidFactorLog2;
+		end_	= alignedEnd >> Chart::PyramidFactorLog2;
+		mins	= series_.minLevels[level].data();
+		maxs	= series_.maxLevels[level].data();
+	}
+
+	return { min, max };
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void Chart::updateColumns(Series & series_, double const columnWidth_, std::int64_t const firstColumn_, std::int64_t const endColumn_)
+{
+	if (series_.columnWidth != columnWidth_)
+	{
+		series_.columns.clear();
+		series_.columnWidth = columnWidth_;
+	}
+
+	// Forget columns that appended points may have changed (one more to be safe from rounding):
+	if (series_.dirtyFrom < series_.x.size())
+	{
+		auto const dirtyColumn	= static_cast<std::int64_t>(std::floor(series_.x[series_.dirtyFrom] / columnWidth_)) - 1;
+		auto const keptColumns	= std::clamp<std::int64_t>(dirtyColumn - series_.firstColumn, 0, static_cast<std::int64_t>(series_.columns.size()));
+		series_.columns.resize(static_cast<std::size_t>(keptColumns));
+	}
+	series_.dirtyFrom = series_.x.size();
+
+	auto const cachedEnd = series_.firstColumn + static_cast<std::int64_t>(series_.columns.size());
+
+	m_scratchColumns.clear();
+	for (std::int64_t column = firstColumn_; column < endColumn_; ++column)
+	{
+		if (column >= series_.firstColumn && column < cachedEnd)
+		{
+			m_scratchColumns.push_back(series_.columns[static_cast<std::size_t>(column - series_.firstColumn)]);
+			continue;
+		}
+
+		// Column starts where the previous one ends:
+		std::size_t begin;
+		if (!m_scratchColumns.empty())
+			begin = m_scratchColumns.back().end;
+		else
+			begin = static_cast<std::size_t>(std::lower_bound(series_.x.begin(), series_.x.end(), static_cast<double>(column) * columnWidth_) - series_.x.begin());
+
+		// Columns past the last point are empty (common case when following appended points):
+		if (begin == series_.x.size())
+		{
+			m_scratchColumns.push_back({ begin, begin, 0.f, 0.f });
+			continue;
+		}
+
+		auto const end = static_cast<std::size_t>(std::lower_bound(series_.x.begin() + static_cast<std::ptrdiff_t>(begin), series_.x.end(), static_cast<double>(column + 1) * columnWidth_) - series_.x.begin());
+
+		auto const [min, max] = findMinMax(series_, begin, end);
+		m_scratchColumns.push_back({ begin, end, min, max });
+		++m_summarizedColumnCount;
+	}
+
+	std::swap(series_.columns, m_scratchColumns);
+	series_.firstColumn = firstColumn_;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+Chart::Series& Chart::getSeries(std::size_t const series_)
+{
+	if (series_ >= m_series.size())
+		throw std::out_of_range("Chart series index out of range.");
+
+	return m_series[series_];
+}
+
+}
@@ -0,0 +1,388 @@
+#include "SFMLUIPCH.hpp"
+
+#include <SFML-UI/Elements/DataGrid.hpp>
+
+#include <numeric>
+
+namespace sfui
+{
+
+//////////////////////////////////////////////////////////////////////////////
+DataGrid::DataGrid(CellFactoryType factory_, CellBinderType binder_)
+	:
+	m_factory{ std::move(factory_) },
+	m_binder{ std::move(binder_) },
+	m_rowCount{ 0 },
+	m_rowHeight{ 20.f },
+	m_scrollOffset{ 0, 0 },
+	m_viewportSize{ 0.f, 0.f },
+	m_rowOverscan{ 2 },
+	m_columnOverscan{ 1 },
+	m_firstBoundRow{ 0 },
+	m_firstBoundColumn{ 0 },
+	m_boundRowCount{ 0 },
+	m_boundColumnCount{ 0 },
+	m_createdCellElementCount{ 0 },
+	m_bindCount{ 0 },
+	m_needsSort{ false },
+	m_needsFilter{ false },
+	m_needsRefresh{ false }
+{
+	if (!m_factory || !m_binder)
+		throw std::invalid_argument("Data grid requires both cell factory and cell binder.");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void DataGrid::setViewportSize(sf::Vector2f const & size_)
+{
+	m_viewportSize	= { std::max(size_.x, 0.f), std::max(size_.y, 0.f) };
+	m_needsRefresh	= true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void DataGrid::setOverscan(std::size_t const rows_, std::size_t const columns_)
+{
+	m_rowOverscan		= rows_;
+	m_columnOverscan	= columns_;
+	m_needsRefresh		= true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void DataGrid::setRowCount(std::size_t const count_)
+{
+	if (count_ > std::numeric_limits<RowIndexType>::max())
+		throw std::length_error("Data grid row count exceeds the limit.");
+
+	m_rowCount		= count_;
+	m_needsSort		= true;
+	m_needsRefresh	= true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void DataGrid::setRowHeight(float const height_)
+{
+	m_rowHeight		= std::max(height_, 0.f);
+	m_needsRefresh	= true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void DataGrid::setColumnCount(std::size_t const count_, float const width_)
+{
+	m_columnWidths.resize(count_, std::max(width_, 0.f));
+	m_columnKinds.resize(count_, 0);
+	m_needsRefresh = true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void DataGrid::setColumnWidth(std::size_t const column_, float const width_)
+{
+	m_columnWidths.set(column_, std::max(width_, 0.f));
+	m_needsRefresh = true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void DataGrid::setColumnKind(std::size_t const column_, std::size_t const kind_)
+{
+	if (column_ >= m_columnKinds.size())
+		throw std::out_of_range("Data grid column index out of range.");
+
+	if (m_columnKinds[column_] == kind_)
+		return;
+
+	// Bound cells of the column have elements of previous kind:
+	if (column_ >= m_firstBoundColumn && column_ - m_firstBoundColumn < m_boundColumnCount)
+	{
+		for (std::size_t r = 0; r < m_boundRowCount; ++r)
+		{
+			BoundCell & cell = m_boundCells[r * m_boundColumnCount + (column_ - m_firstBoundColumn)];
+			if (!cell.element)
+				continue;	// Unbound cell, or kind was already changed since the last refresh.
+
+			this->detach(*cell.element);
+			cell.element.reset();
+		}
+	}
+
+	m_columnKinds[column_]	= kind_;
+	m_needsRefresh			= true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void DataGrid::sortBy(RowComparerType comparer_)
+{
+	m_comparer		= std::move(comparer_);
+	m_needsSort		= true;
+	m_needsRefresh	= true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void DataGrid::clearSort()
+{
+	this->sortBy(nullptr);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void DataGrid::filterBy(RowFilterType filter_)
+{
+	m_filter		= std::move(filter_);
+	m_needsFilter	= true;
+	m_needsRefresh	= true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void DataGrid::clearFilter()
+{
+	this->filterBy(nullptr);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void DataGrid::invalidateData()
+{
+	for (auto & cell : m_boundCells)
+		cell.needsBind = true;
+
+	m_needsSort		= true;
+	m_needsRefresh	= true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void DataGrid::setScrollOffset(sf::Vector2<double> const & offset_)
+{
+	sf::Vector2<double> const content = this->getContentSize();
+
+	m_scrollOffset.x	= std::clamp(offset_.x, 0.0, std::max(0.0, content.x - m_viewportSize.x));
+	m_scrollOffset.y	= std::clamp(offset_.y, 0.0, std::max(0.0, content.y - m_viewportSize.y));
+	m_needsRefresh		= true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void DataGrid::scrollBy(sf::Vector2<double> const & delta_)
+{
+	this->setScrollOffset(m_scrollOffset + delta_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void DataGrid::refresh()
+{
+	m_needsRefresh = false;
+
+	this->updateView();
+
+	// Content size might have changed since the offset was set:
+	this->setScrollOffset(m_scrollOffset);
+	m_needsRefresh = false;
+
+	std::size_t const rowCount		= m_viewRows.size();
+	std::size_t const columnCount	= m_columnWidths.getSize();
+
+	// Find the bound range:
+	std::size_t firstRow = 0, endRow = 0;
+	if (rowCount > 0 && m_rowHeight > 0 && m_viewportSize.y > 0)
+	{
+		firstRow	= std::min(static_cast<std::size_t>(m_scrollOffset.y / m_rowHeight), rowCount - 1);
+		endRow		= std::min(static_cast<std::size_t>((m_scrollOffset.y + m_viewportSize.y) / m_rowHeight) + 1, rowCount);
+
+		firstRow	-= std::min(firstRow, m_rowOverscan);
+		endRow		= std::min(rowCount, endRow + std::min(m_rowOverscan, rowCount));
+	}
+
+	std::size_t firstColumn = 0, endColumn = 0;
+	if (columnCount > 0 && m_viewportSize.x > 0 && endRow > firstRow)
+	{
+		firstColumn	= m_columnWidths.findIndex(m_scrollOffset.x);
+		endColumn	= m_columnWidths.findIndex(m_scrollOffset.x + m_viewportSize.x) + 1;
+
+		firstColumn	-= std::min(firstColumn, m_columnOverscan);
+		endColumn	= std::min(columnCount, endColumn + std::min(m_columnOverscan, columnCount));
+	}
+
+	std::size_t const boundRows		= endRow - firstRow;
+	std::size_t const boundColumns	= endColumn - firstColumn;
+
+	std::size_t const kindCount = m_columnKinds.empty() ? 0 : *std::max_element(m_columnKinds.begin(), m_columnKinds.end()) + 1;
+	if (m_releasedCellElements.size() < kindCount)
+	{
+		m_releasedCellElements.resize(kindCount);
+		m_spareCellElements.resize(kindCount);
+	}
+
+	// Keep elements of cells that stay bound, release the rest to their column kind:
+	m_scratchCells.clear();
+	m_scratchCells.resize(boundRows * boundColumns);
+
+	for (std::size_t r = 0; r < m_boundRowCount; ++r)
+	{
+		std::size_t const row = m_firstBoundRow + r;
+		for (std::size_t c = 0; c < m_boundColumnCount; ++c)
+		{
+			std::size_t const column	= m_firstBoundColumn + c;
+			BoundCell & cell			= m_boundCells[r * m_boundColumnCount + c];
+
+			if (row >= firstRow && row < endRow && column >= firstColumn && column < endColumn)
+				m_scratchCells[(row - firstRow) * boundColumns + (column - firstColumn)] = std::move(cell);
+			else if (!cell.element)
+				continue;
+			else if (column < columnCount)
+				m_releasedCellElements[m_columnKinds[column]].push_back(std::move(cell.element));
+			else
+				this->detach(*cell.element);	// Column was removed, its kind is not known anymore.
+		}
+	}
+
+	// Bind cells that came into view, place every bound cell:
+	double const columnsLeft = m_columnWidths.getOffset(firstColumn);
+	for (std::size_t r = 0; r < boundRows; ++r)
+	{
+		std::size_t const row		= firstRow + r;
+		RowIndexType const dataRow	= m_viewRows[row];
+		auto const y				= static_cast<float>(static_cast<double>(row) * m_rowHeight - m_scrollOffset.y);
+
+		double columnLeft = columnsLeft;
+		for (std::size_t c = 0; c < boundColumns; ++c)
+		{
+			std::size_t const column	= firstColumn + c;
+			BoundCell & cell			= m_scratchCells[r * boundColumns + c];
+
+			if (!cell.element)
+			{
+				cell.element	= this->acquireCellElement(column);
+				cell.needsBind	= true;
+			}
+
+			// Sorting or filtering may display different data row at the same position:
+			if (cell.needsBind || cell.dataRow != dataRow)
+			{
+				m_binder(*cell.element, dataRow, column);
+				cell.dataRow	= dataRow;
+				cell.needsBind	= false;
+				++m_bindCount;
+			}
+
+			sf::Vector2f const position{ static_cast<float>(columnLeft - m_scrollOffset.x), y };
+			if (cell.element->getPosition() != position)
+				cell.element->setPosition(position);
+
+			columnLeft += m_columnWidths.get(column);
+		}
+	}
+
+	// Fewer cells are bound than before, keep the rest for later:
+	for (std::size_t kind = 0; kind < m_releasedCellElements.size(); ++kind)
+	{
+		for (auto & element : m_releasedCellElements[kind])
+		{
+			this->detach(*element);
+			m_spareCellElements[kind].push_back(std::move(element));
+		}
+		m_releasedCellElements[kind].clear();
+	}
+
+	m_boundCells.swap(m_scratchCells);
+	m_firstBoundRow		= firstRow;
+	m_firstBoundColumn	= firstColumn;
+	m_boundRowCount		= boundRows;
+	m_boundColumnCount	= boundColumns;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+Element* DataGrid::getCellElement(std::size_t const viewRow_, std::size_t const column_) const
+{
+	if (viewRow_ < m_firstBoundRow || viewRow_ - m_firstBoundRow >= m_boundRowCount
+		|| column_ < m_firstBoundColumn || column_ - m_firstBoundColumn >= m_boundColumnCount)
+		return nullptr;
+
+	return m_boundCells[(viewRow_ - m_firstBoundRow) * m_boundColumnCount + (column_ - m_firstBoundColumn)].element.get();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::optional<std::pair<std::size_t, std::size_t>> DataGrid::findCellAt(sf::Vector2f const & point_) const
+{
+	sf::Vector2<double> const offset{ m_scrollOffset.x + point_.x, m_scrollOffset.y + point_.y };
+	sf::Vector2<double> const content = this->getContentSize();
+
+	if (point_.x < 0 || point_.y < 0 || offset.x >= content.x || offset.y >= content.y)
+		return std::nullopt;
+
+	std::size_t const row = std::min(static_cast<std::size_t>(offset.y / m_rowHeight), m_viewRows.size() - 1);
+	return std::pair{ row, m_columnWidths.findIndex(offset.x) };
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void DataGrid::updateSelf(double const, TimePoint const &)
+{
+	if (m_needsRefresh)
+		this->refresh();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void DataGrid::updateView()
+{
+	if (m_needsSort)
+	{
+		m_sortedRows.resize(m_rowCount);
+		std::iota(m_sortedRows.begin(), m_sortedRows.end(), RowIndexType{ 0 });
+
+		if (m_comparer)
+		{
+			std::stable_sort(m_sortedRows.begin(), m_sortedRows.end(),
+				[this](RowIndexType const lhs_, RowIndexType const rhs_)
+				{
+					return m_comparer(lhs_, rhs_);
+				});
+		}
+
+		m_needsSort		= false;
+		m_needsFilter	= true;
+	}
+
+	if (m_needsFilter)
+	{
+		if (m_filter)
+		{
+			m_viewRows.clear();
+			std::copy_if(m_sortedRows.begin(), m_sortedRows.end(), std::back_inserter(m_viewRows),
+				[this](RowIndexType const row_)
+				{
+					return m_filter(row_);
+				});
+		}
+		else
+			m_viewRows = m_sortedRows;
+
+		m_needsFilter = false;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+DataGrid::ElementPtrType DataGrid::acquireCellElement(std::size_t const column_)
+{
+	std::size_t const kind = m_columnKinds[column_];
+
+	// Released elements are still attached:
+	if (auto & released = m_releasedCellElements[kind]; !released.empty())
+	{
+		ElementPtrType element = std::move(released.back());
+		released.pop_back();
+		return element;
+	}
+
+	ElementPtrType element;
+	if (auto & spare = m_spareCellElements[kind]; !spare.empty())
+	{
+		element = std::move(spare.back());
+		spare.pop_back();
+	}
+	else
+	{
+		element = m_factory(column_);
+		if (!element)
+			throw std::runtime_error("Data grid cell factory returned no element.");
+
+		++m_createdCellElementCount;
+	}
+
+	this->attach(ElementPtrType{ element }, AttachTransform::SnapToTarget, AttachPolicy::Unchecked);
+	return element;
+}
+
+}
@@ -0,0 +1,123 @@
+#include "SFMLUIPCH.hpp"
+
+#include <SFML-UI/Elements/Label.hpp>
+#include <SFML-UI/Elements/TextBatch.hpp>
+
+namespace sfui
+{
+
+//////////////////////////////////////////////////////////////////////////////
+Label::Label()
+	:
+	m_font{ nullptr },
+	m_characterSize{ 30 },
+	m_color{ sf::Color::White },
+	m_runCache{ &TextRunCache::shared() },
+	m_needsColorUpdate{ true }
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+Label::Label(sf::Font const & font_, unsigned const characterSize_, sf::String const & string_)
+	:
+	Label()
+{
+	m_font			= &font_;
+	m_characterSize	= characterSize_;
+	m_string		= string_;
+	this->updateRun();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void Label::setString(sf::String const & string_)
+{
+	if (m_string == string_)
+		return;
+
+	m_string = string_;
+	this->updateRun();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void Label::setFont(sf::Font const & font_)
+{
+	if (m_font == &font_)
+		return;
+
+	m_font = &font_;
+	this->updateRun();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void Label::setCharacterSize(unsigned const characterSize_)
+{
+	if (m_characterSize == characterSize_)
+		return;
+
+	m_characterSize = characterSize_;
+	this->updateRun();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void Label::setColor(sf::Color const color_)
+{
+	if (m_color == color_)
+		return;
+
+	m_color = color_;
+	m_needsColorUpdate = true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void Label::setRunCache(TextRunCache & cache_)
+{
+	m_runCache = &cache_;
+	this->updateRun();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+sf::FloatRect Label::getLocalBounds() const
+{
+	return m_run ? m_run->bounds : sf::FloatRect{};
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void Label::drawSelf(sf::RenderTarget & target_, sf::RenderStates states_) const
+{
+	if (m_run && !m_run->vertices.empty())
+	{
+		if (auto const batch = TextBatch::active())
+			batch->append(m_run->texture, nullptr, m_run->vertices, states_.transform, m_color);
+		else
+		{
+			std::vector<sf::Vertex> const* vertices = &m_run->vertices;
+			if (m_color != sf::Color::White)
+			{
+				if (m_needsColorUpdate)
+				{
+					m_coloredVertices = m_run->vertices;
+					for (auto & vertex : m_coloredVertices)
+						vertex.color = m_color;
+					m_needsColorUpdate = false;
+				}
+				vertices = &m_coloredVertices;
+			}
+
+			states_.texture = m_run->texture;
+			target_.draw(vertices->data(), vertices->size(), sf::Triangles, states_);
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void Label::updateRun()
+{
+	if (m_font && !m_string.isEmpty())
+		m_run = m_runCache->acquire(*m_font, m_characterSize, m_string);
+	else
+		m_run.reset();
+
+	m_needsColorUpdate = true;
+}
+
+}
@@ -0,0 +1,556 @@
+#include "SFMLUIPCH.hpp"
+
+#include <SFML-UI/Elements/LogView.hpp>
+
+namespace sfui
+{
+
+namespace
+{
+
+constexpr std::uint32_t ReplacementCharacter = 0xFFFD;
+
+//////////////////////////////////////////////////////////////////////////////
+std::uint32_t decodeUtf8(std::string_view const text_, std::size_t & index_)
+{
+	auto const lead = static_cast<unsigned char>(text_[index_++]);
+	if (lead < 0x80)
+		return lead;
+
+	std::size_t trailing = 0;
+	std::uint32_t codePoint = 0;
+	if ((lead & 0xE0) == 0xC0)		{ trailing = 1; codePoint = lead & 0x1F; }
+	else if ((lead & 0xF0) == 0xE0)	{ trailing = 2; codePoint = lead & 0x0F; }
+	else if ((lead & 0xF8) == 0xF0)	{ trailing = 3; codePoint = lead & 0x07; }
+	else
+		return ReplacementCharacter;
+
+	for (std::size_t i = 0; i < trailing; ++i)
+	{
+		if (index_ >= text_.size() || (static_cast<unsigned char>(text_[index_]) & 0xC0) != 0x80)
+			return ReplacementCharacter;
+
+		codePoint = (codePoint << 6) | (static_cast<unsigned char>(text_[index_++]) & 0x3F);
+	}
+	return codePoint;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+template <typename TAdvance, typename TRowCallback>
+std::uint32_t wrapText(std::string_view const text_, float const width_, std::array<float, 128> const & asciiAdvances_, TAdvance const & advance_, TRowCallback && row_)
+{
+	if (width_ <= 0.f)
+	{
+		row_(std::size_t{ 0 }, text_.size());
+		return 1;
+	}
+
+	// Greedy wrapping: break after the last space of the row, or before the character that does not fit.
+	std::uint32_t rows		= 0;
+	std::size_t rowBegin	= 0;
+	std::size_t lastBreak	= 0;		// End of the last space inside the row (0 - none).
+	float x					= 0.f;
+	float xAtLastBreak		= 0.f;
+
+	std::size_t i = 0;
+	while (i < text_.size())
+	{
+		// ASCII does not need decoding nor glyph lookup:
+		std::size_t next = i;
+		std::uint32_t codePoint;
+		float advance;
+		if (auto const byte = static_cast<unsigned char>(text_[i]); byte < 0x80)
+		{
+			codePoint	= byte;
+			advance		= asciiAdvances_[byte];
+			++next;
+		}
+		else
+		{
+			codePoint	= decodeUtf8(text_, next);
+			advance		= advance_(codePoint);
+		}
+
+		if (x + advance > width_ && i > rowBegin)
+		{
+			std::size_t const rowEnd = lastBreak > rowBegin ? lastBreak : i;
+			row_(rowBegin, rowEnd);
+			++rows;
+
+			x			= rowEnd == i ? 0.f : x - xAtLastBreak;
+			rowBegin	= rowEnd;
+			lastBreak	= 0;
+			continue;	// The character might still not fit.
+		}
+
+		x += advance;
+		if (codePoint == U' ')
+		{
+			lastBreak		= next;
+			xAtLastBreak	= x;
+		}
+		i = next;
+	}
+
+	row_(rowBegin, text_.size());
+	return rows + 1;
+}
+
+}
+
+//////////////////////////////////////////////////////////////////////////////
+LogView::LogView(sf::Font const & font_, unsigned const characterSize_, std::size_t const lineCapacity_, std::size_t const byteBudget_)
+	:
+	m_font{ nullptr },
+	m_characterSize{ 0 },
+	m_lineSpacing{ 0.f },
+	m_writeOffset{ 0 },
+	m_byteSize{ 0 },
+	m_firstLine{ 0 },
+	m_lineCount{ 0 },
+	m_viewportSize{ 0.f, 0.f },
+	m_wrapGeneration{ 0 },
+	m_wrapCursor{ 0 },
+	m_wrapBudget{ 1024 },
+	m_followTail{ true },
+	m_pendingScroll{ 0 },
+	m_topLine{ 0 },
+	m_topRow{ 0 },
+	m_needsRefresh{ true }
+{
+	if (lineCapacity_ == 0 || byteBudget_ == 0)
+		throw std::invalid_argument("Log view requires non-zero line capacity and byte budget.");
+	if (byteBudget_ >= std::numeric_limits<std::uint32_t>::max())
+		throw std::invalid_argument("Log view byte budget exceeds the limit.");
+
+	m_bytes.resize(byteBudget_);
+	m_lines.resize(lineCapacity_);
+	m_rowOffsets.assign(lineCapacity_, 0.0);
+
+	this->setFont(font_, characterSize_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void LogView::append(std::string_view const text_, sf::Color const color_)
+{
+	std::size_t begin = 0;
+	while (begin < text_.size())
+	{
+		std::size_t end = text_.find('\n', begin);
+		if (end == std::string_view::npos)
+			end = text_.size();
+
+		std::string_view line = text_.substr(begin, end - begin);
+		if (!line.empty() && line.back() == '\r')
+			line.remove_suffix(1);
+
+		this->appendLine(line, color_);
+		begin = end + 1;
+	}
+
+	if (text_.empty())
+		this->appendLine(text_, color_);
+
+	m_needsRefresh = true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void LogView::clear()
+{
+	m_rowOffsets.assign(m_lines.size(), 0.0);
+
+	m_writeOffset	= 0;
+	m_byteSize		= 0;
+	m_firstLine		= 0;
+	m_lineCount		= 0;
+	m_wrapCursor	= 0;
+	m_followTail	= true;
+	m_pendingScroll	= 0;
+	m_topLine		= 0;
+	m_topRow		= 0;
+	m_needsRefresh	= true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void LogView::setFont(sf::Font const & font_, unsigned const characterSize_)
+{
+	m_font			= &font_;
+	m_characterSize	= characterSize_;
+	m_lineSpacing	= font_.getLineSpacing(characterSize_);
+
+	for (std::uint32_t codePoint = 0; codePoint < m_asciiGlyphs.size(); ++codePoint)
+	{
+		m_asciiGlyphs[codePoint]	= font_.getGlyph(codePoint, characterSize_, false);
+		m_asciiAdvances[codePoint]	= m_asciiGlyphs[codePoint].advance;
+	}
+	m_asciiAdvances[U'\t'] = m_asciiAdvances[U' '] * 4;
+
+	this->estimateRows();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void LogView::setViewportSize(sf::Vector2f const & size_)
+{
+	bool const widthChanged = size_.x != m_viewportSize.x;
+
+	m_viewportSize = size_;
+	if (widthChanged)
+		this->estimateRows();
+
+	m_needsRefresh = true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void LogView::setWrapBudget(std::size_t const lines_)
+{
+	m_wrapBudget = lines_;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void LogView::scrollBy(double const delta_)
+{
+	m_pendingScroll	+= delta_;
+	m_needsRefresh	= true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void LogView::scrollToLine(std::uint64_t const lineNumber_)
+{
+	m_followTail	= false;
+	m_pendingScroll	= 0;
+	m_topLine		= std::clamp(lineNumber_, m_firstLine, m_firstLine + std::max<std::size_t>(m_lineCount, 1) - 1);
+	m_topRow		= 0;
+	m_needsRefresh	= true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void LogView::scrollToBottom()
+{
+	m_followTail	= true;
+	m_pendingScroll	= 0;
+	m_needsRefresh	= true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void LogView::refresh()
+{
+	m_needsRefresh = false;
+
+	if (m_lineCount == 0)
+	{
+		m_vertices.clear();
+		m_topLine	= m_firstLine;
+		m_topRow	= 0;
+		return;
+	}
+
+	std::uint64_t const endLine		= m_firstLine + m_lineCount;
+	std::uint64_t const fullRows	= m_lineSpacing > 0.f ? std::max<std::uint64_t>(1, static_cast<std::uint64_t>(m_viewportSize.y / m_lineSpacing)) : 1;
+
+	// Top line was dropped:
+	if (m_topLine < m_firstLine)
+	{
+		m_topLine	= m_firstLine;
+		m_topRow	= 0;
+	}
+
+	// Apply whole rows of pending scroll (jumps go through the row index, so their cost does not depend on the distance):
+	double const rowDelta = m_lineSpacing > 0.f ? std::trunc(m_pendingScroll / m_lineSpacing) : 0.0;
+	if (rowDelta != 0)
+	{
+		m_pendingScroll -= rowDelta * m_lineSpacing;
+
+		double const totalRows	= m_rowOffsets.getTotal();
+		double const currentRow	= m_followTail
+			? std::max(0.0, totalRows - static_cast<double>(fullRows))
+			: this->getRowOffset(m_topLine) + m_topRow;
+
+		std::tie(m_topLine, m_topRow) = this->findRow(std::clamp(currentRow + rowDelta, 0.0, totalRows - 1));
+		m_followTail = false;
+	}
+
+	if (!m_followTail)
+	{
+		m_topRow = std::min(m_topRow, this->wrapExactly(m_topLine) - 1);
+
+		// Follow the tail again once the last row is visible:
+		std::uint64_t rows = 0;
+		std::uint64_t line = m_topLine;
+		while (line < endLine && rows < fullRows + m_topRow)
+			rows += this->wrapExactly(line++);
+
+		if (line == endLine && rows - m_topRow <= fullRows)
+			m_followTail = true;
+	}
+
+	if (m_followTail)
+	{
+		// Walk back from the newest line until the viewport is full:
+		std::uint64_t rows = 0;
+		std::uint64_t line = endLine;
+		while (line > m_firstLine && rows < fullRows)
+			rows += this->wrapExactly(--line);
+
+		m_topLine	= line;
+		m_topRow	= rows > fullRows ? static_cast<std::uint32_t>(rows - fullRows) : 0;
+	}
+
+	this->layoutRows();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::string_view LogView::getLine(std::uint64_t const lineNumber_) const
+{
+	if (lineNumber_ < m_firstLine || lineNumber_ - m_firstLine >= m_lineCount)
+		throw std::out_of_range("Log view line is not kept.");
+
+	Line const & line = m_lines[lineNumber_ % m_lines.size()];
+	return std::string_view{ m_bytes.data() + line.offset, line.length };
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void LogView::updateSelf(double const, TimePoint const &)
+{
+	// Wrap some of the lines with estimated rows:
+	if (m_wrapCursor < m_firstLine)
+		m_wrapCursor = m_firstLine;
+
+	for (std::size_t i = 0; i < m_wrapBudget && m_wrapCursor < m_firstLine + m_lineCount; ++i)
+		this->wrapExactly(m_wrapCursor++);
+
+	if (m_needsRefresh)
+		this->refresh();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void LogView::drawSelf(sf::RenderTarget & target_, sf::RenderStates states_) const
+{
+	if (!m_vertices.empty())
+	{
+		states_.texture = &m_font->getTexture(m_characterSize);
+		target_.draw(m_vertices.data(), m_vertices.size(), sf::Triangles, states_);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void LogView::appendLine(std::string_view text_, sf::Color const color_)
+{
+	auto const capacity = static_cast<std::uint32_t>(m_bytes.size());
+	if (text_.size() > capacity)
+		text_ = text_.substr(0, capacity);
+
+	auto const length = static_cast<std::uint32_t>(text_.size());
+
+	if (m_lineCount == m_lines.size())
+		this->dropFirstLine();
+
+	// Text is never split, skip the tail of the buffer if it does not fit there:
+	std::uint32_t const offset		= m_writeOffset + length > capacity ? 0 : m_writeOffset;
+	std::uint32_t const consumed	= offset == m_writeOffset ? length : capacity - m_writeOffset + length;
+
+	// Drop the oldest lines whose text starts in consumed part of the buffer:
+	while (m_lineCount > 0)
+	{
+		std::uint32_t const start = this->getRecord(m_firstLine).offset;
+		if ((start + capacity - m_writeOffset) % capacity >= consumed)
+			break;
+
+		this->dropFirstLine();
+	}
+
+	std::copy(text_.begin(), text_.end(), m_bytes.begin() + offset);
+	m_writeOffset = (offset + length) % capacity;
+	m_byteSize += length;
+
+	std::uint64_t const lineNumber = m_firstLine + m_lineCount++;
+
+	Line & line = this->getRecord(lineNumber);
+	line.offset			= offset;
+	line.length			= length;
+	line.rows			= 0;
+	line.wrapGeneration	= m_wrapGeneration - 1;
+	line.color			= color_;
+
+	this->wrapExactly(lineNumber);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void LogView::dropFirstLine()
+{
+	Line const & line = this->getRecord(m_firstLine);
+	m_byteSize -= line.length;
+	m_rowOffsets.set(m_firstLine % m_lines.size(), 0.0);
+
+	++m_firstLine;
+	--m_lineCount;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::uint32_t LogView::wrapExactly(std::uint64_t const lineNumber_)
+{
+	Line & line = this->getRecord(lineNumber_);
+	if (line.wrapGeneration == m_wrapGeneration)
+		return line.rows;
+
+	line.rows = wrapText(std::string_view{ m_bytes.data() + line.offset, line.length }, m_viewportSize.x, m_asciiAdvances,
+		[this](std::uint32_t const codePoint_)
+		{
+			return this->getAdvance(codePoint_);
+		},
+		[](std::size_t, std::size_t) {});
+	line.wrapGeneration = m_wrapGeneration;
+
+	m_rowOffsets.set(lineNumber_ % m_lines.size(), line.rows);
+	return line.rows;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void LogView::estimateRows()
+{
+	++m_wrapGeneration;
+	m_wrapCursor	= m_firstLine;
+	m_needsRefresh	= true;
+
+	// Every line is one row when not wrapping:
+	bool const exact = m_viewportSize.x <= 0.f;
+
+	float advanceSum = 0.f;
+	for (std::uint32_t codePoint = U' '; codePoint <= U'~'; ++codePoint)
+		advanceSum += m_asciiGlyphs[codePoint].advance;
+
+	double const bytesPerRow = advanceSum > 0.f ? std::max(1.0, static_cast<double>(m_viewportSize.x) * (U'~' - U' ' + 1) / advanceSum) : 1.0;
+
+	std::vector<double> slotRows(m_lines.size(), 0.0);
+	for (std::uint64_t lineNumber = m_firstLine; lineNumber < m_firstLine + m_lineCount; ++lineNumber)
+	{
+		Line & line = this->getRecord(lineNumber);
+		if (exact)
+		{
+			line.rows			= 1;
+			line.wrapGeneration	= m_wrapGeneration;
+		}
+		else
+			line.rows = std::max(1u, static_cast<std::uint32_t>(std::ceil(line.length / bytesPerRow)));
+
+		slotRows[lineNumber % m_lines.size()] = line.rows;
+	}
+	m_rowOffsets.assign(slotRows);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+double LogView::getRowOffset(std::uint64_t const lineNumber_) const
+{
+	// Lines occupy ring slots from the first line's slot, possibly wrapping around to slot 0:
+	std::size_t const capacity	= m_lines.size();
+	std::size_t const head		= m_firstLine % capacity;
+	std::size_t const count		= static_cast<std::size_t>(lineNumber_ - m_firstLine);
+
+	if (head + count <= capacity)
+		return m_rowOffsets.getOffset(head + count) - m_rowOffsets.getOffset(head);
+
+	return (m_rowOffsets.getTotal() - m_rowOffsets.getOffset(head)) + m_rowOffsets.getOffset(head + count - capacity);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::pair<std::uint64_t, std::uint32_t> LogView::findRow(double const row_) const
+{
+	std::size_t const capacity	= m_lines.size();
+	std::size_t const head		= m_firstLine % capacity;
+	double const headOffset		= m_rowOffsets.getOffset(head);
+	double const tailRows		= m_rowOffsets.getTotal() - headOffset;	// Rows of slots from head to the end of the ring.
+
+	std::size_t slot;
+	std::uint64_t lineNumber;
+	if (row_ < tailRows)
+	{
+		slot		= m_rowOffsets.findIndex(headOffset + row_);
+		lineNumber	= m_firstLine + (slot - head);
+	}
+	else
+	{
+		slot		= m_rowOffsets.findIndex(row_ - tailRows);
+		lineNumber	= m_firstLine + (capacity - head) + slot;
+	}
+
+	lineNumber = std::min(lineNumber, m_firstLine + m_lineCount - 1);
+	return { lineNumber, static_cast<std::uint32_t>(std::max(0.0, row_ - this->getRowOffset(lineNumber))) };
+}
+
+//////////////////////////////////////////////////////////////////////////////
+float LogView::getAdvance(std::uint32_t const codePoint_) const
+{
+	if (codePoint_ < m_asciiAdvances.size())
+		return m_asciiAdvances[codePoint_];
+
+	return m_font->getGlyph(codePoint_, m_characterSize, false).advance;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+sf::Glyph const& LogView::getGlyph(std::uint32_t const codePoint_) const
+{
+	if (codePoint_ < m_asciiGlyphs.size())
+		return m_asciiGlyphs[codePoint_];
+
+	return m_font->getGlyph(codePoint_, m_characterSize, false);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void LogView::layoutRows()
+{
+	m_vertices.clear();
+
+	auto const visibleRows = static_cast<std::uint64_t>(m_lineSpacing > 0.f ? std::ceil(m_viewportSize.y / m_lineSpacing) : 1.f);
+
+	std::uint64_t row = 0;	// Rows laid out so far.
+	for (std::uint64_t lineNumber = m_topLine; lineNumber < m_firstLine + m_lineCount && row < visibleRows; ++lineNumber)
+	{
+		Line const & line				= this->getRecord(lineNumber);
+		std::string_view const text		= std::string_view{ m_bytes.data() + line.offset, line.length };
+		std::uint32_t rowInLine			= 0;
+		std::uint32_t const firstRow	= lineNumber == m_topLine ? m_topRow : 0;
+
+		wrapText(text, m_viewportSize.x, m_asciiAdvances,
+			[this](std::uint32_t const codePoint_)
+			{
+				return this->getAdvance(codePoint_);
+			},
+			[&](std::size_t const begin_, std::size_t const end_)
+			{
+				if (rowInLine++ < firstRow || row >= visibleRows)
+					return;
+
+				float x			= 0.f;
+				float const y	= static_cast<float>(row++) * m_lineSpacing + static_cast<float>(m_characterSize);
+
+				for (std::size_t i = begin_; i < end_; )
+				{
+					std::uint32_t const codePoint	= decodeUtf8(text, i);
+					float const advance				= this->getAdvance(codePoint);
+					sf::Glyph const & glyph			= this->getGlyph(codePoint);
+
+					if (codePoint != U'\t' && glyph.bounds.width > 0.f && glyph.bounds.height > 0.f)
+					{
+						float const left	= x + glyph.bounds.left;
+						float const top		= y + glyph.bounds.top;
+						float const right	= left + glyph.bounds.width;
+						float const bottom	= top + glyph.bounds.height;
+
+						float const u1 = static_cast<float>(glyph.textureRect.left);
+						float const v1 = static_cast<float>(glyph.textureRect.top);
+						float const u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width);
+						float const v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height);
+
+						m_vertices.emplace_back(sf::Vector2f{ left, top },		line.color, sf::Vector2f{ u1, v1 });
+						m_vertices.emplace_back(sf::Vector2f{ right, top },		line.color, sf::Vector2f{ u2, v1 });
+						m_vertices.emplace_back(sf::Vector2f{ left, bottom },	line.color, sf::Vector2f{ u1, v2 });
+						m_vertices.emplace_back(sf::Vector2f{ left, bottom },	line.color, sf::Vector2f{ u1, v2 });
+						m_vertices.emplace_back(sf::Vector2f{ right, top },		line.color, sf::Vector2f{ u2, v1 });
+						m_vertices.emplace_back(sf::Vector2f{ right, bottom },	line.color, sf::Vector2f{ u2, v2 });
+					}
+					x += advance;
+				}
+			});
+	}
+}
+
+}
@@ -0,0 +1,172 @@
+#include "SFMLUIPCH.hpp"
+
+#include <SFML-UI/Elements/SdfLabel.hpp>
+#include <SFML-UI/Elements/TextBatch.hpp>
+
+namespace sfui
+{
+
+//////////////////////////////////////////////////////////////////////////////
+SdfLabel::SdfLabel(SdfGlyphAtlas & atlas_, float const characterSize_, sf::String const & string_)
+	:
+	m_atlas{ &atlas_ },
+	m_string{ string_ },
+	m_characterSize{ characterSize_ },
+	m_color{ sf::Color::White },
+	m_atlasGeneration{ 0 },
+	m_needsLayout{ true },
+	m_isComplete{ false }
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void SdfLabel::setString(sf::String const & string_)
+{
+	if (m_string == string_)
+		return;
+
+	m_string		= string_;
+	m_needsLayout	= true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void SdfLabel::setCharacterSize(float const characterSize_)
+{
+	if (m_characterSize == characterSize_)
+		return;
+
+	m_characterSize	= characterSize_;
+	m_needsLayout	= true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void SdfLabel::setColor(sf::Color const color_)
+{
+	if (m_color == color_)
+		return;
+
+	m_color			= color_;
+	m_needsLayout	= true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+sf::FloatRect SdfLabel::getLocalBounds() const
+{
+	this->updateLayout();
+	return m_bounds;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void SdfLabel::drawSelf(sf::RenderTarget & target_, sf::RenderStates states_) const
+{
+	this->updateLayout();
+
+	// Cached layout does not look the glyphs up again, so keep its pages from being evicted here:
+	for (auto const page : m_usedPages)
+		m_atlas->markPageUsed(page);
+
+	sf::Shader const* const shader	= SdfGlyphAtlas::getShader();
+	auto const batch				= TextBatch::active();
+
+	for (auto const & run : m_runs)
+	{
+		if (run.vertices.empty())
+			continue;
+
+		if (batch)
+			batch->append(run.texture, shader, run.vertices, states_.transform, m_color);
+		else
+		{
+			states_.texture	= run.texture;
+			states_.shader	= shader;
+			target_.draw(run.vertices.data(), run.vertices.size(), sf::Triangles, states_);
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void SdfLabel::updateLayout() const
+{
+	if (!m_needsLayout && m_isComplete && m_atlasGeneration == m_atlas->getGeneration())
+		return;
+
+	for (auto & run : m_runs)
+		run.vertices.clear();
+
+	float const scale		= m_characterSize / static_cast<float>(m_atlas->getSettings().baseCharacterSize);
+	float const lineSpacing	= m_atlas->getLineSpacing() * scale;
+
+	float x = 0.f;
+	float y = m_characterSize;
+
+	float minX = 0.f, minY = 0.f, maxX = 0.f, maxY = 0.f;
+
+	bool isComplete = true;
+
+	sf::Uint32 previous = 0;
+	for (auto const current : m_string)
+	{
+		x += m_atlas->getKerning(previous, current) * scale;
+		previous = current;
+
+		if (current == U'\n')
+		{
+			x = 0.f;
+			y += lineSpacing;
+			continue;
+		}
+
+		auto const glyph = m_atlas->findGlyph(current);
+		if (!glyph)
+		{
+			isComplete = false;
+			continue;
+		}
+
+		if (glyph->page != SdfGlyphAtlas::NoPage)
+		{
+			if (m_runs.size() <= glyph->page)
+				m_runs.resize(glyph->page + 1);
+
+			auto & run = m_runs[glyph->page];
+			run.texture = &m_atlas->getPageTexture(glyph->page);
+
+			float const left	= x + glyph->bounds.left * scale;
+			float const top		= y + glyph->bounds.top * scale;
+			float const right	= left + glyph->bounds.width * scale;
+			float const bottom	= top + glyph->bounds.height * scale;
+
+			sf::IntRect const & rect = glyph->textureRect;
+			float const u1 = static_cast<float>(rect.left);
+			float const v1 = static_cast<float>(rect.top);
+			float const u2 = static_cast<float>(rect.left + rect.width);
+			float const v2 = static_cast<float>(rect.top + rect.height);
+
+			run.vertices.emplace_back(sf::Vector2f{ left, top },		m_color, sf::Vector2f{ u1, v1 });
+			run.vertices.emplace_back(sf::Vector2f{ right, top },		m_color, sf::Vector2f{ u2, v1 });
+			run.vertices.emplace_back(sf::Vector2f{ left, bottom },		m_color, sf::Vector2f{ u1, v2 });
+			run.vertices.emplace_back(sf::Vector2f{ left, bottom },		m_color, sf::Vector2f{ u1, v2 });
+			run.vertices.emplace_back(sf::Vector2f{ right, top },		m_color, sf::Vector2f{ u2, v1 });
+			run.vertices.emplace_back(sf::Vector2f{ right, bottom },	m_color, sf::Vector2f{ u2, v2 });
+
+			minX = std::min(minX, left);
+			minY = std::min(minY, top);
+			maxX = std::max(maxX, right);
+			maxY = std::max(maxY, bottom);
+		}
+
+		x += glyph->advance * scale;
+	}
+
+	m_usedPages.clear();
+	for (std::size_t page = 0; page < m_runs.size(); ++page)
+		if (!m_runs[page].vertices.empty())
+			m_usedPages.push_back(page);
+
+	m_bounds			= sf::FloatRect{ minX, minY, maxX - minX, maxY - minY };
+	m_atlasGeneration	= m_atlas->getGeneration();
+	m_needsLayout		= false;
+	m_isComplete		= isComplete;
+}
+
+}
@@ -0,0 +1,80 @@
+#include "SFMLUIPCH.hpp"
+
+#include <SFML-UI/Elements/TextBatch.hpp>
+
+namespace sfui
+{
+
+namespace
+{
+// Batch whose subtree is currently drawn. Saved and restored by nested batches.
+thread_local TextBatch const* g_activeTextBatch = nullptr;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+TextBatch::TextBatch()
+{
+	this->setDrawsAfterChildren(true);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+TextBatch const* TextBatch::active()
+{
+	return g_activeTextBatch;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void TextBatch::append(sf::Texture const * texture_, sf::Shader const * shader_, std::vector<sf::Vertex> const & vertices_, sf::Transform const & transform_, sf::Color const color_) const
+{
+	auto bucket = std::find_if(m_buckets.begin(), m_buckets.end(),
+		[texture_, shader_](Bucket const & bucket_)
+		{
+			return bucket_.texture == texture_ && bucket_.shader == shader_;
+		});
+
+	if (bucket == m_buckets.end())
+	{
+		m_buckets.push_back( Bucket{ texture_, shader_, {} } );
+		bucket = std::prev(m_buckets.end());
+	}
+
+	auto & vertices = bucket->vertices;
+	vertices.reserve(vertices.size() + vertices_.size());
+	for (auto const & vertex : vertices_)
+		vertices.emplace_back(transform_.transformPoint(vertex.position), color_, vertex.texCoords);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void TextBatch::drawSelf(sf::RenderTarget &, sf::RenderStates) const
+{
+	for (auto & bucket : m_buckets)
+		bucket.vertices.clear();
+
+	m_previousBatch		= g_activeTextBatch;
+	g_activeTextBatch	= this;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void TextBatch::drawAfterChildren(sf::RenderTarget & target_, sf::RenderStates states_) const
+{
+	g_activeTextBatch = m_previousBatch;
+
+	// Collected vertices are already transformed by the whole element chain:
+	states_.transform = sf::Transform::Identity;
+
+	sf::Shader const* const batchShader = states_.shader;
+
+	m_lastDrawCallCount = 0;
+	for (auto const & bucket : m_buckets)
+	{
+		if (bucket.vertices.empty())
+			continue;
+
+		states_.texture	= bucket.texture;
+		states_.shader	= bucket.shader ? bucket.shader : batchShader;
+		target_.draw(bucket.vertices.data(), bucket.vertices.size(), sf::Triangles, states_);
+		++m_lastDrawCallCount;
+	}
+}
+
+}
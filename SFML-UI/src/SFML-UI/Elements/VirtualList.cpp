@@ -0,0 +1,228 @@
+#include "SFMLUIPCH.hpp"
+
+#include <SFML-UI/Elements/VirtualList.hpp>
+
+namespace sfui
+{
+
+//////////////////////////////////////////////////////////////////////////////
+VirtualList::VirtualList(RowFactoryType factory_, RowBinderType binder_)
+	:
+	m_factory{ std::move(factory_) },
+	m_binder{ std::move(binder_) },
+	m_scrollOffset{ 0 },
+	m_viewportHeight{ 0 },
+	m_overscan{ 2 },
+	m_firstBoundRow{ 0 },
+	m_createdRowElementCount{ 0 },
+	m_bindCount{ 0 },
+	m_needsRefresh{ false }
+{
+	if (!m_factory || !m_binder)
+		throw std::invalid_argument("Virtual list requires both row factory and row binder.");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void VirtualList::setViewportHeight(float const height_)
+{
+	m_viewportHeight	= std::max(height_, 0.f);
+	m_needsRefresh		= true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void VirtualList::setOverscan(std::size_t const rows_)
+{
+	m_overscan		= rows_;
+	m_needsRefresh	= true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void VirtualList::setRowCount(std::size_t const count_, float const rowHeight_)
+{
+	m_heights.resize(count_, std::max(rowHeight_, 0.f));
+	m_needsRefresh = true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void VirtualList::setRowHeight(std::size_t const index_, float const height_)
+{
+	m_heights.set(index_, std::max(height_, 0.f));
+	m_needsRefresh = true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void VirtualList::setRowHeights(std::span<double const> const heights_)
+{
+	m_heights.assign(heights_);
+	m_needsRefresh = true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void VirtualList::invalidateRows(std::size_t const first_, std::size_t const count_)
+{
+	std::size_t const boundEnd	= m_firstBoundRow + m_boundRows.size();
+	std::size_t const begin		= std::max(first_, m_firstBoundRow);
+	std::size_t const end		= first_ < boundEnd ? first_ + std::min(count_, boundEnd - first_) : boundEnd;
+
+	for (std::size_t row = begin; row < end; ++row)
+		m_boundRows[row - m_firstBoundRow].needsBind = true;
+
+	if (begin < end)
+		m_needsRefresh = true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void VirtualList::invalidateAllRows()
+{
+	for (auto & bound : m_boundRows)
+		bound.needsBind = true;
+
+	m_needsRefresh = true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void VirtualList::setScrollOffset(double const offset_)
+{
+	m_scrollOffset	= std::clamp(offset_, 0.0, this->getMaxScrollOffset());
+	m_needsRefresh	= true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void VirtualList::scrollBy(double const delta_)
+{
+	this->setScrollOffset(m_scrollOffset + delta_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void VirtualList::scrollToRow(std::size_t const index_)
+{
+	this->setScrollOffset(m_heights.getOffset(index_));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void VirtualList::refresh()
+{
+	m_needsRefresh = false;
+
+	// Row count or heights might have changed since the offset was set:
+	m_scrollOffset = std::clamp(m_scrollOffset, 0.0, this->getMaxScrollOffset());
+
+	std::size_t const rowCount = m_heights.getSize();
+
+	std::size_t first = 0, end = 0;
+	if (rowCount > 0 && m_viewportHeight > 0)
+	{
+		first	= m_heights.findIndex(m_scrollOffset);
+		end		= m_heights.findIndex(m_scrollOffset + m_viewportHeight) + 1;
+
+		first	-= std::min(first, m_overscan);
+		end		= std::min(rowCount, end + std::min(m_overscan, rowCount));
+	}
+
+	// Keep elements of rows that stay bound, release the rest:
+	m_scratchRows.clear();
+	m_scratchRows.resize(end - first);
+	m_releasedRowElements.clear();
+
+	for (std::size_t i = 0; i < m_boundRows.size(); ++i)
+	{
+		std::size_t const row = m_firstBoundRow + i;
+		if (row >= first && row < end)
+			m_scratchRows[row - first] = std::move(m_boundRows[i]);
+		else
+			m_releasedRowElements.push_back(std::move(m_boundRows[i].element));
+	}
+
+	// Bind rows that came into view to released elements (they are already attached):
+	double rowTop = m_heights.getOffset(first);
+	for (std::size_t row = first; row < end; ++row)
+	{
+		BoundRow & bound = m_scratchRows[row - first];
+		if (!bound.element)
+		{
+			if (!m_releasedRowElements.empty())
+			{
+				bound.element = std::move(m_releasedRowElements.back());
+				m_releasedRowElements.pop_back();
+			}
+			else
+				bound.element = this->acquireRowElement();
+
+			bound.needsBind = true;
+		}
+
+		if (bound.needsBind)
+		{
+			m_binder(*bound.element, row);
+			bound.needsBind = false;
+			++m_bindCount;
+		}
+
+		sf::Vector2f const position{ 0.f, static_cast<float>(rowTop - m_scrollOffset) };
+		if (bound.element->getPosition() != position)
+			bound.element->setPosition(position);
+
+		rowTop += m_heights.get(row);
+	}
+
+	// Fewer rows are bound than before, keep the rest for later:
+	for (auto & element : m_releasedRowElements)
+	{
+		this->detach(*element);
+		m_spareRowElements.push_back(std::move(element));
+	}
+	m_releasedRowElements.clear();
+
+	m_boundRows.swap(m_scratchRows);
+	m_firstBoundRow = first;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+Element* VirtualList::getRowElement(std::size_t const index_) const
+{
+	if (index_ < m_firstBoundRow || index_ - m_firstBoundRow >= m_boundRows.size())
+		return nullptr;
+
+	return m_boundRows[index_ - m_firstBoundRow].element.get();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::size_t VirtualList::findRowAt(float const y_) const
+{
+	double const offset = m_scrollOffset + y_;
+	if (y_ < 0 || offset >= m_heights.getTotal())
+		return m_heights.getSize();
+
+	return m_heights.findIndex(offset);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void VirtualList::updateSelf(double const, TimePoint const &)
+{
+	if (m_needsRefresh)
+		this->refresh();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+VirtualList::ElementPtrType VirtualList::acquireRowElement()
+{
+	ElementPtrType element;
+	if (!m_spareRowElements.empty())
+	{
+		element = std::move(m_spareRowElements.back());
+		m_spareRowElements.pop_back();
+	}
+	else
+	{
+		element = m_factory();
+		if (!element)
+			throw std::runtime_error("Virtual list row factory returned no element.");
+
+		++m_createdRowElementCount;
+	}
+
+	this->attach(ElementPtrType{ element }, AttachTransform::SnapToTarget, AttachPolicy::Unchecked);
+	return element;
+}
+
+}
@@ -0,0 +1,443 @@
+#include "SFMLUIPCH.hpp"
+
+#include <SFML-UI/Graphics/SdfGlyphAtlas.hpp>
+
+namespace sfui
+{
+
+namespace
+{
+
+// Renders distance field stored in alpha channel, with anti-aliasing width adapted to the current scale.
+constexpr char const* SdfFragmentShader = R"(
+uniform sampler2D texture;
+
+void main()
+{
+	float distance	= texture2D(texture, gl_TexCoord[0].xy).a;
+	float width		= fwidth(distance) * 0.7;
+	float alpha		= smoothstep(0.5 - width, 0.5 + width, distance);
+	gl_FragColor	= vec4(gl_Color.rgb, gl_Color.a * alpha);
+}
+)";
+
+// Distance used for pixels that have no feature pixel assigned yet. Finite, so the arithmetic never produces NaN.
+constexpr float FarDistance = 1e20f;
+
+/// <summary>
+/// Computes one dimensional squared distance transform (Felzenszwalb & Huttenlocher).
+/// </summary>
+/// <param name="values_">Input values, overwritten with the result. Accessed with `stride_`.</param>
+/// <param name="count_">Number of values.</param>
+/// <param name="stride_">Distance between two consecutive values.</param>
+/// <param name="input_">Scratch buffer of `count_` floats.</param>
+/// <param name="parabolas_">Scratch buffer of `count_` ints.</param>
+/// <param name="boundaries_">Scratch buffer of `count_ + 1` floats.</param>
+void distanceTransform1D(float * values_, std::size_t const count_, std::size_t const stride_,
+	float * input_, int * parabolas_, float * boundaries_)
+{
+	constexpr float Infinity = std::numeric_limits<float>::infinity();
+
+	for (std::size_t i = 0; i < count_; ++i)
+		input_[i] = values_[i * stride_];
+
+	// Intersection of parabolas rooted at `q_` and `p_`:
+	auto const intersection = [input_](int const q_, int const p_)
+	{
+		return ((input_[q_] + static_cast<float>(q_ * q_)) - (input_[p_] + static_cast<float>(p_ * p_))) / static_cast<float>(2 * q_ - 2 * p_);
+	};
+
+	int k = 0;
+	parabolas_[0]	= 0;
+	boundaries_[0]	= -Infinity;
+	boundaries_[1]	= Infinity;
+
+	for (int q = 1; q < static_cast<int>(count_); ++q)
+	{
+		float s = intersection(q, parabolas_[k]);
+		while (s <= boundaries_[k])
+		{
+			--k;
+			s = intersection(q, parabolas_[k]);
+		}
+
+		++k;
+		parabolas_[k]		= q;
+		boundaries_[k]		= s;
+		boundaries_[k + 1]	= Infinity;
+	}
+
+	k = 0;
+	for (int q = 0; q < static_cast<int>(count_); ++q)
+	{
+		while (boundaries_[k + 1] < static_cast<float>(q))
+			++k;
+
+		int const p = parabolas_[k];
+		values_[q * stride_] = static_cast<float>((q - p) * (q - p)) + input_[p];
+	}
+}
+
+/// <summary>
+/// Computes squared distance to the nearest pixel marked with 0.
+/// </summary>
+void distanceTransform2D(std::vector<float> & grid_, sf::Vector2u const size_)
+{
+	std::size_t const maxDimension = std::max(size_.x, size_.y);
+
+	std::vector<float>	input(maxDimension);
+	std::vector<int>	parabolas(maxDimension);
+	std::vector<float>	boundaries(maxDimension + 1);
+
+	for (std::size_t x = 0; x < size_.x; ++x)
+		distanceTransform1D(grid_.data() + x, size_.y, size_.x, input.data(), parabolas.data(), boundaries.data());
+
+	for (std::size_t y = 0; y < size_.y; ++y)
+		distanceTransform1D(grid_.data() + y * size_.x, size_.x, 1, input.data(), parabolas.data(), boundaries.data());
+}
+
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SdfGlyphAtlas::SdfGlyphAtlas(sf::Font const & font_)
+	:
+	SdfGlyphAtlas(font_, Settings{})
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SdfGlyphAtlas::SdfGlyphAtlas(sf::Font const & font_, Settings const & settings_)
+	:
+	m_font{ &font_ },
+	m_settings{ settings_ },
+	m_frame{ 0 },
+	m_generation{ 0 },
+	m_stopping{ false }
+{
+	m_worker = std::thread{ [this] { this->processJobs(); } };
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SdfGlyphAtlas::~SdfGlyphAtlas()
+{
+	{
+		std::lock_guard<std::mutex> lock{ m_mutex };
+		m_stopping = true;
+	}
+	m_condition.notify_all();
+	m_worker.join();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SdfGlyphAtlas::Glyph const* SdfGlyphAtlas::findGlyph(sf::Uint32 const codePoint_)
+{
+	auto const it = m_glyphs.find(codePoint_);
+	if (it != m_glyphs.end())
+	{
+		if (it->second.page != NoPage)
+			this->markPageUsed(it->second.page);
+		return &it->second;
+	}
+
+	if (m_pending.insert(codePoint_).second)
+		m_scheduled.push_back(codePoint_);
+
+	return nullptr;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void SdfGlyphAtlas::update()
+{
+	++m_frame;
+	this->rasterizeScheduled();
+	this->uploadFinished();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void SdfGlyphAtlas::waitUntilReady()
+{
+	this->rasterizeScheduled();
+	while (!m_pending.empty())
+	{
+		{
+			std::unique_lock<std::mutex> lock{ m_mutex };
+			m_condition.wait(lock, [this] { return !m_finished.empty(); });
+		}
+		this->uploadFinished();
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+float SdfGlyphAtlas::getKerning(sf::Uint32 const first_, sf::Uint32 const second_) const
+{
+	return m_font->getKerning(first_, second_, m_settings.baseCharacterSize);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+float SdfGlyphAtlas::getLineSpacing() const
+{
+	return m_font->getLineSpacing(m_settings.baseCharacterSize);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::size_t SdfGlyphAtlas::getMemoryUsage() const
+{
+	return m_pages.size() * m_settings.pageSize * m_settings.pageSize * 4 + this->getFontTextureMemoryUsage();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+sf::Shader const* SdfGlyphAtlas::getShader()
+{
+	static sf::Shader shader;
+	static bool const loaded = [] {
+		if (!sf::Shader::isAvailable() || !shader.loadFromMemory(SdfFragmentShader, sf::Shader::Fragment))
+			return false;
+
+		shader.setUniform("texture", sf::Shader::CurrentTexture);
+		return true;
+	}();
+
+	return loaded ? &shader : nullptr;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::vector<sf::Uint8> SdfGlyphAtlas::computeDistanceField(std::vector<sf::Uint8> const & coverage_, sf::Vector2u const size_, unsigned const spread_)
+{
+	std::size_t const pixelCount = static_cast<std::size_t>(size_.x) * size_.y;
+
+	// Squared distances to the nearest inside and to the nearest outside pixel:
+	std::vector<float> toInside(pixelCount), toOutside(pixelCount);
+	for (std::size_t i = 0; i < pixelCount; ++i)
+	{
+		bool const inside = coverage_[i] >= 128;
+		toInside[i]		= inside ? 0.f : FarDistance;
+		toOutside[i]	= inside ? FarDistance : 0.f;
+	}
+
+	distanceTransform2D(toInside, size_);
+	distanceTransform2D(toOutside, size_);
+
+	std::vector<sf::Uint8> field(pixelCount);
+	float const scale = 0.5f / static_cast<float>(spread_);
+	for (std::size_t i = 0; i < pixelCount; ++i)
+	{
+		float const signedDistance	= std::sqrt(toOutside[i]) - std::sqrt(toInside[i]);
+		float const normalized		= std::clamp(0.5f + signedDistance * scale, 0.f, 1.f);
+		field[i] = static_cast<sf::Uint8>(normalized * 255.f + 0.5f);
+	}
+	return field;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void SdfGlyphAtlas::processJobs()
+{
+	while (true)
+	{
+		Job job;
+		{
+			std::unique_lock<std::mutex> lock{ m_mutex };
+			m_condition.wait(lock, [this] { return m_stopping || !m_jobs.empty(); });
+			if (m_stopping)
+				return;
+
+			job = std::move(m_jobs.front());
+			m_jobs.pop_front();
+		}
+
+		job.pixels = SdfGlyphAtlas::computeDistanceField(job.pixels, job.size, m_settings.spread);
+
+		{
+			std::lock_guard<std::mutex> lock{ m_mutex };
+			m_finished.push_back(std::move(job));
+		}
+		m_condition.notify_all();
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void SdfGlyphAtlas::rasterizeScheduled()
+{
+	if (m_scheduled.empty())
+		return;
+
+	unsigned const baseSize	= m_settings.baseCharacterSize;
+	unsigned const spread	= m_settings.spread;
+
+	// Load every glyph first, so the font texture is read back at most once:
+	std::vector<sf::Glyph> glyphs;
+	glyphs.reserve(m_scheduled.size());
+	bool needsReadBack = false;
+	for (auto const codePoint : m_scheduled)
+	{
+		glyphs.push_back( m_font->getGlyph(codePoint, baseSize, false) );
+
+		sf::IntRect const & rect = glyphs.back().textureRect;
+		if (rect.width > 0 && rect.height > 0 && !m_fontImageGlyphs.contains(codePoint))
+			needsReadBack = true;
+	}
+
+	// Font texture only grows and keeps glyph positions, so the copy stays valid for every glyph it contains:
+	if (needsReadBack)
+	{
+		m_fontImage = m_font->getTexture(baseSize).copyToImage();
+		m_fontImageGlyphs.insert(m_scheduled.begin(), m_scheduled.end());
+	}
+
+	sf::Uint8 const*	fontPixels	= m_fontImage.getPixelsPtr();
+	std::size_t const	fontStride	= static_cast<std::size_t>(m_fontImage.getSize().x) * 4;
+
+	std::vector<Job> jobs;
+	jobs.reserve(m_scheduled.size());
+	for (std::size_t i = 0; i < m_scheduled.size(); ++i)
+	{
+		sf::Glyph const & glyph = glyphs[i];
+		sf::IntRect const & rect = glyph.textureRect;
+
+		// Whitespace - nothing to render. Glyphs that would not fit in a page are rejected once, the same way:
+		if (rect.width <= 0 || rect.height <= 0 ||
+			rect.width + 2 * spread > m_settings.pageSize || rect.height + 2 * spread > m_settings.pageSize)
+		{
+			m_glyphs[m_scheduled[i]] = Glyph{ sf::FloatRect{}, glyph.advance, sf::IntRect{}, NoPage };
+			m_pending.erase(m_scheduled[i]);
+			continue;
+		}
+
+		Job job;
+		job.codePoint	= m_scheduled[i];
+		job.size		= sf::Vector2u{ rect.width + 2 * spread, rect.height + 2 * spread };
+		job.advance		= glyph.advance;
+		job.bounds		= sf::FloatRect{
+				glyph.bounds.left - spread, glyph.bounds.top - spread,
+				static_cast<float>(job.size.x), static_cast<float>(job.size.y)
+			};
+
+		job.pixels.assign(static_cast<std::size_t>(job.size.x) * job.size.y, 0);
+		for (int y = 0; y < rect.height; ++y)
+		{
+			sf::Uint8 const* source = fontPixels + static_cast<std::size_t>(rect.top + y) * fontStride + static_cast<std::size_t>(rect.left) * 4 + 3;
+			for (int x = 0; x < rect.width; ++x)
+				job.pixels[(y + spread) * job.size.x + x + spread] = source[x * 4];
+		}
+
+		jobs.push_back(std::move(job));
+	}
+	m_scheduled.clear();
+
+	if (!jobs.empty())
+	{
+		{
+			std::lock_guard<std::mutex> lock{ m_mutex };
+			for (auto & job : jobs)
+				m_jobs.push_back(std::move(job));
+		}
+		m_condition.notify_all();
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::size_t SdfGlyphAtlas::uploadFinished()
+{
+	std::vector<Job> finished;
+	{
+		std::lock_guard<std::mutex> lock{ m_mutex };
+		finished.swap(m_finished);
+	}
+
+	for (auto const & job : finished)
+	{
+		this->place(job);
+		m_pending.erase(job.codePoint);
+	}
+	return finished.size();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void SdfGlyphAtlas::place(Job const & job_)
+{
+	std::optional<sf::Vector2u> position;
+	std::size_t pageIndex = 0;
+
+	for (; pageIndex < m_pages.size() && !position; ++pageIndex)
+		position = m_pages[pageIndex]->packer.insert(job_.size);
+
+	if (position)
+		--pageIndex;
+	else
+	{
+		if (this->canCreatePage())
+		{
+			auto page = std::make_unique<Page>( Page{ sf::Texture{}, SkylinePacker{ sf::Vector2u{ m_settings.pageSize, m_settings.pageSize } }, {}, m_frame } );
+			page->texture.create(m_settings.pageSize, m_settings.pageSize);
+			page->texture.setSmooth(true);
+			m_pages.push_back(std::move(page));
+			pageIndex = m_pages.size() - 1;
+		}
+		else
+			pageIndex = this->evictPage();
+
+		position = m_pages[pageIndex]->packer.insert(job_.size);
+		if (!position)
+		{
+			// Glyph does not fit even an empty page - store it without image, so it is not scheduled again:
+			m_glyphs[job_.codePoint] = Glyph{ sf::FloatRect{}, job_.advance, sf::IntRect{}, NoPage };
+			return;
+		}
+	}
+
+	// Distance is stored in alpha channel of white pixels:
+	std::vector<sf::Uint8> rgba(job_.pixels.size() * 4, 255);
+	for (std::size_t i = 0; i < job_.pixels.size(); ++i)
+		rgba[i * 4 + 3] = job_.pixels[i];
+
+	auto & page = *m_pages[pageIndex];
+	page.texture.update(rgba.data(), job_.size.x, job_.size.y, position->x, position->y);
+	page.glyphs.push_back(job_.codePoint);
+	page.lastUsedFrame = m_frame;
+
+	m_glyphs[job_.codePoint] = Glyph{
+			job_.bounds,
+			job_.advance,
+			sf::IntRect{ static_cast<int>(position->x), static_cast<int>(position->y), static_cast<int>(job_.size.x), static_cast<int>(job_.size.y) },
+			pageIndex
+		};
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::size_t SdfGlyphAtlas::evictPage()
+{
+	auto const oldest = std::min_element(m_pages.begin(), m_pages.end(),
+		[](UniquePtr<Page> const & lhs_, UniquePtr<Page> const & rhs_)
+		{
+			return lhs_->lastUsedFrame < rhs_->lastUsedFrame;
+		});
+
+	auto & page = **oldest;
+	for (auto const codePoint : page.glyphs)
+		m_glyphs.erase(codePoint);
+
+	page.glyphs.clear();
+	page.packer.clear();
+	page.lastUsedFrame = m_frame;
+
+	++m_generation;
+	return static_cast<std::size_t>(oldest - m_pages.begin());
+}
+
+//////////////////////////////////////////////////////////////////////////////
+bool SdfGlyphAtlas::canCreatePage() const
+{
+	if (m_pages.empty())
+		return true;
+
+	std::size_t const pageBytes = static_cast<std::size_t>(m_settings.pageSize) * m_settings.pageSize * 4;
+	return (m_pages.size() + 1) * pageBytes + this->getFontTextureMemoryUsage() <= m_settings.maxPages * pageBytes;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::size_t SdfGlyphAtlas::getFontTextureMemoryUsage() const
+{
+	auto const size = m_font->getTexture(m_settings.baseCharacterSize).getSize();
+	return static_cast<std::size_t>(size.x) * size.y * 4;
+}
+
+}
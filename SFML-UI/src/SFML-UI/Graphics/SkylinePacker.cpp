@@ -0,0 +1,116 @@
+#include "SFMLUIPCH.hpp"
+
+#include <SFML-UI/Graphics/SkylinePacker.hpp>
+
+namespace sfui
+{
+
+//////////////////////////////////////////////////////////////////////////////
+SkylinePacker::SkylinePacker(sf::Vector2u const size_)
+	:
+	m_size{ size_ },
+	m_usedArea{ 0 }
+{
+	this->clear();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::optional<sf::Vector2u> SkylinePacker::insert(sf::Vector2u const size_)
+{
+	if (size_.x == 0 || size_.y == 0 || size_.x > m_size.x || size_.y > m_size.y)
+		return std::nullopt;
+
+	std::size_t bestIndex	= m_skyline.size();
+	unsigned bestBottom		= std::numeric_limits<unsigned>::max();
+	unsigned bestWidth		= std::numeric_limits<unsigned>::max();
+
+	for (std::size_t i = 0; i < m_skyline.size(); ++i)
+	{
+		auto const y = this->fitHeight(i, size_.x);
+		if (!y || *y + size_.y > m_size.y)
+			continue;
+
+		unsigned const bottom = *y + size_.y;
+
+		// Prefer the lowest placement, then the narrowest segment (less wasted space).
+		if (bottom < bestBottom || (bottom == bestBottom && m_skyline[i].width < bestWidth))
+		{
+			bestIndex	= i;
+			bestBottom	= bottom;
+			bestWidth	= m_skyline[i].width;
+		}
+	}
+
+	if (bestIndex == m_skyline.size())
+		return std::nullopt;
+
+	sf::Vector2u const position{ m_skyline[bestIndex].x, bestBottom - size_.y };
+	this->addSegment(bestIndex, Segment{ position.x, bestBottom, size_.x });
+
+	m_usedArea += static_cast<std::size_t>(size_.x) * size_.y;
+	return position;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void SkylinePacker::clear()
+{
+	m_skyline.clear();
+	m_skyline.push_back( Segment{ 0, 0, m_size.x } );
+	m_usedArea = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::optional<unsigned> SkylinePacker::fitHeight(std::size_t const index_, unsigned const width_) const
+{
+	unsigned const x = m_skyline[index_].x;
+	if (x + width_ > m_size.x)
+		return std::nullopt;
+
+	unsigned y = 0;
+	unsigned widthLeft = width_;
+	for (std::size_t i = index_; widthLeft > 0; ++i)
+	{
+		y = std::max(y, m_skyline[i].y);
+		widthLeft -= std::min(widthLeft, m_skyline[i].width);
+	}
+	return y;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void SkylinePacker::addSegment(std::size_t const index_, Segment const & segment_)
+{
+	m_skyline.insert(m_skyline.begin() + index_, segment_);
+
+	// Shrink or remove segments covered by the new one:
+	unsigned const right = segment_.x + segment_.width;
+	for (std::size_t i = index_ + 1; i < m_skyline.size(); )
+	{
+		auto & segment = m_skyline[i];
+		if (segment.x >= right)
+			break;
+
+		unsigned const overlap = right - segment.x;
+		if (overlap >= segment.width)
+			m_skyline.erase(m_skyline.begin() + i);
+		else
+		{
+			segment.x		+= overlap;
+			segment.width	-= overlap;
+			break;
+		}
+	}
+
+	// Merge neighbouring segments of the same height:
+	for (std::size_t i = 0; i + 1 < m_skyline.size(); )
+	{
+		if (m_skyline[i].y == m_skyline[i + 1].y)
+		{
+			m_skyline[i].width += m_skyline[i + 1].width;
+			m_skyline.erase(m_skyline.begin() + i + 1);
+		}
+		else
+			++i;
+	}
+}
+
+}
@@ -0,0 +1,146 @@
+#include "SFMLUIPCH.hpp"
+
+#include <SFML-UI/Graphics/TextRunCache.hpp>
+
+namespace sfui
+{
+
+//////////////////////////////////////////////////////////////////////////////
+TextRunCache::TextRunCache(std::size_t const capacity_)
+	:
+	m_capacity{ capacity_ }
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+TextRunCache& TextRunCache::shared()
+{
+	static TextRunCache cache;
+	return cache;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+TextRunCache::RunPtrType TextRunCache::acquire(sf::Font const & font_, unsigned const characterSize_, sf::String const & string_)
+{
+	Key key{ &font_, characterSize_, string_.toUtf32() };
+
+	auto const it = m_runs.find(key);
+	if (it != m_runs.end())
+		return it->second;
+
+	if (m_runs.size() >= m_capacity)
+		this->trim();
+
+	auto run = std::make_shared<const TextRun>( TextRunCache::layout(font_, characterSize_, string_) );
+	m_runs.emplace(std::move(key), run);
+	return run;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void TextRunCache::forget(sf::Font const & font_)
+{
+	for (auto it = m_runs.begin(); it != m_runs.end(); )
+	{
+		if (it->first.font == &font_)
+			it = m_runs.erase(it);
+		else
+			++it;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void TextRunCache::trim()
+{
+	for (auto it = m_runs.begin(); it != m_runs.end(); )
+	{
+		// Only the cache holds this run:
+		if (it->second.use_count() == 1)
+			it = m_runs.erase(it);
+		else
+			++it;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void TextRunCache::setCapacity(std::size_t const capacity_)
+{
+	m_capacity = capacity_;
+	if (m_runs.size() > m_capacity)
+		this->trim();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+TextRun TextRunCache::layout(sf::Font const & font_, unsigned const characterSize_, sf::String const & string_)
+{
+	TextRun run;
+	run.texture = &font_.getTexture(characterSize_);
+
+	float const lineSpacing = font_.getLineSpacing(characterSize_);
+
+	float x = 0.f;
+	float y = static_cast<float>(characterSize_);
+
+	float minX = 0.f, minY = 0.f, maxX = 0.f, maxY = 0.f;
+
+	run.vertices.reserve(string_.getSize() * 6);
+
+	sf::Uint32 previous = 0;
+	for (std::size_t i = 0; i < string_.getSize(); ++i)
+	{
+		sf::Uint32 const current = string_[i];
+
+		x += font_.getKerning(previous, current, characterSize_);
+		previous = current;
+
+		if (current == U'\n')
+		{
+			x = 0.f;
+			y += lineSpacing;
+			continue;
+		}
+
+		sf::Glyph const & glyph = font_.getGlyph(current, characterSize_, false);
+
+		if (glyph.bounds.width > 0.f && glyph.bounds.height > 0.f)
+		{
+			float const left	= x + glyph.bounds.left;
+			float const top		= y + glyph.bounds.top;
+			float const right	= left + glyph.bounds.width;
+			float const bottom	= top + glyph.bounds.height;
+
+			float const u1 = static_cast<float>(glyph.textureRect.left);
+			float const v1 = static_cast<float>(glyph.textureRect.top);
+			float const u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width);
+			float const v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height);
+
+			run.vertices.emplace_back(sf::Vector2f{ left, top },		sf::Color::White, sf::Vector2f{ u1, v1 });
+			run.vertices.emplace_back(sf::Vector2f{ right, top },		sf::Color::White, sf::Vector2f{ u2, v1 });
+			run.vertices.emplace_back(sf::Vector2f{ left, bottom },		sf::Color::White, sf::Vector2f{ u1, v2 });
+			run.vertices.emplace_back(sf::Vector2f{ left, bottom },		sf::Color::White, sf::Vector2f{ u1, v2 });
+			run.vertices.emplace_back(sf::Vector2f{ right, top },		sf::Color::White, sf::Vector2f{ u2, v1 });
+			run.vertices.emplace_back(sf::Vector2f{ right, bottom },	sf::Color::White, sf::Vector2f{ u2, v2 });
+
+			minX = std::min(minX, left);
+			minY = std::min(minY, top);
+			maxX = std::max(maxX, right);
+			maxY = std::max(maxY, bottom);
+		}
+
+		x += glyph.advance;
+	}
+
+	run.bounds = sf::FloatRect{ minX, minY, maxX - minX, maxY - minY };
+	return run;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::size_t TextRunCache::KeyHash::operator()(Key const & key_) const
+{
+	std::size_t hash = std::hash<std::u32string>{}(key_.string);
+	// Combine hashes the same way boost::hash_combine does:
+	hash ^= std::hash<sf::Font const*>{}(key_.font)		+ 0x9e3779b9 + (hash << 6) + (hash >> 2);
+	hash ^= std::hash<unsigned>{}(key_.characterSize)	+ 0x9e3779b9 + (hash << 6) + (hash >> 2);
+	return hash;
+}
+
+}
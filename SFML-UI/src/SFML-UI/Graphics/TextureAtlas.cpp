@@ -0,0 +1,195 @@
+#include "SFMLUIPCH.hpp"
+
+#include <SFML-UI/Graphics/TextureAtlas.hpp>
+
+namespace sfui
+{
+
+//////////////////////////////////////////////////////////////////////////////
+TextureAtlas::TextureAtlas()
+	:
+	TextureAtlas(Settings{})
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+TextureAtlas::TextureAtlas(Settings const & settings_)
+	:
+	m_settings{ settings_ },
+	m_nextRegion{ InvalidRegion + 1 },
+	m_generation{ 0 }
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+TextureAtlas::RegionId TextureAtlas::add(sf::Image const & image_)
+{
+	auto const size = image_.getSize();
+	if (size.x + 2 * m_settings.padding > m_settings.pageSize || size.y + 2 * m_settings.padding > m_settings.pageSize)
+		throw std::invalid_argument("Image is bigger than the texture atlas page.");
+
+	Entry entry{ image_, 0, sf::IntRect{ 0, 0, static_cast<int>(size.x), static_cast<int>(size.y) } };
+	this->place(entry);
+	this->upload(entry);
+
+	RegionId const region = m_nextRegion++;
+	m_entries.emplace(region, std::move(entry));
+	return region;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+bool TextureAtlas::remove(RegionId const region_)
+{
+	auto const it = m_entries.find(region_);
+	if (it == m_entries.end())
+		return false;
+
+	std::size_t const pageIndex = it->second.page;
+	auto & page = *m_pages[pageIndex];
+	page.liveArea -= this->paddedArea(it->second);
+
+	m_entries.erase(it);
+
+	// Stale pixels stay in the texture - they are overwritten by the next image placed there.
+	std::size_t const usedArea = page.packer.getUsedArea();
+	if (usedArea > 0 && static_cast<float>(usedArea - page.liveArea) > m_settings.repackThreshold * static_cast<float>(usedArea))
+		this->repackPage(pageIndex);
+
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::optional<TextureAtlas::Region> TextureAtlas::find(RegionId const region_) const
+{
+	auto const it = m_entries.find(region_);
+	if (it == m_entries.end())
+		return std::nullopt;
+
+	return Region{ &m_pages[it->second.page]->texture, it->second.rect };
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void TextureAtlas::repack()
+{
+	std::vector<Entry*> entries;
+	entries.reserve(m_entries.size());
+	for (auto & [region, entry] : m_entries)
+		entries.push_back(&entry);
+
+	// Taller images first - skyline packing wastes the least space this way:
+	std::sort(entries.begin(), entries.end(),
+		[](Entry const * lhs_, Entry const * rhs_)
+		{
+			return lhs_->rect.height > rhs_->rect.height;
+		});
+
+	for (auto & page : m_pages)
+	{
+		page->packer.clear();
+		page->liveArea = 0;
+	}
+
+	for (auto entry : entries)
+		this->place(*entry);
+
+	// Drop pages that became empty:
+	while (!m_pages.empty() && m_pages.back()->liveArea == 0)
+		m_pages.pop_back();
+
+	for (auto entry : entries)
+		this->upload(*entry);
+
+	++m_generation;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void TextureAtlas::place(Entry & entry_, std::size_t const firstPage_)
+{
+	sf::Vector2u const paddedSize{
+			static_cast<unsigned>(entry_.rect.width) + 2 * m_settings.padding,
+			static_cast<unsigned>(entry_.rect.height) + 2 * m_settings.padding
+		};
+
+	std::optional<sf::Vector2u> position;
+	std::size_t pageIndex = firstPage_;
+	for (; pageIndex < m_pages.size(); ++pageIndex)
+	{
+		position = m_pages[pageIndex]->packer.insert(paddedSize);
+		if (position)
+			break;
+	}
+
+	if (!position)
+	{
+		auto page = std::make_unique<Page>( Page{ sf::Texture{}, SkylinePacker{ sf::Vector2u{ m_settings.pageSize, m_settings.pageSize } }, 0 } );
+		if (!page->texture.create(m_settings.pageSize, m_settings.pageSize))
+			throw std::runtime_error("Could not create texture atlas page.");
+
+		m_pages.push_back(std::move(page));
+		pageIndex	= m_pages.size() - 1;
+		position	= m_pages[pageIndex]->packer.insert(paddedSize);
+	}
+
+	entry_.page		= pageIndex;
+	entry_.rect.left	= static_cast<int>(position->x + m_settings.padding);
+	entry_.rect.top		= static_cast<int>(position->y + m_settings.padding);
+
+	m_pages[pageIndex]->liveArea += this->paddedArea(entry_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void TextureAtlas::upload(Entry const & entry_)
+{
+	auto & texture = m_pages[entry_.page]->texture;
+	unsigned const padding = m_settings.padding;
+	if (padding == 0)
+	{
+		texture.update(entry_.image, static_cast<unsigned>(entry_.rect.left), static_cast<unsigned>(entry_.rect.top));
+		return;
+	}
+
+	// Page contents are undefined (or left from removed images), so the padding is uploaded too, cleared:
+	sf::Image padded;
+	padded.create(static_cast<unsigned>(entry_.rect.width) + 2 * padding, static_cast<unsigned>(entry_.rect.height) + 2 * padding, sf::Color::Transparent);
+	padded.copy(entry_.image, padding, padding);
+	texture.update(padded, static_cast<unsigned>(entry_.rect.left) - padding, static_cast<unsigned>(entry_.rect.top) - padding);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void TextureAtlas::repackPage(std::size_t const page_)
+{
+	std::vector<Entry*> entries;
+	for (auto & [region, entry] : m_entries)
+	{
+		if (entry.page == page_)
+			entries.push_back(&entry);
+	}
+
+	std::sort(entries.begin(), entries.end(),
+		[](Entry const * lhs_, Entry const * rhs_)
+		{
+			return lhs_->rect.height > rhs_->rect.height;
+		});
+
+	auto & page = *m_pages[page_];
+	page.packer.clear();
+	page.liveArea = 0;
+
+	// Place back on the same page first, overflow goes to later pages:
+	for (auto entry : entries)
+		this->place(*entry, page_);
+
+	for (auto entry : entries)
+		this->upload(*entry);
+
+	++m_generation;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::size_t TextureAtlas::paddedArea(Entry const & entry_) const
+{
+	return static_cast<std::size_t>(entry_.rect.width + 2 * m_settings.padding)
+		* static_cast<std::size_t>(entry_.rect.height + 2 * m_settings.padding);
+}
+
+}
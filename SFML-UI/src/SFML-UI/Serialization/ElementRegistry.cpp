@@ -0,0 +1,61 @@
+#include "SFMLUIPCH.hpp"
+
+#include <SFML-UI/Serialization/ElementRegistry.hpp>
+
+namespace sfui
+{
+
+//////////////////////////////////////////////////////////////////////////////
+ElementRegistry::ElementRegistry()
+{
+	this->add<Element>("Element");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+ElementRegistry::TypeIndex ElementRegistry::find(std::string_view const name_) const
+{
+	auto const it = m_nameToIndex.find(name_);
+	return it != m_nameToIndex.end() ? it->second : InvalidType;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+ElementRegistry::TypeIndex ElementRegistry::find(Element const & element_) const
+{
+	auto const it = m_typeToIndex.find(std::type_index{ typeid(element_) });
+	return it != m_typeToIndex.end() ? it->second : InvalidType;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+ElementRegistry::ElementPtrType ElementRegistry::create(TypeIndex const type_) const
+{
+	if (auto element = m_entries[type_].factory())
+		return element;
+	else
+		throw std::runtime_error("Element factory did not create an element.");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+ElementRegistry::ElementPtrType ElementRegistry::create(std::string_view const name_) const
+{
+	TypeIndex const type = this->find(name_);
+	if (type == InvalidType)
+		throw std::invalid_argument("Element type is not registered.");
+
+	return this->create(type);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void ElementRegistry::add(std::type_index const type_, std::string name_, FactoryType factory_)
+{
+	if (m_nameToIndex.contains(name_))
+		throw std::invalid_argument("Element type name is already registered.");
+
+	auto const index = static_cast<TypeIndex>(m_entries.size());
+
+	// Re-registering a type under another name keeps the new name for saving.
+	m_typeToIndex[type_] = index;
+	m_nameToIndex.emplace(name_, index);
+	m_entries.push_back(Entry{ std::move(name_), std::move(factory_) });
+}
+
+}
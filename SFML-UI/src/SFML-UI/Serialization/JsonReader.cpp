@@ -0,0 +1,388 @@
+#include "SFMLUIPCH.hpp"
+
+#include <SFML-UI/Serialization/JsonReader.hpp>
+
+#include <charconv>
+
+namespace sfui
+{
+
+namespace
+{
+
+//////////////////////////////////////////////////////////////////////////////
+int hexDigit(char const character_)
+{
+	if (character_ >= '0' && character_ <= '9') return character_ - '0';
+	if (character_ >= 'a' && character_ <= 'f') return character_ - 'a' + 10;
+	if (character_ >= 'A' && character_ <= 'F') return character_ - 'A' + 10;
+	return -1;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void appendUtf8(std::string & output_, std::uint32_t const codePoint_)
+{
+	if (codePoint_ < 0x80)
+		output_ += static_cast<char>(codePoint_);
+	else if (codePoint_ < 0x800)
+	{
+		output_ += static_cast<char>(0xC0 | (codePoint_ >> 6));
+		output_ += static_cast<char>(0x80 | (codePoint_ & 0x3F));
+	}
+	else if (codePoint_ < 0x10000)
+	{
+		output_ += static_cast<char>(0xE0 | (codePoint_ >> 12));
+		output_ += static_cast<char>(0x80 | ((codePoint_ >> 6) & 0x3F));
+		output_ += static_cast<char>(0x80 | (codePoint_ & 0x3F));
+	}
+	else
+	{
+		output_ += static_cast<char>(0xF0 | (codePoint_ >> 18));
+		output_ += static_cast<char>(0x80 | ((codePoint_ >> 12) & 0x3F));
+		output_ += static_cast<char>(0x80 | ((codePoint_ >> 6) & 0x3F));
+		output_ += static_cast<char>(0x80 | (codePoint_ & 0x3F));
+	}
+}
+
+}
+
+//////////////////////////////////////////////////////////////////////////////
+JsonReader::JsonReader(std::string_view const text_)
+	:
+	m_text{ text_ }
+{
+	// Skip UTF-8 byte order mark:
+	if (m_text.starts_with("\xEF\xBB\xBF"))
+		m_position = m_lineStart = 3;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+JsonReader::Token JsonReader::next()
+{
+	this->skipWhitespace();
+
+	switch (m_state)
+	{
+	case State::Value:
+		return this->readValue();
+	case State::ValueOrEnd:
+	{
+		if (m_position < m_text.size() && m_text[m_position] == ']')
+			return this->closeContainer(Token::EndArray);
+		return this->readValue();
+	}
+	case State::KeyOrEnd:
+	case State::Key:
+	{
+		if (m_position >= m_text.size())
+			this->fail("Unexpected end of document, expected object member");
+
+		if (m_text[m_position] == '}' && m_state == State::KeyOrEnd)
+			return this->closeContainer(Token::EndObject);
+		if (m_text[m_position] != '"')
+			this->fail("Expected object member name");
+
+		this->readString();
+		this->skipWhitespace();
+		if (m_position >= m_text.size() || m_text[m_position] != ':')
+			this->fail("Expected ':' after object member name");
+
+		++m_position;
+		m_state = State::Value;
+		return Token::Key;
+	}
+	case State::CommaOrEnd:
+	{
+		if (m_position >= m_text.size())
+			this->fail("Unexpected end of document");
+
+		char const character = m_text[m_position];
+		if (character == ',')
+		{
+			++m_position;
+			m_state = m_inObject.back() ? State::Key : State::Value;
+			return this->next();
+		}
+		if (character == '}' && m_inObject.back())
+			return this->closeContainer(Token::EndObject);
+		if (character == ']' && !m_inObject.back())
+			return this->closeContainer(Token::EndArray);
+
+		this->fail(m_inObject.back() ? "Expected ',' or '}'" : "Expected ',' or ']'");
+	}
+	case State::DocumentEnd:
+	{
+		if (m_position < m_text.size())
+			this->fail("Unexpected data after the document");
+		return Token::End;
+	}
+	}
+	return Token::End;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void JsonReader::skip(Token const token_)
+{
+	if (token_ != Token::BeginObject && token_ != Token::BeginArray)
+		return;
+
+	std::size_t depth = 1;
+	while (depth > 0)
+	{
+		switch (this->next())
+		{
+		case Token::BeginObject:
+		case Token::BeginArray:		{ ++depth; break; }
+		case Token::EndObject:
+		case Token::EndArray:		{ --depth; break; }
+		default: break;
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void JsonReader::fail(std::string const & message_) const
+{
+	throw Error{ message_, m_line, m_position - m_lineStart + 1 };
+}
+
+//////////////////////////////////////////////////////////////////////////////
+JsonReader::Token JsonReader::readValue()
+{
+	if (m_position >= m_text.size())
+		this->fail("Unexpected end of document, expected value");
+
+	switch (m_text[m_position])
+	{
+	case '{':
+	{
+		++m_position;
+		m_inObject.push_back(true);
+		m_state = State::KeyOrEnd;
+		return Token::BeginObject;
+	}
+	case '[':
+	{
+		++m_position;
+		m_inObject.push_back(false);
+		m_state = State::ValueOrEnd;
+		return Token::BeginArray;
+	}
+	case '"':
+	{
+		this->readString();
+		this->afterValue();
+		return Token::String;
+	}
+	case 't':
+	{
+		this->readLiteral("true");
+		m_boolean = true;
+		this->afterValue();
+		return Token::Boolean;
+	}
+	case 'f':
+	{
+		this->readLiteral("false");
+		m_boolean = false;
+		this->afterValue();
+		return Token::Boolean;
+	}
+	case 'n':
+	{
+		this->readLiteral("null");
+		this->afterValue();
+		return Token::Null;
+	}
+	default:
+	{
+		this->readNumber();
+		this->afterValue();
+		return Token::Number;
+	}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+JsonReader::Token JsonReader::closeContainer(Token const token_)
+{
+	++m_position;
+	m_inObject.pop_back();
+	this->afterValue();
+	return token_;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void JsonReader::readString()
+{
+	std::size_t const begin = ++m_position;
+
+	// Fast path: strings without escapes are returned as views.
+	while (m_position < m_text.size() && m_text[m_position] != '"' && m_text[m_position] != '\\')
+	{
+		if (static_cast<unsigned char>(m_text[m_position]) < 0x20)
+			this->fail("Control character in string");
+		++m_position;
+	}
+
+	if (m_position >= m_text.size())
+		this->fail("Unterminated string");
+
+	if (m_text[m_position] == '"')
+	{
+		m_string = m_text.substr(begin, m_position - begin);
+		++m_position;
+		return;
+	}
+
+	m_unescaped.assign(m_text.substr(begin, m_position - begin));
+	while (true)
+	{
+		if (m_position >= m_text.size())
+			this->fail("Unterminated string");
+
+		char const character = m_text[m_position++];
+		if (character == '"')
+			break;
+		if (static_cast<unsigned char>(character) < 0x20)
+			this->fail("Control character in string");
+		if (character != '\\')
+		{
+			m_unescaped += character;
+			continue;
+		}
+
+		if (m_position >= m_text.size())
+			this->fail("Unterminated string");
+
+		switch (m_text[m_position++])
+		{
+		case '"':	{ m_unescaped += '"'; break; }
+		case '\\':	{ m_unescaped += '\\'; break; }
+		case '/':	{ m_unescaped += '/'; break; }
+		case 'b':	{ m_unescaped += '\b'; break; }
+		case 'f':	{ m_unescaped += '\f'; break; }
+		case 'n':	{ m_unescaped += '\n'; break; }
+		case 'r':	{ m_unescaped += '\r'; break; }
+		case 't':	{ m_unescaped += '\t'; break; }
+		case 'u':
+		{
+			auto const readHex4 = [this]() {
+				if (m_text.size() - m_position < 4)
+					this->fail("Invalid unicode escape");
+
+				std::uint32_t value = 0;
+				for (int i = 0; i < 4; ++i)
+				{
+					int const digit = hexDigit(m_text[m_position++]);
+					if (digit < 0)
+						this->fail("Invalid unicode escape");
+					value = (value << 4) | static_cast<std::uint32_t>(digit);
+				}
+				return value;
+			};
+
+			std::uint32_t codePoint = readHex4();
+
+			// Characters outside of the basic plane are escaped as surrogate pairs:
+			if (codePoint >= 0xD800 && codePoint < 0xDC00)
+			{
+				if (!m_text.substr(m_position).starts_with("\\u"))
+					this->fail("Unpaired surrogate in unicode escape");
+
+				m_position += 2;
+				std::uint32_t const low = readHex4();
+				if (low < 0xDC00 || low >= 0xE000)
+					this->fail("Unpaired surrogate in unicode escape");
+
+				codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+			}
+			else if (codePoint >= 0xDC00 && codePoint < 0xE000)
+				this->fail("Unpaired surrogate in unicode escape");
+
+			appendUtf8(m_unescaped, codePoint);
+			break;
+		}
+		default:
+			this->fail("Invalid escape sequence");
+		}
+	}
+	m_string = m_unescaped;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void JsonReader::readNumber()
+{
+	std::size_t const begin = m_position;
+
+	// Validate JSON number grammar (std::from_chars is more permissive):
+	auto const digits = [this]() {
+		std::size_t const first = m_position;
+		while (m_position < m_text.size() && m_text[m_position] >= '0' && m_text[m_position] <= '9')
+			++m_position;
+		return m_position - first;
+	};
+	auto const peek = [this](char const character_) {
+		return m_position < m_text.size() && m_text[m_position] == character_;
+	};
+
+	if (peek('-'))
+		++m_position;
+
+	if (peek('0'))
+		++m_position;
+	else if (digits() == 0)
+		this->fail("Expected value");
+
+	if (peek('.'))
+	{
+		++m_position;
+		if (digits() == 0)
+			this->fail("Expected digits after decimal point");
+	}
+	if (peek('e') || peek('E'))
+	{
+		++m_position;
+		if (peek('+') || peek('-'))
+			++m_position;
+		if (digits() == 0)
+			this->fail("Expected digits in exponent");
+	}
+
+	auto const result = std::from_chars(m_text.data() + begin, m_text.data() + m_position, m_number);
+	if (result.ec == std::errc::result_out_of_range)
+		this->fail("Number out of range");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void JsonReader::readLiteral(std::string_view const literal_)
+{
+	if (!m_text.substr(m_position).starts_with(literal_))
+		this->fail("Expected value");
+	m_position += literal_.size();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void JsonReader::skipWhitespace()
+{
+	while (m_position < m_text.size())
+	{
+		char const character = m_text[m_position];
+		if (character == '\n')
+		{
+			++m_line;
+			m_lineStart = m_position + 1;
+		}
+		else if (character != ' ' && character != '\t' && character != '\r')
+			return;
+		++m_position;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void JsonReader::afterValue()
+{
+	m_state = m_inObject.empty() ? State::DocumentEnd : State::CommaOrEnd;
+}
+
+}
@@ -0,0 +1,557 @@
+#include "SFMLUIPCH.hpp"
+
+#include <SFML-UI/Serialization/SceneReconciler.hpp>
+#include <SFML-UI/Serialization/UiDescription.hpp>
+#include <SFML-UI/Core/MappedFile.hpp>
+
+#include <unordered_map>
+#include <unordered_set>
+
+namespace sfui
+{
+
+namespace
+{
+
+using Contents	= SceneSnapshot::Contents;
+using Node		= SceneSnapshot::Node;
+using Property	= SceneSnapshot::Property;
+
+//////////////////////////////////////////////////////////////////////////////
+std::string_view const* findProperty(Contents const & contents_, Node const & node_, std::string_view const name_)
+{
+	for (std::uint32_t p = node_.firstProperty; p < node_.firstProperty + node_.propertyCount; ++p)
+	{
+		if (contents_.properties[p].name == name_)
+			return &contents_.properties[p].value;
+	}
+	return nullptr;
+}
+
+constexpr std::uint32_t NoMatch = std::numeric_limits<std::uint32_t>::max();
+
+//////////////////////////////////////////////////////////////////////////////
+std::vector<std::string_view> findIds(Contents const & contents_)
+{
+	std::vector<std::string_view> ids(contents_.nodes.size());
+	std::unordered_set<std::string_view> usedIds;
+
+	for (std::size_t i = 0; i < contents_.nodes.size(); ++i)
+	{
+		// Unique ids identify nodes anywhere in the tree, repeated ones are ignored:
+		std::string_view const* const id = findProperty(contents_, contents_.nodes[i], SceneReconciler::IdProperty);
+		if (id && !id->empty() && usedIds.insert(*id).second)
+			ids[i] = *id;
+	}
+	return ids;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::uint64_t hashNode(Contents const & contents_, Node const & node_)
+{
+	// FNV-1a over every field the reconciler applies:
+	std::uint64_t hash = 0xCBF29CE484222325ull;
+	auto const mix = [&hash](void const* data_, std::size_t const size_) {
+		auto const bytes = static_cast<unsigned char const*>(data_);
+		for (std::size_t i = 0; i < size_; ++i)
+			hash = (hash ^ bytes[i]) * 0x100000001B3ull;
+	};
+	auto const mixString = [&mix](std::string_view const string_) {
+		std::size_t const size = string_.size();
+		mix(&size, sizeof(size));
+		mix(string_.data(), size);
+	};
+
+	float const fields[7] = { node_.position.x, node_.position.y, node_.origin.x, node_.origin.y, node_.scale.x, node_.scale.y, node_.rotation };
+	mixString(contents_.types[node_.type]);
+	mix(fields, sizeof(fields));
+	mix(&node_.zIndex, sizeof(node_.zIndex));
+	mix(&node_.relative, sizeof(node_.relative));
+
+	for (std::uint32_t p = node_.firstProperty; p < node_.firstProperty + node_.propertyCount; ++p)
+	{
+		mixString(contents_.properties[p].name);
+		mixString(contents_.properties[p].value);
+	}
+	return hash;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+bool areIdentical(Contents const & lhsContents_, Node const & lhs_, Contents const & rhsContents_, Node const & rhs_)
+{
+	return lhsContents_.types[lhs_.type] == rhsContents_.types[rhs_.type]
+		&& lhs_.position == rhs_.position && lhs_.origin == rhs_.origin && lhs_.scale == rhs_.scale && lhs_.rotation == rhs_.rotation
+		&& lhs_.zIndex == rhs_.zIndex && lhs_.relative == rhs_.relative
+		&& lhs_.propertyCount == rhs_.propertyCount
+		&& std::equal(
+				lhsContents_.properties.begin() + lhs_.firstProperty,
+				lhsContents_.properties.begin() + lhs_.firstProperty + lhs_.propertyCount,
+				rhsContents_.properties.begin() + rhs_.firstProperty,
+				[](Property const & lhsProperty_, Property const & rhsProperty_)
+				{
+					return lhsProperty_.name == rhsProperty_.name && lhsProperty_.value == rhsProperty_.value;
+				});
+}
+
+/// <summary>
+/// Nodes without id grouped by parent.
+/// </summary>
+struct ChildGroups
+{
+	std::vector<std::uint32_t>	offsets;	// Group g spans nodes[offsets[g], offsets[g + 1]). Group 0 holds top-level nodes, group i + 1 children of node i.
+	std::vector<std::uint32_t>	nodes;
+
+	std::span<std::uint32_t const> getGroup(std::size_t const group_) const {
+		return { nodes.data() + offsets[group_], nodes.data() + offsets[group_ + 1] };
+	}
+};
+
+//////////////////////////////////////////////////////////////////////////////
+ChildGroups groupChildrenWithoutId(Contents const & contents_, std::vector<std::string_view> const & ids_)
+{
+	std::size_t const count = contents_.nodes.size();
+	auto const groupOf = [&contents_](std::uint32_t const node_) {
+		std::uint32_t const parent = contents_.nodes[node_].parent;
+		return parent == SceneSnapshot::NoParent ? 0 : parent + 1;
+	};
+
+	ChildGroups groups;
+	groups.offsets.assign(count + 2, 0);
+	for (std::uint32_t i = 0; i < count; ++i)
+	{
+		if (ids_[i].empty())
+			++groups.offsets[groupOf(i) + 1];
+	}
+	for (std::size_t g = 1; g < groups.offsets.size(); ++g)
+		groups.offsets[g] += groups.offsets[g - 1];
+
+	// Nodes are in preorder, so every group is filled in sibling order:
+	groups.nodes.resize(groups.offsets.back());
+	std::vector<std::uint32_t> fill(groups.offsets.begin(), groups.offsets.end() - 1);
+	for (std::uint32_t i = 0; i < count; ++i)
+	{
+		if (ids_[i].empty())
+			groups.nodes[fill[groupOf(i)]++] = i;
+	}
+	return groups;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::vector<std::uint32_t> matchNodes(Contents const & previous_, std::vector<std::string_view> const & previousIds_,
+	Contents const & next_, std::vector<std::string_view> const & nextIds_)
+{
+	std::vector<std::uint32_t> matches(next_.nodes.size(), NoMatch);
+
+	// Nodes with id are matched anywhere in the tree:
+	std::unordered_map<std::string_view, std::uint32_t> previousById;
+	for (std::uint32_t i = 0; i < previousIds_.size(); ++i)
+	{
+		if (!previousIds_[i].empty())
+			previousById.emplace(previousIds_[i], i);
+	}
+	for (std::uint32_t i = 0; i < nextIds_.size(); ++i)
+	{
+		if (!nextIds_[i].empty())
+		{
+			auto const it = previousById.find(nextIds_[i]);
+			if (it != previousById.end())
+				matches[i] = it->second;
+		}
+	}
+
+	// Nodes without id are matched among children of matched parents. Identical nodes first, so nodes inserted,
+	// removed or replaced in the middle do not shift their siblings, then remaining ones of the same type in order:
+	ChildGroups const previousGroups	= groupChildrenWithoutId(previous_, previousIds_);
+	ChildGroups const nextGroups		= groupChildrenWithoutId(next_, nextIds_);
+
+	std::unordered_map<std::uint64_t, std::vector<std::uint32_t>>		byHash;
+	std::unordered_map<std::string_view, std::vector<std::uint32_t>>	byType;
+	std::vector<bool> used(previous_.nodes.size(), false);
+
+	auto const alignChildren = [&](std::size_t const previousGroup_, std::size_t const nextGroup_)
+	{
+		auto before	= previousGroups.getGroup(previousGroup_);
+		auto after	= nextGroups.getGroup(nextGroup_);
+
+		// Usually only a few nodes change - pair the unchanged prefix and suffix directly:
+		auto const pairIdentical = [&](std::uint32_t const previousNode_, std::uint32_t const nextNode_) {
+			if (!areIdentical(previous_, previous_.nodes[previousNode_], next_, next_.nodes[nextNode_]))
+				return false;
+			matches[nextNode_] = previousNode_;
+			return true;
+		};
+		while (!before.empty() && !after.empty() && pairIdentical(before.front(), after.front()))
+		{
+			before	= before.subspan(1);
+			after	= after.subspan(1);
+		}
+		while (!before.empty() && !after.empty() && pairIdentical(before.back(), after.back()))
+		{
+			before	= before.first(before.size() - 1);
+			after	= after.first(after.size() - 1);
+		}
+		if (before.empty() || after.empty())
+			return;
+
+		// Candidates are stored reversed, so the first one in order is taken from the back:
+		byHash.clear();
+		for (auto it = before.rbegin(); it != before.rend(); ++it)
+			byHash[hashNode(previous_, previous_.nodes[*it])].push_back(*it);
+
+		for (std::uint32_t const node : after)
+		{
+			auto const candidates = byHash.find(hashNode(next_, next_.nodes[node]));
+			if (candidates != byHash.end() && !candidates->second.empty())
+			{
+				matches[node] = candidates->second.back();
+				used[matches[node]] = true;
+				candidates->second.pop_back();
+			}
+		}
+
+		byType.clear();
+		for (auto it = before.rbegin(); it != before.rend(); ++it)
+		{
+			if (!used[*it])
+				byType[previous_.types[previous_.nodes[*it].type]].push_back(*it);
+		}
+
+		for (std::uint32_t const node : after)
+		{
+			if (matches[node] != NoMatch)
+				continue;
+
+			auto const candidates = byType.find(next_.types[next_.nodes[node].type]);
+			if (candidates != byType.end() && !candidates->second.empty())
+			{
+				matches[node] = candidates->second.back();
+				candidates->second.pop_back();
+			}
+		}
+	};
+
+	// Preorder, so every parent is matched before its children:
+	alignChildren(0, 0);
+	for (std::uint32_t i = 0; i < next_.nodes.size(); ++i)
+	{
+		if (matches[i] != NoMatch)
+			alignChildren(matches[i] + 1, i + 1);
+	}
+	return matches;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void applyTransform(Element & element_, Node const & node_)
+{
+	element_.setOrigin(node_.origin);
+	element_.setPosition(node_.position);
+	element_.setScale(node_.scale);
+	element_.setRotation(node_.rotation);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void applyProperties(Element & element_, Contents const & contents_, Node const & node_)
+{
+	for (std::uint32_t p = node_.firstProperty; p < node_.firstProperty + node_.propertyCount; ++p)
+		element_.setProperty(contents_.properties[p].name, std::string{ contents_.properties[p].value });
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::vector<Property> sortedProperties(Contents const & contents_, Node const & node_)
+{
+	std::vector<Property> properties(
+			contents_.properties.begin() + node_.firstProperty,
+			contents_.properties.begin() + node_.firstProperty + node_.propertyCount
+		);
+	std::sort(properties.begin(), properties.end(),
+		[](Property const & lhs_, Property const & rhs_)
+		{
+			return lhs_.name < rhs_.name;
+		});
+	return properties;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+bool updateProperties(Element & element_, Contents const & previous_, Node const & previousNode_, Contents const & next_, Node const & nextNode_)
+{
+	// Common case - nothing changed, in the same order:
+	if (previousNode_.propertyCount == nextNode_.propertyCount
+		&& std::equal(
+				previous_.properties.begin() + previousNode_.firstProperty,
+				previous_.properties.begin() + previousNode_.firstProperty + previousNode_.propertyCount,
+				next_.properties.begin() + nextNode_.firstProperty,
+				[](Property const & lhs_, Property const & rhs_)
+				{
+					return lhs_.name == rhs_.name && lhs_.value == rhs_.value;
+				}))
+		return false;
+
+	// Merge of both sorted lists: set added and changed properties, remove dropped ones.
+	std::vector<Property> const before	= sortedProperties(previous_, previousNode_);
+	std::vector<Property> const after	= sortedProperties(next_, nextNode_);
+
+	bool changed = false;
+	auto oldIt = before.begin();
+	auto newIt = after.begin();
+	while (oldIt != before.end() || newIt != after.end())
+	{
+		if (newIt == after.end() || (oldIt != before.end() && oldIt->name < newIt->name))
+		{
+			element_.removeProperty(oldIt->name);
+			changed = true;
+			++oldIt;
+		}
+		else if (oldIt == before.end() || newIt->name < oldIt->name)
+		{
+			element_.setProperty(newIt->name, std::string{ newIt->value });
+			changed = true;
+			++newIt;
+		}
+		else
+		{
+			if (oldIt->value != newIt->value)
+			{
+				element_.setProperty(newIt->name, std::string{ newIt->value });
+				changed = true;
+			}
+			++oldIt;
+			++newIt;
+		}
+	}
+	return changed;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+bool updateFields(Element & element_, Contents const & previous_, Node const & previousNode_, Contents const & next_, Node const & nextNode_)
+{
+	bool changed = false;
+	if (previousNode_.origin != nextNode_.origin)
+	{
+		element_.setOrigin(nextNode_.origin);
+		changed = true;
+	}
+	if (previousNode_.position != nextNode_.position)
+	{
+		element_.setPosition(nextNode_.position);
+		changed = true;
+	}
+	if (previousNode_.scale != nextNode_.scale)
+	{
+		element_.setScale(nextNode_.scale);
+		changed = true;
+	}
+	if (previousNode_.rotation != nextNode_.rotation)
+	{
+		element_.setRotation(nextNode_.rotation);
+		changed = true;
+	}
+	if (previousNode_.zIndex != nextNode_.zIndex)
+	{
+		element_.setZIndex(nextNode_.zIndex);
+		changed = true;
+	}
+	if (previousNode_.propertyCount != 0 || nextNode_.propertyCount != 0)
+		changed |= updateProperties(element_, previous_, previousNode_, next_, nextNode_);
+
+	return changed;
+}
+
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SceneReconciler::SceneReconciler(ElementRegistry const & registry_, Element & root_)
+	:
+	m_registry{ registry_ },
+	m_root{ root_ }
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SceneReconciler::Stats SceneReconciler::apply(std::vector<std::byte> snapshot_)
+{
+	Contents next = SceneSnapshot::decode(snapshot_);
+
+	// Resolve types before touching the tree, so unknown type leaves it intact:
+	std::vector<ElementRegistry::TypeIndex> registryTypes(next.types.size());
+	for (std::size_t i = 0; i < next.types.size(); ++i)
+	{
+		registryTypes[i] = m_registry.find(next.types[i]);
+		if (registryTypes[i] == ElementRegistry::InvalidType)
+			throw std::runtime_error("Scene snapshot contains element type that is not registered.");
+	}
+
+	std::vector<std::string_view> ids = findIds(next);
+	std::vector<WeakPtr<Element>> elements(next.nodes.size());
+
+	Stats stats;
+	if (m_contents.nodes.empty())
+	{
+		// Nothing to compare with, create everything in bulk:
+		std::vector<Element::ElementPtrType> created;
+		stats.created = SceneSnapshot::load(snapshot_, m_registry, m_root, created);
+		std::copy(created.begin(), created.end(), elements.begin());
+	}
+	else
+	{
+		std::vector<std::uint32_t> const matches = matchNodes(m_contents, m_ids, next, ids);
+
+		std::vector<bool> reused(m_contents.nodes.size(), false);
+		std::vector<Element*> parents(next.nodes.size(), nullptr);
+		std::unordered_set<Element*> reorderedParents;	// Parents with created, moved or reordered children.
+		std::unordered_map<Element*, std::uint32_t> lastReused;	// Parent -> previous node of its last reused child.
+
+		// Preorder, so parent of every node is already in place:
+		for (std::uint32_t i = 0; i < next.nodes.size(); ++i)
+		{
+			Node const & node = next.nodes[i];
+
+			Element::ElementPtrType parentOwner;
+			Element * parent = &m_root;
+			if (node.parent != SceneSnapshot::NoParent)
+			{
+				parentOwner = elements[node.parent].lock();
+				parent = parentOwner.get();
+			}
+
+			auto const attachMode = node.relative ? Element::AttachTransform::SnapToTarget : Element::AttachTransform::KeepAbsolute;
+
+			Element::ElementPtrType element;
+			std::uint32_t const match = matches[i];
+			if (match != NoMatch)
+			{
+				Node const & previousNode = m_contents.nodes[match];
+				if (m_contents.types[previousNode.type] == next.types[node.type])
+					element = m_elements[match].lock();
+
+				if (element)
+				{
+					reused[match] = true;
+
+					if (element->getParent() != parent || previousNode.relative != node.relative)
+					{
+						// Reattach resets the transform, so every field is applied again:
+						Element::ElementPtrType owned = element->getParent() ? element->getParent()->detach(*element) : element;
+						owned->setZIndex(node.zIndex);
+						if (parent)
+							parent->attach(std::move(owned), attachMode, Element::AttachPolicy::Unchecked);
+
+						applyTransform(*element, node);
+						updateProperties(*element, m_contents, previousNode, next, node);
+						reorderedParents.insert(parent);
+						++stats.moved;
+					}
+					else
+					{
+						// Matched out of the previous order:
+						auto const [last, first] = lastReused.try_emplace(parent, match);
+						if (previousNode.zIndex != node.zIndex || (!first && match < last->second))
+							reorderedParents.insert(parent);
+						last->second = match;
+
+						if (updateFields(*element, m_contents, previousNode, next, node))
+							++stats.updated;
+						else
+							++stats.unchanged;
+					}
+				}
+			}
+
+			if (!element && parent)
+			{
+				element = m_registry.create(registryTypes[node.type]);
+				element->setZIndex(node.zIndex);
+				parent->attach(Element::ElementPtrType{ element }, attachMode, Element::AttachPolicy::Unchecked);
+
+				applyTransform(*element, node);
+				applyProperties(*element, next, node);
+				reorderedParents.insert(parent);
+				++stats.created;
+			}
+
+			elements[i] = element;
+			parents[i]	= parent;
+		}
+
+		// Attach places element after its siblings with the same z-index, so restore the order of the description
+		// (as a fresh load would create it). Elements created outside of the description go after the described ones.
+		reorderedParents.erase(nullptr);
+		if (!reorderedParents.empty())
+		{
+			std::unordered_map<Element const*, std::uint32_t> ranks;
+			for (std::uint32_t i = 0; i < next.nodes.size(); ++i)
+			{
+				if (reorderedParents.contains(parents[i]))
+				{
+					if (auto const element = elements[i].lock())
+						ranks.emplace(element.get(), i);
+				}
+			}
+
+			auto const rankOf = [&ranks](Element::ElementPtrType const & element_)
+				{
+					auto const it = ranks.find(element_.get());
+					return it != ranks.end() ? it->second : std::numeric_limits<std::uint32_t>::max();
+				};
+
+			for (Element* const parent : reorderedParents)
+			{
+				std::stable_sort(parent->m_children.begin(), parent->m_children.end(),
+					[&rankOf](Element::ElementPtrType const & lhs_, Element::ElementPtrType const & rhs_)
+					{
+						if (lhs_->getZIndex() != rhs_->getZIndex())
+							return lhs_->getZIndex() < rhs_->getZIndex();
+						return rankOf(lhs_) < rankOf(rhs_);
+					});
+			}
+		}
+
+		// Remove elements of dropped (or replaced) nodes. Reverse preorder removes children first,
+		// so no element outlives its parent while still pointing to it.
+		for (std::size_t i = m_contents.nodes.size(); i-- > 0; )
+		{
+			if (reused[i])
+				continue;
+
+			++stats.removed;
+			if (auto const element = m_elements[i].lock(); element && element->getParent())
+				element->getParent()->remove(*element);
+		}
+	}
+
+	m_snapshot	= std::move(snapshot_);
+	m_contents	= std::move(next);
+	m_ids		= std::move(ids);
+	m_elements	= std::move(elements);
+	m_description.clear();
+	return stats;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SceneReconciler::Stats SceneReconciler::applyDescription(std::string_view const text_)
+{
+	// Same bytes as the last applied description - reuse its compiled snapshot:
+	std::vector<std::byte> snapshot = (!m_description.empty() && text_ == m_description) ? m_snapshot : UiDescription::compile(text_);
+
+	Stats const stats = this->apply(std::move(snapshot));
+	m_description.assign(text_);
+	return stats;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SceneReconciler::Stats SceneReconciler::applyDescriptionFile(std::filesystem::path const & path_)
+{
+	MappedFile const file{ path_ };
+	return this->applyDescription(std::string_view{ reinterpret_cast<char const*>(file.getData().data()), file.getData().size() });
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SharedPtr<Element> SceneReconciler::find(std::string_view const id_) const
+{
+	if (id_.empty())
+		return nullptr;
+
+	auto const it = std::find(m_ids.begin(), m_ids.end(), id_);
+	return it != m_ids.end() ? m_elements[static_cast<std::size_t>(it - m_ids.begin())].lock() : nullptr;
+}
+
+}
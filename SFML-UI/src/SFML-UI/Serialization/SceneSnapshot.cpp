@@ -0,0 +1,463 @@
+#include "SFMLUIPCH.hpp"
+
+#include <SFML-UI/Serialization/SceneSnapshot.hpp>
+#include <SFML-UI/Core/MappedFile.hpp>
+
+#include <cstring>
+#include <fstream>
+
+namespace sfui
+{
+
+namespace
+{
+
+constexpr char			Magic[4]	= { 'S', 'F', 'U', 'S' };
+constexpr std::uint32_t	ByteOrder	= 0x01020304;
+
+// Element record flags:
+constexpr std::uint32_t	RelativeTransformFlag = 1u << 0;
+
+// Every record consists of 4-byte fields, so sections stay aligned.
+
+struct FileHeader
+{
+	char			magic[4];
+	std::uint32_t	byteOrder;
+	std::uint32_t	version;
+	std::uint32_t	typeCount;
+	std::uint32_t	elementCount;
+	std::uint32_t	propertyCount;
+	std::uint32_t	stringTableSize;
+};
+
+struct StringRef
+{
+	std::uint32_t	offset;
+	std::uint32_t	length;
+};
+
+struct ElementRecord
+{
+	std::uint32_t	type;
+	std::uint32_t	parent;				// Index of the parent record, SceneSnapshot::NoParent for top-level elements.
+	std::uint32_t	childCount;
+	std::uint32_t	firstProperty;
+	std::uint32_t	propertyCount;
+	std::int32_t	zIndex;
+	std::uint32_t	flags;
+	float			position[2];
+	float			origin[2];
+	float			scale[2];
+	float			rotation;
+};
+
+struct PropertyRecord
+{
+	StringRef		name;
+	StringRef		value;
+};
+
+//////////////////////////////////////////////////////////////////////////////
+SceneSnapshot::Builder::ElementIndex addElement(SceneSnapshot::Builder & builder_, ElementRegistry const & registry_, Element const & element_, SceneSnapshot::Builder::ElementIndex const parent_)
+{
+	ElementRegistry::TypeIndex const type = registry_.find(element_);
+	if (type == ElementRegistry::InvalidType)
+		throw std::invalid_argument("Element type is not registered.");
+
+	auto const index = builder_.addElement(parent_);
+	builder_.setType(index, registry_.getName(type));
+	builder_.setPosition(index, element_.getPosition());
+	builder_.setOrigin(index, element_.getOrigin());
+	builder_.setScale(index, element_.getScale());
+	builder_.setRotation(index, element_.getRotation());
+	builder_.setZIndex(index, element_.getZIndex());
+	builder_.setRelativeTransform(index, element_.usesRelativeTransform());
+
+	for (auto const & [name, value] : element_.getProperties())
+		builder_.addProperty(index, name, value);
+
+	return index;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+template <typename TRecordType>
+TRecordType readRecord(std::byte const* section_, std::size_t const index_)
+{
+	// Snapshot in memory does not have to be aligned, copying compiles to plain loads anyway.
+	TRecordType record;
+	std::memcpy(&record, section_ + index_ * sizeof(TRecordType), sizeof(TRecordType));
+	return record;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void verify(bool const condition_)
+{
+	if (!condition_)
+		throw std::runtime_error("Scene snapshot is corrupted.");
+}
+
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::vector<std::byte> SceneSnapshot::save(Element const & root_, ElementRegistry const & registry_)
+{
+	struct PendingChild
+	{
+		Element const*			element;
+		Builder::ElementIndex	parent;
+	};
+
+	// Parents are added before their children, in children order. Explicit stack, so deep trees are fine:
+	std::vector<PendingChild> pending;
+	auto const pushChildren = [&pending](Element const & element_, Builder::ElementIndex const index_) {
+		auto const & children = element_.getChildren();
+		for (auto it = children.rbegin(); it != children.rend(); ++it)
+			pending.push_back({ it->get(), index_ });
+	};
+
+	Builder builder;
+	pushChildren(root_, Builder::NoParent);
+	while (!pending.empty())
+	{
+		PendingChild const current = pending.back();
+		pending.pop_back();
+
+		auto const index = addElement(builder, registry_, *current.element, current.parent);
+		pushChildren(*current.element, index);
+	}
+
+	return builder.finish();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void SceneSnapshot::saveToFile(Element const & root_, ElementRegistry const & registry_, std::filesystem::path const & path_)
+{
+	std::vector<std::byte> const snapshot = SceneSnapshot::save(root_, registry_);
+
+	std::ofstream file{ path_, std::ios::binary | std::ios::trunc };
+	if (!file.write(reinterpret_cast<char const*>(snapshot.data()), static_cast<std::streamsize>(snapshot.size())))
+		throw std::runtime_error("Could not write scene snapshot file.");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::size_t SceneSnapshot::load(std::span<std::byte const> const data_, ElementRegistry const & registry_, Element & parent_)
+{
+	std::vector<Element::ElementPtrType> created;
+	return SceneSnapshot::load(data_, registry_, parent_, created);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::size_t SceneSnapshot::load(std::span<std::byte const> const data_, ElementRegistry const & registry_, Element & parent_, std::vector<Element::ElementPtrType> & created_)
+{
+	Contents const contents = SceneSnapshot::decode(data_);
+
+	// Resolve every type once:
+	std::vector<ElementRegistry::TypeIndex> registryTypes(contents.types.size());
+	for (std::size_t i = 0; i < contents.types.size(); ++i)
+	{
+		registryTypes[i] = registry_.find(contents.types[i]);
+		if (registryTypes[i] == ElementRegistry::InvalidType)
+			throw std::runtime_error("Scene snapshot contains element type that is not registered.");
+	}
+
+	// Create elements, linking each one to its (already created) parent:
+	std::vector<Element::ElementPtrType> created(contents.nodes.size());
+	std::vector<std::uint32_t> topLevel;
+	std::vector<Element*> unsortedParents;
+	for (std::uint32_t i = 0; i < contents.nodes.size(); ++i)
+	{
+		Node const & node = contents.nodes[i];
+
+		Element::ElementPtrType element = registry_.create(registryTypes[node.type]);
+		element->setOrigin(node.origin);
+		element->setPosition(node.position);
+		element->setScale(node.scale);
+		element->setRotation(node.rotation);
+		element->m_zIndex					= node.zIndex;
+		element->m_usesRelativeTransform	= node.relative;
+
+		// Properties saved from a tree are in map order, so every insertion goes to the end:
+		for (std::uint32_t p = node.firstProperty; p < node.firstProperty + node.propertyCount; ++p)
+			element->m_properties.emplace_hint(element->m_properties.end(), contents.properties[p].name, contents.properties[p].value);
+
+		element->m_children.reserve(node.childCount);
+
+		// Children saved from a tree are in z-order, appending keeps the order.
+		if (node.parent != NoParent)
+		{
+			Element & parent = *created[node.parent];
+			if (!parent.m_children.empty() && parent.m_children.back()->getZIndex() > node.zIndex
+				&& (unsortedParents.empty() || unsortedParents.back() != &parent))
+				unsortedParents.push_back(&parent);
+
+			element->m_parent = &parent;
+			parent.m_children.push_back(element);
+		}
+		else
+			topLevel.push_back(i);
+
+		created[i] = std::move(element);
+	}
+
+	// Stable, so siblings with equal z-index keep stored order (as with attach):
+	for (Element * const parent : unsortedParents)
+	{
+		std::stable_sort(parent->m_children.begin(), parent->m_children.end(),
+			[](Element::ElementPtrType const & lhs_, Element::ElementPtrType const & rhs_)
+			{
+				return lhs_->getZIndex() < rhs_->getZIndex();
+			});
+	}
+
+	for (std::uint32_t const index : topLevel)
+	{
+		Element::ElementPtrType const & element = created[index];
+		auto const whereToInsert = parent_.findPlaceForNewElement(*element);
+
+		element->m_parent = &parent_;
+		element->invalidateWorldTransform();
+		parent_.m_children.emplace(whereToInsert, element);
+	}
+
+	created_ = std::move(created);
+	return created_.size();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SceneSnapshot::Contents SceneSnapshot::decode(std::span<std::byte const> const data_)
+{
+	verify(data_.size() >= sizeof(FileHeader));
+
+	auto const header = readRecord<FileHeader>(data_.data(), 0);
+	if (std::memcmp(header.magic, Magic, sizeof(Magic)) != 0)
+		throw std::runtime_error("Data is not a scene snapshot.");
+	if (header.byteOrder != ByteOrder)
+		throw std::runtime_error("Scene snapshot was written with different byte order.");
+	if (header.version != Version)
+		throw std::runtime_error("Scene snapshot version is not supported.");
+
+	// Locate sections (in 64 bits, so huge counts cannot wrap around):
+	std::uint64_t const sectionsSize = sizeof(FileHeader)
+		+ std::uint64_t{ header.typeCount } * sizeof(StringRef)
+		+ std::uint64_t{ header.elementCount } * sizeof(ElementRecord)
+		+ std::uint64_t{ header.propertyCount } * sizeof(PropertyRecord)
+		+ header.stringTableSize;
+	verify(sectionsSize == data_.size());
+
+	std::byte const* const types		= data_.data() + sizeof(FileHeader);
+	std::byte const* const elements		= types + std::size_t{ header.typeCount } * sizeof(StringRef);
+	std::byte const* const properties	= elements + std::size_t{ header.elementCount } * sizeof(ElementRecord);
+	std::byte const* const strings		= properties + std::size_t{ header.propertyCount } * sizeof(PropertyRecord);
+
+	auto const toString = [&](StringRef const & ref_) {
+		verify(ref_.offset <= header.stringTableSize && ref_.length <= header.stringTableSize - ref_.offset);
+		return std::string_view{ reinterpret_cast<char const*>(strings) + ref_.offset, ref_.length };
+	};
+
+	Contents contents;
+	contents.types.resize(header.typeCount);
+	for (std::uint32_t i = 0; i < header.typeCount; ++i)
+		contents.types[i] = toString(readRecord<StringRef>(types, i));
+
+	contents.properties.resize(header.propertyCount);
+	for (std::uint32_t i = 0; i < header.propertyCount; ++i)
+	{
+		auto const record = readRecord<PropertyRecord>(properties, i);
+		contents.properties[i] = Property{ toString(record.name), toString(record.value) };
+	}
+
+	contents.nodes.resize(header.elementCount);
+	std::vector<std::uint32_t> childCounts(header.elementCount, 0);
+	for (std::uint32_t i = 0; i < header.elementCount; ++i)
+	{
+		auto const record = readRecord<ElementRecord>(elements, i);
+		verify(record.type < header.typeCount);
+		verify(record.parent == NoParent || record.parent < i);
+		verify(record.firstProperty <= header.propertyCount && record.propertyCount <= header.propertyCount - record.firstProperty);
+
+		Node & node			= contents.nodes[i];
+		node.type			= record.type;
+		node.parent			= record.parent;
+		node.childCount		= record.childCount;
+		node.firstProperty	= record.firstProperty;
+		node.propertyCount	= record.propertyCount;
+		node.zIndex			= record.zIndex;
+		node.relative		= (record.flags & RelativeTransformFlag) != 0;
+		node.position		= { record.position[0], record.position[1] };
+		node.origin			= { record.origin[0], record.origin[1] };
+		node.scale			= { record.scale[0], record.scale[1] };
+		node.rotation		= record.rotation;
+
+		if (record.parent != NoParent)
+			++childCounts[record.parent];
+	}
+
+	// Loading reserves space for children, so stored counts must be exact:
+	for (std::uint32_t i = 0; i < header.elementCount; ++i)
+		verify(contents.nodes[i].childCount == childCounts[i]);
+
+	return contents;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::size_t SceneSnapshot::loadFromFile(std::filesystem::path const & path_, ElementRegistry const & registry_, Element & parent_)
+{
+	MappedFile const file{ path_ };
+	return SceneSnapshot::load(file.getData(), registry_, parent_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SceneSnapshot::Builder::ElementIndex SceneSnapshot::Builder::addElement(ElementIndex const parent_)
+{
+	if (parent_ != NoParent && parent_ >= m_elements.size())
+		throw std::invalid_argument("Parent must be added before its children.");
+
+	PendingElement element;
+	element.parent = parent_;
+	m_elements.push_back(element);
+	return static_cast<ElementIndex>(m_elements.size() - 1);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void SceneSnapshot::Builder::setType(ElementIndex const element_, std::string_view const typeName_)
+{
+	auto it = m_typeIndices.find(typeName_);
+	if (it == m_typeIndices.end())
+	{
+		it = m_typeIndices.emplace(std::string{ typeName_ }, static_cast<std::uint32_t>(m_typeNames.size())).first;
+		m_typeNames.push_back(this->addString(typeName_));
+	}
+	m_elements[element_].type = it->second;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void SceneSnapshot::Builder::setPosition(ElementIndex const element_, sf::Vector2f const & position_)
+{
+	m_elements[element_].position = position_;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void SceneSnapshot::Builder::setOrigin(ElementIndex const element_, sf::Vector2f const & origin_)
+{
+	m_elements[element_].origin = origin_;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void SceneSnapshot::Builder::setScale(ElementIndex const element_, sf::Vector2f const & scale_)
+{
+	m_elements[element_].scale = scale_;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void SceneSnapshot::Builder::setRotation(ElementIndex const element_, float const angle_)
+{
+	m_elements[element_].rotation = angle_;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void SceneSnapshot::Builder::setZIndex(ElementIndex const element_, std::int32_t const zIndex_)
+{
+	m_elements[element_].zIndex = zIndex_;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void SceneSnapshot::Builder::setRelativeTransform(ElementIndex const element_, bool const relative_)
+{
+	m_elements[element_].relative = relative_;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void SceneSnapshot::Builder::addProperty(ElementIndex const element_, std::string_view const name_, std::string_view const value_)
+{
+	m_properties.push_back(PendingProperty{ element_, this->addString(name_), this->addString(value_) });
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::vector<std::byte> SceneSnapshot::Builder::finish() const
+{
+	// Properties of one element must be contiguous (they are, unless added interleaved):
+	std::vector<PendingProperty> properties = m_properties;
+	std::stable_sort(properties.begin(), properties.end(),
+		[](PendingProperty const & lhs_, PendingProperty const & rhs_)
+		{
+			return lhs_.element < rhs_.element;
+		});
+
+	std::vector<ElementRecord> records(m_elements.size());
+	for (std::size_t i = 0; i < m_elements.size(); ++i)
+	{
+		PendingElement const & element = m_elements[i];
+		if (element.type == NoType)
+			throw std::logic_error("Scene snapshot element has no type.");
+
+		ElementRecord & record = records[i];
+		record.type				= element.type;
+		record.parent			= element.parent;
+		record.zIndex			= element.zIndex;
+		record.flags			= element.relative ? RelativeTransformFlag : 0;
+		record.position[0]		= element.position.x;
+		record.position[1]		= element.position.y;
+		record.origin[0]		= element.origin.x;
+		record.origin[1]		= element.origin.y;
+		record.scale[0]			= element.scale.x;
+		record.scale[1]			= element.scale.y;
+		record.rotation			= element.rotation;
+
+		if (element.parent != NoParent)
+			++records[element.parent].childCount;
+	}
+
+	for (std::size_t i = 0; i < properties.size(); ++i)
+	{
+		ElementRecord & record = records[properties[i].element];
+		if (record.propertyCount++ == 0)
+			record.firstProperty = static_cast<std::uint32_t>(i);
+	}
+
+	FileHeader header{};
+	std::memcpy(header.magic, Magic, sizeof(Magic));
+	header.byteOrder		= ByteOrder;
+	header.version			= Version;
+	header.typeCount		= static_cast<std::uint32_t>(m_typeNames.size());
+	header.elementCount		= static_cast<std::uint32_t>(records.size());
+	header.propertyCount	= static_cast<std::uint32_t>(properties.size());
+	header.stringTableSize	= static_cast<std::uint32_t>(m_strings.size());
+
+	std::vector<std::byte> output;
+	output.reserve(sizeof(FileHeader)
+		+ m_typeNames.size() * sizeof(StringRef)
+		+ records.size() * sizeof(ElementRecord)
+		+ properties.size() * sizeof(PropertyRecord)
+		+ m_strings.size());
+
+	auto const append = [&output](void const* data_, std::size_t const size_) {
+		auto const bytes = static_cast<std::byte const*>(data_);
+		output.insert(output.end(), bytes, bytes + size_);
+	};
+	append(&header, sizeof(header));
+	append(m_typeNames.data(), m_typeNames.size() * sizeof(StringRef));
+	append(records.data(), records.size() * sizeof(ElementRecord));
+	for (PendingProperty const & property : properties)
+	{
+		PropertyRecord const record{ { property.name.offset, property.name.length }, { property.value.offset, property.value.length } };
+		append(&record, sizeof(record));
+	}
+	append(m_strings.data(), m_strings.size());
+	return output;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SceneSnapshot::Builder::StringRef SceneSnapshot::Builder::addString(std::string_view const string_)
+{
+	// Property names repeat a lot, store every distinct string once:
+	auto it = m_stringOffsets.find(string_);
+	if (it == m_stringOffsets.end())
+	{
+		it = m_stringOffsets.emplace(std::string{ string_ }, static_cast<std::uint32_t>(m_strings.size())).first;
+		m_strings.insert(m_strings.end(), string_.begin(), string_.end());
+	}
+	return StringRef{ it->second, static_cast<std::uint32_t>(string_.size()) };
+}
+
+}
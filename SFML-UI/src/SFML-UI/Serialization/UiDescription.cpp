@@ -0,0 +1,287 @@
+#include "SFMLUIPCH.hpp"
+
+#include <SFML-UI/Serialization/UiDescription.hpp>
+#include <SFML-UI/Serialization/JsonReader.hpp>
+#include <SFML-UI/Core/MappedFile.hpp>
+
+#include <charconv>
+#include <cstring>
+#include <fstream>
+
+namespace sfui
+{
+
+namespace
+{
+
+using Token			= JsonReader::Token;
+using ElementIndex	= SceneSnapshot::Builder::ElementIndex;
+
+//////////////////////////////////////////////////////////////////////////////
+std::uint64_t hashContents(std::string_view const text_)
+{
+	// Multiply-xorshift over 8-byte words (cache keys need speed, not cryptographic strength).
+	// Seeded with snapshot version, so format changes invalidate the cache.
+	auto const mix = [](std::uint64_t hash_, std::uint64_t const word_) {
+		hash_ = (hash_ ^ word_) * 0x9E3779B97F4A7C15ull;
+		return hash_ ^ (hash_ >> 32);
+	};
+
+	std::uint64_t hash = mix(0xCBF29CE484222325ull, SceneSnapshot::Version);
+
+	std::size_t position = 0;
+	for (; position + 8 <= text_.size(); position += 8)
+	{
+		std::uint64_t word;
+		std::memcpy(&word, text_.data() + position, sizeof(word));
+		hash = mix(hash, word);
+	}
+
+	std::uint64_t tail = 0;
+	if (position < text_.size())
+		std::memcpy(&tail, text_.data() + position, text_.size() - position);
+	hash = mix(hash, tail ^ (std::uint64_t{ text_.size() } << 56));
+
+	// Finalize with the SplitMix64 output function:
+	hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ull;
+	hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBull;
+	return hash ^ (hash >> 31);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void expect(JsonReader & reader_, Token const actual_, Token const expected_, char const* message_)
+{
+	if (actual_ != expected_)
+		reader_.fail(message_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+float readFloat(JsonReader & reader_, Token const token_)
+{
+	expect(reader_, token_, Token::Number, "Expected number");
+	return static_cast<float>(reader_.getNumber());
+}
+
+//////////////////////////////////////////////////////////////////////////////
+sf::Vector2f readVector(JsonReader & reader_, Token const token_, bool const allowScalar_)
+{
+	if (allowScalar_ && token_ == Token::Number)
+	{
+		auto const value = static_cast<float>(reader_.getNumber());
+		return { value, value };
+	}
+
+	expect(reader_, token_, Token::BeginArray, allowScalar_ ? "Expected [x, y] or number" : "Expected [x, y]");
+	sf::Vector2f vector;
+	vector.x = readFloat(reader_, reader_.next());
+	vector.y = readFloat(reader_, reader_.next());
+	expect(reader_, reader_.next(), Token::EndArray, "Expected ']' after two components");
+	return vector;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void readProperties(JsonReader & reader_, Token const token_, SceneSnapshot::Builder & builder_, ElementIndex const element_)
+{
+	expect(reader_, token_, Token::BeginObject, "Expected object of properties");
+
+	std::string name;
+	for (Token token = reader_.next(); token != Token::EndObject; token = reader_.next())
+	{
+		name.assign(reader_.getString());
+
+		switch (token = reader_.next())
+		{
+		case Token::String:
+		{
+			builder_.addProperty(element_, name, reader_.getString());
+			break;
+		}
+		case Token::Number:
+		{
+			char buffer[32];
+			auto const result = std::to_chars(buffer, buffer + sizeof(buffer), reader_.getNumber());
+			builder_.addProperty(element_, name, std::string_view{ buffer, static_cast<std::size_t>(result.ptr - buffer) });
+			break;
+		}
+		case Token::Boolean:
+		{
+			builder_.addProperty(element_, name, reader_.getBoolean() ? "true" : "false");
+			break;
+		}
+		default:
+			reader_.fail("Property value must be string, number or boolean");
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void readElement(JsonReader & reader_, Token const token_, SceneSnapshot::Builder & builder_, ElementIndex const parent_)
+{
+	// Element object being read:
+	struct OpenElement
+	{
+		ElementIndex	element;
+		bool			hasType;
+		bool			inChildren;		// Whether the reader is inside its "children" array.
+	};
+
+	// Explicit stack of nested elements, so deeply nested input does not overflow the call stack:
+	std::vector<OpenElement> open;
+	auto const beginElement = [&](Token const elementToken_, ElementIndex const elementParent_) {
+		expect(reader_, elementToken_, Token::BeginObject, "Expected element object");
+		open.push_back({ builder_.addElement(elementParent_), false, false });
+	};
+
+	beginElement(token_, parent_);
+	while (!open.empty())
+	{
+		Token token = reader_.next();
+		OpenElement & current = open.back();
+
+		if (current.inChildren)
+		{
+			if (token == Token::EndArray)
+				current.inChildren = false;
+			else
+				beginElement(token, current.element);
+			continue;
+		}
+
+		if (token == Token::EndObject)
+		{
+			if (!current.hasType)
+				reader_.fail("Element has no type");
+			open.pop_back();
+			continue;
+		}
+
+		ElementIndex const element = current.element;
+		std::string_view const key = reader_.getString();
+		token = reader_.next();
+
+		if (key == "type")
+		{
+			expect(reader_, token, Token::String, "Element type must be a string");
+			builder_.setType(element, reader_.getString());
+			current.hasType = true;
+		}
+		else if (key == "position")
+			builder_.setPosition(element, readVector(reader_, token, false));
+		else if (key == "origin")
+			builder_.setOrigin(element, readVector(reader_, token, false));
+		else if (key == "scale")
+			builder_.setScale(element, readVector(reader_, token, true));
+		else if (key == "rotation")
+			builder_.setRotation(element, readFloat(reader_, token));
+		else if (key == "zIndex")
+		{
+			expect(reader_, token, Token::Number, "Expected number");
+			double const zIndex = reader_.getNumber();
+			if (zIndex != std::floor(zIndex) || zIndex < std::numeric_limits<std::int32_t>::min() || zIndex > std::numeric_limits<std::int32_t>::max())
+				reader_.fail("Z index must be a 32-bit integer");
+			builder_.setZIndex(element, static_cast<std::int32_t>(zIndex));
+		}
+		else if (key == "relative")
+		{
+			expect(reader_, token, Token::Boolean, "Expected boolean");
+			builder_.setRelativeTransform(element, reader_.getBoolean());
+		}
+		else if (key == "properties")
+			readProperties(reader_, token, builder_, element);
+		else if (key == "children")
+		{
+			expect(reader_, token, Token::BeginArray, "Expected array of child elements");
+			current.inChildren = true;
+		}
+		else
+			reader_.skip(token);
+	}
+}
+
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::vector<std::byte> UiDescription::compile(std::string_view const text_)
+{
+	JsonReader reader{ text_ };
+	SceneSnapshot::Builder builder;
+
+	Token const token = reader.next();
+	if (token == Token::BeginArray)
+	{
+		for (Token element = reader.next(); element != Token::EndArray; element = reader.next())
+			readElement(reader, element, builder, SceneSnapshot::Builder::NoParent);
+	}
+	else
+		readElement(reader, token, builder, SceneSnapshot::Builder::NoParent);
+
+	expect(reader, reader.next(), Token::End, "Unexpected data after the document");
+	return builder.finish();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::size_t UiDescription::load(std::string_view const text_, ElementRegistry const & registry_, Element & parent_)
+{
+	return SceneSnapshot::load(UiDescription::compile(text_), registry_, parent_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::size_t UiDescription::loadFromFile(std::filesystem::path const & path_, ElementRegistry const & registry_, Element & parent_,
+	std::filesystem::path const & cacheDirectory_)
+{
+	MappedFile const file{ path_ };
+	std::string_view const text{ reinterpret_cast<char const*>(file.getData().data()), file.getData().size() };
+
+	if (cacheDirectory_.empty())
+		return UiDescription::load(text, registry_, parent_);
+
+	std::filesystem::path const cachePath = UiDescription::getCachePath(text, cacheDirectory_);
+
+	std::error_code error;
+	if (std::filesystem::exists(cachePath, error))
+	{
+		try
+		{
+			return SceneSnapshot::loadFromFile(cachePath, registry_, parent_);
+		}
+		catch (std::runtime_error const &)
+		{
+			// Damaged cache entry, or type missing from the registry - recompile below (reports a proper error if it persists).
+		}
+	}
+
+	std::vector<std::byte> const snapshot = UiDescription::compile(text);
+
+	// Write to temporary file first, so readers never see partial entries:
+	std::filesystem::create_directories(cacheDirectory_, error);
+
+	std::filesystem::path temporaryPath = cachePath;
+	temporaryPath += ".tmp";
+	{
+		std::ofstream cacheFile{ temporaryPath, std::ios::binary | std::ios::trunc };
+		cacheFile.write(reinterpret_cast<char const*>(snapshot.data()), static_cast<std::streamsize>(snapshot.size()));
+		error = cacheFile ? std::error_code{} : std::make_error_code(std::errc::io_error);
+	}
+	if (!error)
+		std::filesystem::rename(temporaryPath, cachePath, error);
+	if (error)
+		std::filesystem::remove(temporaryPath, error);
+
+	return SceneSnapshot::load(snapshot, registry_, parent_);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::filesystem::path UiDescription::getCachePath(std::string_view const text_, std::filesystem::path const & cacheDirectory_)
+{
+	char name[16];
+	auto const result = std::to_chars(name, name + sizeof(name), hashContents(text_), 16);
+
+	// Zero-padded, so names have constant length:
+	std::string fileName(sizeof(name) - static_cast<std::size_t>(result.ptr - name), '0');
+	fileName.append(name, result.ptr);
+	fileName += ".sfus";
+
+	return cacheDirectory_ / fileName;
+}
+
+}
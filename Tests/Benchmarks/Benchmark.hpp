@@ -0,0 +1,77 @@
+// File description:
+// Implements minimal benchmark registry and timing helpers.
+#pragma once
+
+#include "BenchmarksPCH.hpp"
+
+namespace benchmarks
+{
+
+/// <summary>
+/// Registered benchmark.
+/// </summary>
+struct BenchmarkCase
+{
+	char const*	name;
+	void		(*function)();
+};
+
+/// <summary>
+/// Returns every registered benchmark.
+/// </summary>
+/// <returns>Reference to the benchmark list.</returns>
+std::vector<BenchmarkCase>& getBenchmarks();
+
+/// <summary>
+/// Adds benchmark to the list during static initialization (see <see cref="SFMLUI_BENCHMARK"/>).
+/// </summary>
+struct BenchmarkRegistrar
+{
+	BenchmarkRegistrar(char const* name_, void (*function_)()) {
+		getBenchmarks().push_back({ name_, function_ });
+	}
+};
+
+/// <summary>
+/// Keeps the value observable, so the compiler cannot remove the computation producing it.
+/// </summary>
+/// <param name="value_">The value.</param>
+template <typename TType>
+inline void keep(TType const & value_)
+{
+	static TType volatile sink;
+	sink = value_;
+	static_cast<void>(sink);
+}
+
+/// <summary>
+/// Runs the function repeatedly and prints the best time.
+/// </summary>
+/// <param name="label_">The label printed with the result.</param>
+/// <param name="repeats_">Number of runs, the fastest one is reported.</param>
+/// <param name="function_">The measured function.</param>
+/// <returns>The best time (in milliseconds).</returns>
+template <typename TFunction>
+double measure(char const* label_, int const repeats_, TFunction && function_)
+{
+	using Clock = std::chrono::steady_clock;
+
+	double best = std::numeric_limits<double>::max();
+	for (int i = 0; i < repeats_; ++i)
+	{
+		auto const start = Clock::now();
+		function_();
+		best = std::min(best, std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+	}
+
+	std::printf("  %-40s %10.3f ms\n", label_, best);
+	return best;
+}
+
+} // namespace benchmarks
+
+// Defines and registers a benchmark:
+#define SFMLUI_BENCHMARK(name_) \
+	static void name_(); \
+	static benchmarks::BenchmarkRegistrar const name_##Registrar{ #name_, &name_ }; \
+	static void name_()
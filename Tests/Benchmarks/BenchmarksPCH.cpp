@@ -0,0 +1 @@
+#include "BenchmarksPCH.hpp"
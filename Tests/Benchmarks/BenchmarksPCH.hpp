@@ -0,0 +1,10 @@
+#pragma once
+
+#include <SFML-UI/Everything.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <set>
+#include <string>
+#include <vector>
@@ -0,0 +1,92 @@
+#include "BenchmarksPCH.hpp"
+
+#include "Benchmark.hpp"
+
+#include <SFML-UI/Core/Math/Random.hpp>
+
+// Precise versus fast math policy, 1M calls per measurement.
+
+namespace
+{
+
+constexpr std::size_t	Count	= 1'000'000;
+constexpr int			Repeats	= 10;
+
+//////////////////////////////////////////////////////////////////////////////
+std::vector<float> makeValues(float const from_, float const to_)
+{
+	std::vector<float> values(Count);
+	math::random::Pcg32 engine{ 42 };
+	math::random::Uniform<float> const uniform{ from_, to_ };
+	for (auto & value : values)
+		value = uniform(engine);
+	return values;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::vector<math::Vector2f> makeVectors()
+{
+	auto const x = makeValues(-100.f, 100.f);
+	auto const y = makeValues(1.f, 100.f);
+
+	std::vector<math::Vector2f> vectors(Count);
+	for (std::size_t i = 0; i < Count; ++i)
+		vectors[i] = { x[i], y[(i * 7) % Count] };
+	return vectors;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Measures function_ applied to every input, storing results so the loop can be vectorized like real batch code.
+template <typename TInput, typename TFunction>
+void measureEach(char const* label_, std::vector<TInput> const & inputs_, std::vector<float> & outputs_, TFunction && function_)
+{
+	benchmarks::measure(label_, Repeats, [&]
+		{
+			TInput const* const inputs	= inputs_.data();
+			float* const outputs		= outputs_.data();
+			for (std::size_t i = 0; i < Count; ++i)
+				outputs[i] = function_(inputs[i]);
+			benchmarks::keep(outputs[Count / 2]);
+		});
+}
+
+//////////////////////////////////////////////////////////////////////////////
+template <typename TPolicy>
+void measurePolicy(char const* policyName_, std::vector<math::Vector2f> const & vectors_, std::vector<float> const & angles_, std::vector<float> const & positive_, std::vector<float> & outputs_)
+{
+	auto const label = [&](char const* function_) {
+		return std::string{ function_ } + ", " + policyName_;
+	};
+
+	measureEach(label("Vector2::length").c_str(), vectors_, outputs_, [](math::Vector2f const & vector_) {
+			return vector_.length(TPolicy{});
+		});
+	measureEach(label("Vector2::normalize").c_str(), vectors_, outputs_, [](math::Vector2f const & vector_) {
+			return vector_.normalize(TPolicy{}).x;
+		});
+	measureEach(label("sinCos").c_str(), angles_, outputs_, [](float const angle_) {
+			float sine, cosine;
+			TPolicy::sinCos(angle_, sine, cosine);
+			return sine + cosine;
+		});
+	measureEach(label("atan2").c_str(), vectors_, outputs_, [](math::Vector2f const & vector_) {
+			return TPolicy::atan2(vector_.y, vector_.x);
+		});
+	measureEach(label("inverseSqrt").c_str(), positive_, outputs_, [](float const value_) {
+			return TPolicy::inverseSqrt(value_);
+		});
+}
+
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_BENCHMARK(fastMathPolicies)
+{
+	auto const vectors	= makeVectors();
+	auto const angles	= makeValues(-10.f, 10.f);
+	auto const positive	= makeValues(1e-3f, 1e3f);
+	std::vector<float> outputs(Count);
+
+	measurePolicy<math::PreciseMath>("precise", vectors, angles, positive, outputs);
+	measurePolicy<math::FastMath>("fast", vectors, angles, positive, outputs);
+}
@@ -0,0 +1,31 @@
+#include "BenchmarksPCH.hpp"
+
+#include "Benchmark.hpp"
+
+namespace benchmarks
+{
+
+//////////////////////////////////////////////////////////////////////////////
+std::vector<BenchmarkCase>& getBenchmarks()
+{
+	static std::vector<BenchmarkCase> benchmarks;
+	return benchmarks;
+}
+
+}
+
+// Runs every benchmark whose name contains the first argument (or all of them).
+// Build in Release configuration, debug timings are meaningless.
+int main(int argc_, char* argv_[])
+{
+	std::string const filter = argc_ > 1 ? argv_[1] : "";
+
+	for (auto const & benchmark : benchmarks::getBenchmarks())
+	{
+		if (std::string{ benchmark.name }.find(filter) == std::string::npos)
+			continue;
+
+		std::printf("%s\n", benchmark.name);
+		benchmark.function();
+	}
+}
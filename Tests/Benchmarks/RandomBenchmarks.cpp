@@ -0,0 +1,105 @@
+#include "BenchmarksPCH.hpp"
+
+#include "Benchmark.hpp"
+
+#include <SFML-UI/Core/Math/Random.hpp>
+
+#include <random>
+
+// math::random against the previous backend: thread_local std::mt19937 with a new distribution per call.
+
+namespace
+{
+
+constexpr std::size_t	Count	= 10'000'000;
+constexpr int			Repeats	= 5;
+
+//////////////////////////////////////////////////////////////////////////////
+std::mt19937& mersenneTwister()
+{
+	thread_local std::mt19937 engine{ std::random_device{}() };
+	return engine;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+template <typename TType>
+TType generateMersenneTwister(TType const from_, TType const to_)
+{
+	if constexpr (std::is_integral_v<TType>)
+		return std::uniform_int_distribution<TType>{ from_, to_ }(mersenneTwister());
+	else
+		return std::uniform_real_distribution<TType>{ from_, to_ }(mersenneTwister());
+}
+
+//////////////////////////////////////////////////////////////////////////////
+template <typename TType>
+void measureGenerators(TType const from_, TType const to_)
+{
+	benchmarks::measure("std::mt19937, distribution per call", Repeats, [&]
+		{
+			TType sum{};
+			for (std::size_t i = 0; i < Count; ++i)
+				sum += generateMersenneTwister(from_, to_);
+			benchmarks::keep(sum);
+		});
+	benchmarks::measure("math::random::generate", Repeats, [&]
+		{
+			TType sum{};
+			for (std::size_t i = 0; i < Count; ++i)
+				sum += math::random::generate(from_, to_);
+			benchmarks::keep(sum);
+		});
+	benchmarks::measure("Uniform, reused with thread engine", Repeats, [&]
+		{
+			math::random::Uniform<TType> const uniform{ from_, to_ };
+			auto & engine = math::random::threadEngine();
+
+			TType sum{};
+			for (std::size_t i = 0; i < Count; ++i)
+				sum += uniform(engine);
+			benchmarks::keep(sum);
+		});
+	benchmarks::measure("Uniform, reused with Pcg32", Repeats, [&]
+		{
+			math::random::Uniform<TType> const uniform{ from_, to_ };
+			auto & engine = math::random::threadEngine<math::random::Pcg32>();
+
+			TType sum{};
+			for (std::size_t i = 0; i < Count; ++i)
+				sum += uniform(engine);
+			benchmarks::keep(sum);
+		});
+}
+
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_BENCHMARK(randomIntegers)
+{
+	std::printf("  10M int values in [0, 99]:\n");
+	measureGenerators(0, 99);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_BENCHMARK(randomFloats)
+{
+	std::printf("  10M float values in [0, 1):\n");
+	measureGenerators(0.f, 1.f);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_BENCHMARK(randomStreamCreation)
+{
+	// Cost of creating the engine of a new thread, which does not depend on the stream index:
+	for (std::uint64_t const stream : { 1ull, 1'000ull, 1'000'000ull })
+	{
+		std::string const label = "1000 x forStream(seed, " + std::to_string(stream) + ")";
+		benchmarks::measure(label.c_str(), Repeats, [&]
+			{
+				std::uint64_t sum = 0;
+				for (std::uint64_t seed = 0; seed < 1'000; ++seed)
+					sum += math::random::Xoshiro256PlusPlus::forStream(seed, stream)();
+				benchmarks::keep(sum);
+			});
+	}
+}
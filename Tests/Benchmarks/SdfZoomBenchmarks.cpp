@@ -0,0 +1,163 @@
+#include "BenchmarksPCH.hpp"
+
+#include "Benchmark.hpp"
+
+#include <SFML/OpenGL.hpp>
+
+namespace
+{
+
+// Fonts tried in order (relative to the working directory first). The benchmark is skipped when none of them loads.
+constexpr char const* FontPaths[] = { "Font.ttf", "C:/Windows/Fonts/arial.ttf" };
+
+constexpr unsigned		TargetWidth		= 1280;
+constexpr unsigned		TargetHeight	= 720;
+constexpr std::size_t	LineCount		= 24;
+constexpr float			BaseSize		= 16.f;
+constexpr int			FrameCount		= 240;		// Frames of one sweep - zoom goes from MinZoom to MaxZoom and back.
+constexpr float			MinZoom			= 0.5f;
+constexpr float			MaxZoom			= 6.f;
+
+constexpr char const* SampleText = "The quick brown fox jumps over the lazy dog 0123456789";
+
+//////////////////////////////////////////////////////////////////////////////
+bool loadFont(sf::Font & font_)
+{
+	for (auto const path : FontPaths)
+		if (font_.loadFromFile(path))
+			return true;
+	return false;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+float zoomAt(int const frame_)
+{
+	// Exponential zoom, so every zoom step changes the size by the same ratio:
+	float const t		= static_cast<float>(frame_) / static_cast<float>(FrameCount - 1);
+	float const phase	= 1.f - std::abs(2.f * t - 1.f);
+	return MinZoom * std::pow(MaxZoom / MinZoom, phase);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+float lineY(std::size_t const line_, float const zoom_)
+{
+	return static_cast<float>(line_) * BaseSize * 1.25f * zoom_;
+}
+
+/// <summary>
+/// Draws one zoom sweep and prints the average and the worst frame time.
+/// </summary>
+/// <remarks>
+/// <para>Every frame waits for the GPU (glFinish), so texture uploads and read backs are included in the frame time.</para>
+/// </remarks>
+template <typename TDrawFrame>
+void sweep(std::string const & label_, sf::RenderTexture & target_, TDrawFrame && drawFrame_)
+{
+	using Clock = std::chrono::steady_clock;
+
+	double total = 0.0, worst = 0.0;
+	for (int frame = 0; frame < FrameCount; ++frame)
+	{
+		auto const start = Clock::now();
+
+		target_.clear();
+		drawFrame_(zoomAt(frame));
+		target_.display();
+		glFinish();
+
+		double const time = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+		total += time;
+		worst = std::max(worst, time);
+	}
+
+	std::printf("  %-40s %10.3f ms\n", (label_ + " (average frame)").c_str(), total / FrameCount);
+	std::printf("  %-40s %10.3f ms\n", (label_ + " (worst frame)").c_str(), worst);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+void printMemory(std::string const & label_, std::size_t const bytes_)
+{
+	std::printf("  %-40s %10.3f MB\n", (label_ + " (texture memory)").c_str(), static_cast<double>(bytes_) / (1024.0 * 1024.0));
+}
+
+}
+
+// Canvas zoom sweep: sf::Text rasterizes a new glyph page for every character size, one SDF atlas serves all of them.
+// Sweep runs twice - the second one shows the steady state, with every size already rasterized (sf::Text) or generated (SDF).
+SFMLUI_BENCHMARK(SdfZoomSweep)
+{
+	sf::RenderTexture target;
+	if (!target.create(TargetWidth, TargetHeight))
+	{
+		std::printf("  skipped - could not create render texture\n");
+		return;
+	}
+
+	// sf::Text, one character size per zoom level:
+	{
+		sf::Font font;
+		if (!loadFont(font))
+		{
+			std::printf("  skipped - could not load font\n");
+			return;
+		}
+
+		std::vector<sf::Text> lines(LineCount, sf::Text{ SampleText, font });
+		std::set<unsigned> usedSizes;
+
+		auto const drawFrame = [&](float const zoom_)
+		{
+			unsigned const size = static_cast<unsigned>(std::lround(BaseSize * zoom_));
+			usedSizes.insert(size);
+
+			for (std::size_t i = 0; i < lines.size(); ++i)
+			{
+				lines[i].setCharacterSize(size);
+				lines[i].setPosition(0.f, lineY(i, zoom_));
+				target.draw(lines[i]);
+			}
+		};
+
+		sweep("sf::Text, first sweep", target, drawFrame);
+		sweep("sf::Text, second sweep", target, drawFrame);
+
+		std::size_t bytes = 0;
+		for (auto const size : usedSizes)
+		{
+			auto const textureSize = font.getTexture(size).getSize();
+			bytes += static_cast<std::size_t>(textureSize.x) * textureSize.y * 4;
+		}
+		printMemory("sf::Text", bytes);
+	}
+
+	// SdfLabel, one atlas for every zoom level:
+	{
+		sf::Font font;
+		if (!loadFont(font))
+			return;
+
+		sfui::SdfGlyphAtlas atlas{ font };
+		sfui::Element scene;
+
+		std::vector<sfui::SdfLabel*> lines;
+		for (std::size_t i = 0; i < LineCount; ++i)
+			lines.push_back( &scene.spawn<sfui::SdfLabel>(atlas, BaseSize, SampleText) );
+
+		auto const drawFrame = [&](float const zoom_)
+		{
+			atlas.update();
+
+			for (std::size_t i = 0; i < lines.size(); ++i)
+			{
+				lines[i]->setCharacterSize(BaseSize * zoom_);
+				lines[i]->setPosition(0.f, lineY(i, zoom_));
+			}
+			target.draw(scene);
+		};
+
+		sweep("SdfLabel, first sweep", target, drawFrame);
+		sweep("SdfLabel, second sweep", target, drawFrame);
+
+		printMemory("SdfLabel", atlas.getMemoryUsage());
+	}
+}
@@ -0,0 +1,105 @@
+#include "UnitTestsPCH.hpp"
+
+#include "Test.hpp"
+
+#include <SFML-UI/ElementTraversal.hpp>
+
+namespace
+{
+
+//////////////////////////////////////////////////////////////////////////////
+// Builds the tree:
+//	root
+//	├── a
+//	│   ├── a1
+//	│   └── a2
+//	├── b
+//	│   └── b1
+//	└── c
+std::shared_ptr<sfui::Element> makeTree()
+{
+	auto root = std::make_shared<sfui::Element>();
+	root->setProperty("name", "root");
+
+	auto & a = root->spawn<sfui::Element>();
+	a.setProperty("name", "a");
+	a.spawn<sfui::Element>().setProperty("name", "a1");
+	a.spawn<sfui::Element>().setProperty("name", "a2");
+
+	auto & b = root->spawn<sfui::Element>();
+	b.setProperty("name", "b");
+	b.spawn<sfui::Element>().setProperty("name", "b1");
+
+	root->spawn<sfui::Element>().setProperty("name", "c");
+	return root;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+std::string nameOf(sfui::Element const & element_)
+{
+	return element_.getProperties().at("name");
+}
+
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TEST(preorderVisitsParentsFirst)
+{
+	auto const root = makeTree();
+
+	std::string visited;
+	for (auto const & element : sfui::preorder(*root))
+		visited += nameOf(element) + " ";
+	SFMLUI_CHECK(visited == "root a a1 a2 b b1 c ");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TEST(postorderVisitsChildrenFirst)
+{
+	auto const root = makeTree();
+
+	std::string visited;
+	for (auto const & element : sfui::postorder(static_cast<sfui::Element const &>(*root)))
+		visited += nameOf(element) + " ";
+	SFMLUI_CHECK(visited == "a1 a2 a b1 b c root ");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TEST(preorderSkipsChildrenOfSkippedElement)
+{
+	auto const root = makeTree();
+	auto const range = sfui::preorder(*root);
+
+	std::string visited;
+	for (auto it = range.begin(); it != range.end(); ++it)
+	{
+		visited += nameOf(*it) + " ";
+		if (nameOf(*it) == "a")
+			it.skipChildren();
+	}
+	// Siblings of the skipped subtree and their children are still visited:
+	SFMLUI_CHECK(visited == "root a b b1 c ");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TEST(preorderSkipsChildrenOfLeafAndRoot)
+{
+	auto const root = makeTree();
+	auto const range = sfui::preorder(*root);
+
+	// Skipping a leaf changes nothing:
+	std::string visited;
+	for (auto it = range.begin(); it != range.end(); ++it)
+	{
+		visited += nameOf(*it) + " ";
+		if (nameOf(*it) == "a1")
+			it.skipChildren();
+	}
+	SFMLUI_CHECK(visited == "root a a1 a2 b b1 c ");
+
+	// Skipping the root ends the walk:
+	auto it = range.begin();
+	it.skipChildren();
+	++it;
+	SFMLUI_CHECK(it == range.end());
+}
@@ -0,0 +1,156 @@
+#include "UnitTestsPCH.hpp"
+
+#include "Test.hpp"
+
+#include <SFML-UI/Core/Transform.hpp>
+
+// Dense sweeps enforcing the error bounds documented in FastMath.hpp.
+
+namespace
+{
+
+//////////////////////////////////////////////////////////////////////////////
+// Calls function_ for count_ evenly spaced float values in [from_, to_].
+template <typename TFunction>
+void sweep(float const from_, float const to_, std::size_t const count_, TFunction && function_)
+{
+	double const step = (static_cast<double>(to_) - from_) / static_cast<double>(count_ - 1);
+	for (std::size_t i = 0; i < count_; ++i)
+		function_(static_cast<float>(from_ + step * static_cast<double>(i)));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Calls function_ for every n-th positive normal float in [from_, to_], covering all exponents evenly.
+template <typename TFunction>
+void sweepBits(float const from_, float const to_, std::uint32_t const stride_, TFunction && function_)
+{
+	for (std::uint32_t bits = std::bit_cast<std::uint32_t>(from_); bits <= std::bit_cast<std::uint32_t>(to_); bits += stride_)
+		function_(std::bit_cast<float>(bits));
+}
+
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TEST(fastInverseSqrtRelativeError)
+{
+	double maxError = 0;
+	sweepBits(1e-30f, 1e30f, 97, [&](float const value_)
+		{
+			double const expected = 1.0 / std::sqrt(static_cast<double>(value_));
+			maxError = std::max(maxError, std::abs(math::fast_math::inverseSqrt(value_) - expected) / expected);
+		});
+	SFMLUI_CHECK(maxError <= 5e-6);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TEST(fastSqrtRelativeError)
+{
+	double maxError = 0;
+	sweepBits(1e-30f, 1e30f, 97, [&](float const value_)
+		{
+			double const expected = std::sqrt(static_cast<double>(value_));
+			maxError = std::max(maxError, std::abs(math::fast_math::sqrt(value_) - expected) / expected);
+		});
+	SFMLUI_CHECK(maxError <= 5e-6);
+	SFMLUI_CHECK(math::fast_math::sqrt(0.f) == 0.f);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TEST(fastSinCosAbsoluteError)
+{
+	double maxError = 0;
+	auto const check = [&](float const radians_)
+		{
+			float sine, cosine;
+			math::fast_math::sinCos(radians_, sine, cosine);
+			maxError = std::max(maxError, std::abs(sine - std::sin(static_cast<double>(radians_))));
+			maxError = std::max(maxError, std::abs(cosine - std::cos(static_cast<double>(radians_))));
+		};
+
+	sweep(-7.f, 7.f, 1'000'000, check);
+	sweep(-1e4f, 1e4f, 4'000'000, check);
+	SFMLUI_CHECK(maxError <= 1e-7);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TEST(fastAtan2AbsoluteError)
+{
+	double maxError = 0;
+	for (float const radius : { 1e-3f, 1.f, 1e3f })
+	{
+		sweep(-3.2f, 3.2f, 1'000'000, [&](float const angle_)
+			{
+				float const y = radius * std::sin(angle_);
+				float const x = radius * std::cos(angle_);
+				maxError = std::max(maxError, std::abs(math::fast_math::atan2(y, x) - std::atan2(static_cast<double>(y), static_cast<double>(x))));
+			});
+	}
+	SFMLUI_CHECK(maxError <= 2e-6);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TEST(fastAtan2MatchesStdOnAxesAndSignedZeros)
+{
+	float const values[] = { 0.f, -0.f, 1.f, -1.f, 1e-30f };
+	for (float const y : values)
+	{
+		for (float const x : values)
+		{
+			float const precise	= math::PreciseMath::atan2(y, x);
+			float const fast	= math::FastMath::atan2(y, x);
+			SFMLUI_CHECK_NEAR(fast, precise, 2e-6);
+			SFMLUI_CHECK(std::signbit(fast) == std::signbit(precise));
+		}
+	}
+	SFMLUI_CHECK_NEAR(math::fast_math::atan2(0.f, -0.f), math::constants::Pi<float>, 2e-6);
+	SFMLUI_CHECK_NEAR(math::fast_math::atan2(-0.f, -0.f), -math::constants::Pi<float>, 2e-6);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TEST(fastDecomposeMatchesPrecise)
+{
+	double maxRotationError = 0;
+	sweep(0.f, 359.99f, 100'000, [&](float const degrees_)
+		{
+			sf::Transformable transformable;
+			transformable.setRotation(degrees_);
+			transformable.setScale(1.5f, -0.25f);
+
+			auto const precise	= sfui::transform_algorithm::decompose(transformable.getTransform());
+			auto const fast		= sfui::transform_algorithm::decompose(transformable.getTransform(), math::Fast);
+
+			double const difference = std::abs(fast.rotation - precise.rotation);
+			maxRotationError = std::max(maxRotationError, std::min(difference, 360.0 - difference));
+			SFMLUI_CHECK_NEAR(fast.scale.x, precise.scale.x, 5e-6 * std::abs(precise.scale.x));
+			SFMLUI_CHECK_NEAR(fast.scale.y, precise.scale.y, 5e-6 * std::abs(precise.scale.y));
+		});
+	SFMLUI_CHECK(maxRotationError <= 2e-4);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TEST(batchDecomposeMatchesScalar)
+{
+	std::vector<sf::Transform> transforms;
+	sweep(0.f, 359.99f, 1'001, [&](float const degrees_)
+		{
+			sf::Transformable transformable;
+			transformable.setPosition(degrees_, -degrees_);
+			transformable.setRotation(degrees_);
+			transformable.setScale(2.f, 0.5f);
+			transforms.push_back(transformable.getTransform());
+		});
+
+	std::vector<sf::Vector2f>	positions(transforms.size()), scales(transforms.size());
+	std::vector<float>			rotations(transforms.size());
+	sfui::transform_algorithm::decompose(transforms.data(), transforms.size(), positions.data(), rotations.data(), scales.data());
+
+	for (std::size_t i = 0; i < transforms.size(); ++i)
+	{
+		auto const scalar = sfui::transform_algorithm::decompose(transforms[i]);
+
+		double const difference = std::abs(rotations[i] - scalar.rotation);
+		SFMLUI_CHECK(std::min(difference, 360.0 - difference) <= 1e-3);
+		SFMLUI_CHECK_NEAR(positions[i].x, scalar.position.x, 1e-3);
+		SFMLUI_CHECK_NEAR(scales[i].y, scalar.scale.y, 1e-5);
+	}
+}
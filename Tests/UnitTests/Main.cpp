@@ -0,0 +1,44 @@
+#include "UnitTestsPCH.hpp"
+
+#include "Test.hpp"
+
+namespace tests
+{
+
+//////////////////////////////////////////////////////////////////////////////
+std::vector<TestCase>& getTests()
+{
+	static std::vector<TestCase> tests;
+	return tests;
+}
+
+}
+
+// Runs every test case whose name contains the first argument (or all of them).
+// Returns number of failed test cases, so the exit code can be used by CI.
+int main(int argc_, char* argv_[])
+{
+	std::string const filter = argc_ > 1 ? argv_[1] : "";
+
+	int run = 0, failed = 0;
+	for (auto const & test : tests::getTests())
+	{
+		if (std::string{ test.name }.find(filter) == std::string::npos)
+			continue;
+
+		++run;
+		try
+		{
+			test.function();
+			std::cout << "[ OK ] " << test.name << '\n';
+		}
+		catch (std::exception const & exception_)
+		{
+			++failed;
+			std::cout << "[FAIL] " << test.name << ": " << exception_.what() << '\n';
+		}
+	}
+
+	std::cout << run - failed << " of " << run << " tests passed.\n";
+	return failed;
+}
@@ -0,0 +1,68 @@
+#include "UnitTestsPCH.hpp"
+
+#include "Test.hpp"
+
+#include <SFML-UI/Core/Math/Random.hpp>
+
+#include <set>
+#include <thread>
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TEST(xoshiroStreamsAreDistinct)
+{
+	std::set<std::uint64_t> firstValues;
+	for (std::uint64_t stream = 0; stream < 10'000; ++stream)
+		firstValues.insert(math::random::Xoshiro256PlusPlus::forStream(123, stream)());
+	SFMLUI_CHECK(firstValues.size() == 10'000);
+
+	// Same seed and stream give the same sequence:
+	auto a = math::random::Xoshiro256PlusPlus::forStream(123, 77);
+	auto b = math::random::Xoshiro256PlusPlus::forStream(123, 77);
+	for (int i = 0; i < 100; ++i)
+		SFMLUI_CHECK(a() == b());
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TEST(xoshiroStreamOfHugeIndexIsImmediate)
+{
+	// Used to jump once per stream index, so this took effectively forever:
+	auto const start	= std::chrono::steady_clock::now();
+	auto generator		= math::random::Xoshiro256PlusPlus::forStream(123, 0xFFFF'FFFF'FFFF'FFFFull);
+	auto const elapsed	= std::chrono::steady_clock::now() - start;
+
+	SFMLUI_CHECK(generator() != generator());
+	SFMLUI_CHECK(elapsed < std::chrono::milliseconds{ 10 });
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TEST(seededThreadsRepeatSequence)
+{
+	auto const sample = [](std::uint64_t const stream_)
+		{
+			std::vector<std::uint64_t> values;
+			std::thread{ [&]
+				{
+					math::random::seedThread(stream_);
+					for (int i = 0; i < 8; ++i)
+						values.push_back(math::random::threadEngine()());
+				} }.join();
+			return values;
+		};
+
+	SFMLUI_CHECK(sample(5) == sample(5));
+	SFMLUI_CHECK(sample(5) != sample(6));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TEST(seedThreadDoesNotAcquireStream)
+{
+	std::uint64_t const before = math::random::detail::acquireStreamIndex();
+	std::thread{ []
+		{
+			math::random::seedThread(9);
+			math::random::threadEngine()();
+			math::random::seedThread<math::random::Pcg32>(9);
+			math::random::threadEngine<math::random::Pcg32>()();
+		} }.join();
+	SFMLUI_CHECK(math::random::detail::acquireStreamIndex() == before + 1);
+}
@@ -0,0 +1,75 @@
+// File description:
+// Implements minimal test registry and check macros used by unit tests.
+#pragma once
+
+#include "UnitTestsPCH.hpp"
+
+namespace tests
+{
+
+/// <summary>
+/// Registered test case.
+/// </summary>
+struct TestCase
+{
+	char const*	name;
+	void		(*function)();
+};
+
+/// <summary>
+/// Returns every registered test case.
+/// </summary>
+/// <returns>Reference to the test list.</returns>
+std::vector<TestCase>& getTests();
+
+/// <summary>
+/// Adds test case to the list during static initialization (see <see cref="SFMLUI_TEST"/>).
+/// </summary>
+struct TestRegistrar
+{
+	TestRegistrar(char const* name_, void (*function_)()) {
+		getTests().push_back({ name_, function_ });
+	}
+};
+
+/// <summary>
+/// Thrown when a check fails, stops the current test case.
+/// </summary>
+class CheckFailure
+	: public std::runtime_error
+{
+public:
+	using std::runtime_error::runtime_error;
+};
+
+/// <summary>
+/// Builds failure message with location of the check.
+/// </summary>
+inline std::string describeFailure(char const* file_, int const line_, std::string const & message_) {
+	return std::string{ file_ } + "(" + std::to_string(line_) + "): " + message_;
+}
+
+} // namespace tests
+
+// Defines and registers a test case:
+#define SFMLUI_TEST(name_) \
+	static void name_(); \
+	static tests::TestRegistrar const name_##Registrar{ #name_, &name_ }; \
+	static void name_()
+
+// Fails the test case when the condition is false:
+#define SFMLUI_CHECK(condition_) \
+	do { \
+		if (!(condition_)) \
+			throw tests::CheckFailure{ tests::describeFailure(__FILE__, __LINE__, #condition_) }; \
+	} while (false)
+
+// Fails the test case when |actual - expected| is greater than the tolerance:
+#define SFMLUI_CHECK_NEAR(actual_, expected_, tolerance_) \
+	do { \
+		double const sfmluiActual	= static_cast<double>(actual_); \
+		double const sfmluiExpected	= static_cast<double>(expected_); \
+		if (!(std::abs(sfmluiActual - sfmluiExpected) <= static_cast<double>(tolerance_))) \
+			throw tests::CheckFailure{ tests::describeFailure(__FILE__, __LINE__, \
+				#actual_ " = " + std::to_string(sfmluiActual) + ", expected " + std::to_string(sfmluiExpected) + " +- " #tolerance_) }; \
+	} while (false)
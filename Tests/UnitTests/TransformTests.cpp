@@ -0,0 +1,48 @@
+#include "UnitTestsPCH.hpp"
+
+#include "Test.hpp"
+
+#include <SFML-UI/Core/Transform.hpp>
+
+namespace
+{
+
+//////////////////////////////////////////////////////////////////////////////
+// Rotation by -angle_ radians, i.e. just below 360 degrees for tiny angles.
+sf::Transform makeRotationBelowZero(float const angle_)
+{
+	return sf::Transform{
+		1.f, angle_, 0.f,
+		-angle_, 1.f, 0.f,
+		0.f, 0.f, 1.f };
+}
+
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TEST(decomposeWrapsRotationBelow360)
+{
+	for (float const angle : { 1e-8f, 1e-7f, 1e-6f, 1e-5f })
+	{
+		auto const precise	= sfui::transform_algorithm::decompose(makeRotationBelowZero(angle));
+		auto const fast		= sfui::transform_algorithm::decompose(makeRotationBelowZero(angle), math::Fast);
+
+		SFMLUI_CHECK(precise.rotation >= 0.f && precise.rotation < 360.f);
+		SFMLUI_CHECK(fast.rotation >= 0.f && fast.rotation < 360.f);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+SFMLUI_TEST(batchDecomposeWrapsRotationBelow360)
+{
+	std::vector<sf::Transform> transforms;
+	for (int i = 0; i < 16; ++i)
+		transforms.push_back(makeRotationBelowZero(1e-8f * static_cast<float>(i + 1)));
+
+	std::vector<sf::Vector2f>	positions(transforms.size()), scales(transforms.size());
+	std::vector<float>			rotations(transforms.size());
+	sfui::transform_algorithm::decompose(transforms.data(), transforms.size(), positions.data(), rotations.data(), scales.data());
+
+	for (float const rotation : rotations)
+		SFMLUI_CHECK(rotation >= 0.f && rotation < 360.f);
+}
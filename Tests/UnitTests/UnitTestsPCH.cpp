@@ -0,0 +1 @@
+#include "UnitTestsPCH.hpp"
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <SFML-UI/Everything.hpp>
+
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>